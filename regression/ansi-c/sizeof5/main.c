@@ -0,0 +1,49 @@
+#define STATIC_ASSERT(condition) \
+  int some_array##__LINE__[(condition) ? 1 : -1];
+
+struct inner
+{
+  char c;
+  int i;
+};
+
+typedef struct inner inner_t;
+
+struct outer
+{
+  inner_t a;
+  char c;
+  struct inner b[3];
+  unsigned bits:3;
+};
+
+union u
+{
+  struct outer o;
+  char c;
+};
+
+// the same types are checked and sized over and over again
+STATIC_ASSERT(sizeof(struct inner)==2*sizeof(int));
+STATIC_ASSERT(sizeof(inner_t)==2*sizeof(int));
+STATIC_ASSERT(sizeof(struct outer)==10*sizeof(int));
+STATIC_ASSERT(sizeof(struct outer)==10*sizeof(int));
+STATIC_ASSERT(sizeof(union u)==sizeof(struct outer));
+STATIC_ASSERT(__builtin_offsetof(struct outer, b)==3*sizeof(int));
+STATIC_ASSERT(__alignof__(union u)==__alignof__(int));
+
+// a tag that is incomplete at first
+struct later;
+struct later *p;
+
+struct later
+{
+  struct outer o[2];
+};
+
+STATIC_ASSERT(sizeof(struct later)==2*sizeof(struct outer));
+STATIC_ASSERT(sizeof(*p)==2*sizeof(struct outer));
+
+int main()
+{
+}
@@ -0,0 +1,19 @@
+#ifndef __cplusplus
+#error "the built-in preprocessor must not be used for C++"
+#endif
+
+class countert
+{
+public:
+  countert():count(0) { }
+  void inc() { count++; }
+  int count;
+};
+
+int main()
+{
+  countert c;
+  c.inc();
+  __CPROVER_assert(c.count==1, "count");
+  return 0;
+}
@@ -0,0 +1,17 @@
+class exceptions19
+{
+  static int g()
+  {
+    return 1;
+  }
+
+  static int f()
+  {
+    return g();
+  }
+
+  public static void main(String[] args)
+  {
+    f();
+  }
+}
@@ -0,0 +1,12 @@
+class Node
+{
+  Node next;
+  int value;
+}
+
+class nondet_tree1
+{
+  static void f(Node n)
+  {
+  }
+}
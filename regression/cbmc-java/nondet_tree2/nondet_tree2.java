@@ -0,0 +1,15 @@
+class Node
+{
+  Node next;
+  int value;
+}
+
+class nondet_tree2
+{
+  static void f(Node n)
+  {
+    // needs a list of three nodes
+    if(n!=null && n.next!=null && n.next.next!=null)
+      throw new AssertionError();
+  }
+}
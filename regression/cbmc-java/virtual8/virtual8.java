@@ -0,0 +1,23 @@
+class A
+{
+  int f() { return 1; }
+}
+
+class B extends A
+{
+  int f() { return 2; }
+}
+
+class C extends A
+{
+  int f() { return 3; }
+}
+
+public class virtual8
+{
+  public static void main(String[] args)
+  {
+    A a=new B();
+    a.f();
+  }
+}
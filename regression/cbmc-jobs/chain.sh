@@ -0,0 +1,31 @@
+#!/bin/bash
+
+# Compares the goto functions obtained with the options of the test
+# with those obtained with a single job, then verifies the program.
+
+set -e
+
+cbmc=../../../src/cbmc/cbmc
+
+name=${@:$#}
+args=${@:1:$#-1}
+
+out_dir=`mktemp -d`
+trap "rm -rf $out_dir" EXIT
+
+# the goto functions, without the instruction numbers, in a fixed order
+show_goto_functions()
+{
+  $cbmc "$@" --show-goto-functions $name | sed -n '/^\^\^\^/,$p' | \
+    sed 's/^\( *\)\/\/ [0-9]* /\1\/\/ /' | \
+    perl -0777 -ne 'print sort split /^\^+\n/m'
+}
+
+show_goto_functions --jobs 1 > $out_dir/sequential.txt
+show_goto_functions $args > $out_dir/parallel.txt
+
+if diff $out_dir/sequential.txt $out_dir/parallel.txt ; then
+  echo "same goto functions"
+fi
+
+$cbmc $args $name
@@ -0,0 +1,32 @@
+int x;
+
+int f(int a)
+{
+  return a>0 && a<10 ? a++ : a--;
+}
+
+int g(int a)
+{
+  int b=f(a);
+  return (a||b) ? b+1 : b-1;
+}
+
+int h(int a)
+{
+  int b=g(a);
+  return b>0 && f(b)>0;
+}
+
+int main()
+{
+  int a[2];
+
+  assert(f(5)==5);
+  assert(g(5)==6);
+  assert(h(x)==1);
+
+  __CPROVER_assume( __CPROVER_forall { char i; (i>=0 && i<2) ==> a[i]>=10 && a[i]<=10 } );
+  assert(a[0]==10 && a[1]==10);
+
+  return 0;
+}
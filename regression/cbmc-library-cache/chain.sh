@@ -0,0 +1,17 @@
+#!/bin/bash
+
+set -e
+
+cbmc=../../../src/cbmc/cbmc
+
+runs=$1
+name=${@:$#}
+args=${@:2:$#-2}
+
+cache_dir=`mktemp -d`
+trap "rm -rf $cache_dir" EXIT
+
+for run in `seq 1 $runs` ; do
+  echo "## Run $run"
+  $cbmc $args --cprover-library-cache $cache_dir --verbosity 10 $name
+done
@@ -0,0 +1,11 @@
+#include <assert.h>
+#include <stdlib.h>
+
+int main()
+{
+  int *p=malloc(sizeof(int));
+  *p=abs(-3);
+  assert(*p==3);
+  free(p);
+  return 0;
+}
@@ -0,0 +1,45 @@
+#include <assert.h>
+#include <limits.h>
+#include <stdarg.h>
+#include <stddef.h>
+
+#define str(x) #x
+#define xstr(x) str(x)
+#define cat(a, b) a ## b
+#define sum(first, ...) add(first, __VA_ARGS__)
+#define log(format, ...) printf(format, ## __VA_ARGS__)
+
+int printf(const char *, ...);
+
+int add(int n, ...)
+{
+  va_list args;
+  va_start(args, n);
+  int result=va_arg(args, int);
+  va_end(args);
+  return n+result;
+}
+
+struct s
+{
+  char c;
+  int i;
+};
+
+int main()
+{
+  int cat(x, 1)=sum(1, 2);
+  assert(x1==3);
+  assert(sizeof(xstr(__LINE__))==3);
+  assert(offsetof(struct s, c)==0);
+  assert(CHAR_BIT==8);
+  log("done\n");
+
+#if defined(INT_MAX) && INT_MAX>0x7fff && !defined(undefined_macro)
+  assert(__STDC__);
+#else
+  assert(0);
+#endif
+
+  return 0;
+}
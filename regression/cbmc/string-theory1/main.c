@@ -0,0 +1,28 @@
+typedef struct __CPROVER_string { char *s; } __CPROVER_string;
+
+__CPROVER_string __CPROVER_uninterpreted_string_literal_func(char *);
+__CPROVER_string __CPROVER_uninterpreted_string_concat_func(
+  __CPROVER_string, __CPROVER_string);
+int __CPROVER_uninterpreted_string_length_func(__CPROVER_string);
+__CPROVER_bool __CPROVER_uninterpreted_string_contains_func(
+  __CPROVER_string, __CPROVER_string);
+_Bool __CPROVER_uninterpreted_string_is_prefix_func(
+  __CPROVER_string, __CPROVER_string);
+
+int main()
+{
+  __CPROVER_string a=__CPROVER_uninterpreted_string_literal_func("ab");
+  __CPROVER_string b;
+  __CPROVER_string c=__CPROVER_uninterpreted_string_concat_func(a, b);
+
+  int length=__CPROVER_uninterpreted_string_length_func(c);
+  __CPROVER_assert(length>=2, "length");
+
+  __CPROVER_bool contains=__CPROVER_uninterpreted_string_contains_func(c, a);
+  __CPROVER_assert(contains, "contains");
+
+  _Bool prefix=__CPROVER_uninterpreted_string_is_prefix_func(a, c);
+  __CPROVER_assert(prefix, "prefix");
+
+  return 0;
+}
@@ -0,0 +1,17 @@
+#!/bin/bash
+
+set -e
+
+goto_analyzer=../../../src/goto-analyzer/goto-analyzer
+
+runs=$1
+name=${@:$#}
+args=${@:2:$#-2}
+
+cache_dir=`mktemp -d`
+trap "rm -rf $cache_dir" EXIT
+
+for run in `seq 1 $runs` ; do
+  echo "## Run $run"
+  $goto_analyzer $args --summary-cache $cache_dir/summaries $name
+done
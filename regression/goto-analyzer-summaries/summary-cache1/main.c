@@ -0,0 +1,17 @@
+#include <assert.h>
+
+int limit(int x)
+{
+  if(x<0)
+    return 0;
+  if(x>10)
+    return 10;
+  return x;
+}
+
+int main()
+{
+  int a=limit(1);
+  assert(a<=10);
+  return 0;
+}
@@ -0,0 +1,25 @@
+#include <assert.h>
+
+int clamp(int x)
+{
+  if(x<0)
+    return 0;
+  if(x>100)
+    return 100;
+  return x;
+}
+
+int scale(int x)
+{
+  int c=clamp(x);
+  if(c>50)
+    return 50;
+  return c;
+}
+
+int main()
+{
+  int a=scale(250);
+  assert(a<=50);
+  return 0;
+}
@@ -0,0 +1,12 @@
+#include <assert.h>
+
+int main()
+{
+  int i;
+
+  for(i=0; i<1000000; i++);
+
+  assert(i<=1000000);
+  assert(i>=1000000);
+  return 0;
+}
@@ -0,0 +1,21 @@
+#!/bin/bash
+
+# Runs the script of a test with the options of the test in a copy of
+# the test directory, so that no objects are left behind.
+
+set -e
+
+goto_cc=`cd ../../../src/goto-cc; pwd`/goto-cc
+cbmc=`cd ../../../src/cbmc; pwd`/cbmc
+export goto_cc cbmc
+
+script=${@:$#}
+args=${@:1:$#-1}
+
+work_dir=`mktemp -d`
+trap "rm -rf $work_dir" EXIT
+
+cp -r . $work_dir
+cd $work_dir
+
+bash ./$script $args
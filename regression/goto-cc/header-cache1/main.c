@@ -0,0 +1,9 @@
+#include <assert.h>
+#include <stdlib.h>
+
+int main()
+{
+  int *p=malloc(sizeof(int));
+  assert(p!=0);
+  return 0;
+}
@@ -0,0 +1,21 @@
+#!/bin/bash
+
+set -e
+
+mkdir cache
+
+echo "## Run 1"
+$goto_cc "$@" --header-cache cache --verbosity 10 -c main.c -o first.o \
+  2>&1 | grep "parsed headers" | sed "s/ [^ ]*$//"
+
+echo "## Run 2"
+$goto_cc "$@" --header-cache cache --verbosity 10 -c main.c -o second.o \
+  2>&1 | grep "parsed headers" | sed "s/ [^ ]*$//"
+
+# skip the progress output, which names the file that was read
+$cbmc --show-goto-functions first.o | sed -n '/^\^\^\^/,$p' > first.txt
+$cbmc --show-goto-functions second.o | sed -n '/^\^\^\^/,$p' > second.txt
+
+if diff first.txt second.txt ; then
+  echo "same goto functions"
+fi
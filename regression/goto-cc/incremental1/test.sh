@@ -0,0 +1,11 @@
+#!/bin/bash
+
+set -e
+
+$goto_cc "$@" -c a.c b.c
+
+# change one of the sources
+echo "int extra;" >> a.c
+
+echo "## Rebuild"
+$goto_cc "$@" --verbosity 9 -c a.c b.c 2>&1 | grep "^Writing\|up to date"
@@ -0,0 +1,11 @@
+#!/bin/bash
+
+set -e
+
+$goto_cc -c a.c
+
+echo "## Same options"
+$goto_cc --verbosity 9 -c a.c 2>&1 | grep "^Writing\|up to date"
+
+echo "## Changed options"
+$goto_cc --verbosity 9 "$@" -c a.c 2>&1 | grep "^Writing\|up to date"
@@ -0,0 +1,9 @@
+static int helper(int x)
+{
+  return x*x;
+}
+
+int square(int x)
+{
+  return helper(x);
+}
@@ -0,0 +1,11 @@
+int square(int);
+int twice(int);
+
+int main()
+{
+  int x;
+  __CPROVER_assume(x>=0 && x<10);
+  __CPROVER_assert(square(x)>=0, "square");
+  __CPROVER_assert(twice(x)!=18, "twice");
+  return 0;
+}
@@ -0,0 +1,23 @@
+#!/bin/bash
+
+set -e
+
+# the goto functions, without the instruction numbers, in a fixed order
+show_goto_functions()
+{
+  $cbmc --show-goto-functions "$1" | sed -n '/^\^\^\^/,$p' | \
+    sed 's/^\( *\)\/\/ [0-9]* /\1\/\/ /' | \
+    perl -0777 -ne 'print sort split /^\^+\n/m'
+}
+
+$goto_cc main.c a.c b.c -o sequential.gb
+$goto_cc "$@" main.c a.c b.c -o parallel.gb
+
+show_goto_functions sequential.gb > sequential.txt
+show_goto_functions parallel.gb > parallel.txt
+
+if diff sequential.txt parallel.txt ; then
+  echo "same goto functions"
+fi
+
+$cbmc parallel.gb
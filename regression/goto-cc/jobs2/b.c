@@ -0,0 +1,9 @@
+static int helper(int x)
+{
+  return x+x;
+}
+
+int twice(int x)
+{
+  return helper(x);
+}
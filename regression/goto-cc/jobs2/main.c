@@ -0,0 +1,7 @@
+int f(void);
+
+int main()
+{
+  __CPROVER_assert(f()==1, "f");
+  return 0;
+}
@@ -0,0 +1,11 @@
+#!/bin/bash
+
+if $goto_cc "$@" main.c a.c b.c -o main.gb ; then
+  echo "goto-cc succeeded"
+else
+  echo "goto-cc failed"
+fi
+
+if [ -e main.gb ] ; then
+  echo "main.gb written"
+fi
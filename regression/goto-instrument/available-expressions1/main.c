@@ -0,0 +1,11 @@
+int main()
+{
+  int a, b, c, d, x, y, z;
+  x=a+b;
+  y=a+b;
+  z=c*d;
+  a=1;
+  c=c*d;
+  __CPROVER_assert(x==y, "a+b is reused");
+  return 0;
+}
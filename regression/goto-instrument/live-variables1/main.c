@@ -0,0 +1,9 @@
+int main()
+{
+  int x, y, z;
+  x=1;
+  y=x+2;
+  z=3;
+  __CPROVER_assert(y==3, "y is 3");
+  return 0;
+}
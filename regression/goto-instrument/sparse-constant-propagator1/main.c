@@ -0,0 +1,14 @@
+int main()
+{
+  int x=1;
+  int y=x+2;
+  int z;
+
+  if(y==3)
+    z=y*2;
+  else
+    z=0;
+
+  __CPROVER_assert(z==6, "z is constant");
+  return 0;
+}
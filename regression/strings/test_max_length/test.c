@@ -0,0 +1,13 @@
+#include <assert.h>
+#include "../cprover-string-hack.h"
+
+
+int main()
+{
+  __CPROVER_string s, t, u;
+  s = __CPROVER_string_literal("ab");
+  u = __CPROVER_string_concat(s, t);
+  assert(__CPROVER_string_length(u) <= 3);
+  assert(__CPROVER_char_at(u, 0) == 'a');
+  return 0;
+}
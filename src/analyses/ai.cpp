@@ -19,6 +19,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/std_expr.h>
 #include <util/std_code.h>
 
+#include "ai_summaries.h"
 #include "is_threaded.h"
 
 jsont ai_domain_baset::output_json(
@@ -420,7 +421,7 @@ bool ai_baset::do_function_call(
 
     // do we need to do/re-do the fixedpoint of the body?
     if(new_data)
-      fixedpoint(goto_function.body, goto_functions, ns);
+      function_fixedpoint(f_it, goto_functions, ns);
   }
 
   // This is the edge from function end to return site.
@@ -531,7 +532,114 @@ void ai_baset::sequential_fixedpoint(
     f_it=goto_functions.function_map.find(goto_functions.entry_point());
 
   if(f_it!=goto_functions.function_map.end())
-    fixedpoint(f_it->second.body, goto_functions, ns);
+    function_fixedpoint(f_it, goto_functions, ns);
+}
+
+void ai_baset::function_fixedpoint(
+  const goto_functionst::function_mapt::const_iterator f_it,
+  const goto_functionst &goto_functions,
+  const namespacet &ns)
+{
+  const goto_programt &body=f_it->second.body;
+
+  irept entry;
+
+  if(summaries==nullptr ||
+     body.empty() ||
+     get_state(body.instructions.begin()).to_irep(entry))
+  {
+    fixedpoint(body, goto_functions, ns);
+    return;
+  }
+
+  if(!apply_summary(f_it->first, entry, goto_functions))
+  {
+    summaries->hits++;
+    return;
+  }
+
+  summaries->misses++;
+  fixedpoint(body, goto_functions, ns);
+  record_summary(f_it->first, entry, goto_functions);
+}
+
+/// Merge the states recorded in a summary for the given entry state
+/// into the states of the function and its callees.
+bool ai_baset::apply_summary(
+  const irep_idt &function,
+  const irept &entry,
+  const goto_functionst &goto_functions)
+{
+  const ai_summariest::summaryt *summary=summaries->find(function, entry);
+
+  if(summary==nullptr)
+    return true;
+
+  irep_idt current;
+  std::vector<locationt> locations;
+
+  for(const auto &location_state : summary->states)
+  {
+    if(location_state.function!=current)
+    {
+      current=location_state.function;
+      locations.clear();
+
+      goto_functionst::function_mapt::const_iterator f_it=
+        goto_functions.function_map.find(current);
+      if(f_it==goto_functions.function_map.end())
+        return true;
+
+      forall_goto_program_instructions(i_it, f_it->second.body)
+        locations.push_back(i_it);
+    }
+
+    if(location_state.offset>=locations.size())
+      return true;
+
+    locationt l=locations[location_state.offset];
+
+    std::unique_ptr<statet> tmp_state(make_temporary_state(get_state(l)));
+    if(tmp_state->from_irep(location_state.state))
+      return true;
+
+    merge(*tmp_state, l, l);
+  }
+
+  return false;
+}
+
+void ai_baset::record_summary(
+  const irep_idt &function,
+  const irept &entry,
+  const goto_functionst &goto_functions)
+{
+  ai_summariest::location_statest states;
+
+  for(const auto &callee : summaries->get_callees(function))
+  {
+    goto_functionst::function_mapt::const_iterator f_it=
+      goto_functions.function_map.find(callee);
+    if(f_it==goto_functions.function_map.end())
+      continue;
+
+    std::size_t offset=0;
+
+    forall_goto_program_instructions(i_it, f_it->second.body)
+    {
+      ai_summariest::location_statet location_state;
+      location_state.function=callee;
+      location_state.offset=offset++;
+
+      // the domain cannot be stored
+      if(find_state(i_it).to_irep(location_state.state))
+        return;
+
+      states.push_back(location_state);
+    }
+  }
+
+  summaries->insert(function, entry, states);
 }
 
 void ai_baset::concurrent_fixedpoint(
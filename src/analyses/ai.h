@@ -23,6 +23,7 @@ Author: Daniel Kroening, kroening@kroening.com
 
 // forward reference
 class ai_baset;
+class ai_summariest;
 
 // don't use me -- I am just a base class
 // please derive from me
@@ -101,6 +102,19 @@ public:
   virtual bool ai_simplify_lhs(
     exprt &condition,
     const namespacet &ns) const;
+
+  // Conversion to and from irept, which is needed for function
+  // summaries (see ai_summariest). Return true if the domain does
+  // not support this.
+  virtual bool to_irep(irept &dest) const
+  {
+    return true;
+  }
+
+  virtual bool from_irep(const irept &src)
+  {
+    return true;
+  }
 };
 
 // don't use me -- I am just a base class
@@ -111,7 +125,7 @@ public:
   typedef ai_domain_baset statet;
   typedef goto_programt::const_targett locationt;
 
-  ai_baset()
+  ai_baset():summaries(nullptr)
   {
   }
 
@@ -119,6 +133,15 @@ public:
   {
   }
 
+  // Use function summaries: the body of a function is only analysed
+  // if there is no summary for its entry state, and new summaries are
+  // recorded in the given store. Requires a domain that implements
+  // to_irep and from_irep; otherwise summaries are not used.
+  void set_summaries(ai_summariest &_summaries)
+  {
+    summaries=&_summaries;
+  }
+
   void operator()(
     const goto_programt &goto_program,
     const namespacet &ns)
@@ -308,6 +331,25 @@ protected:
   typedef std::set<irep_idt> recursion_sett;
   recursion_sett recursion_set;
 
+  ai_summariest *summaries;
+
+  // fixedpoint of a function body, using summaries if available
+  void function_fixedpoint(
+    const goto_functionst::function_mapt::const_iterator f_it,
+    const goto_functionst &goto_functions,
+    const namespacet &ns);
+
+  // true if there is no applicable summary
+  bool apply_summary(
+    const irep_idt &function,
+    const irept &entry,
+    const goto_functionst &goto_functions);
+
+  void record_summary(
+    const irep_idt &function,
+    const irept &entry,
+    const goto_functionst &goto_functions);
+
   // function calls
   bool do_function_call_rec(
     locationt l_call, locationt l_return,
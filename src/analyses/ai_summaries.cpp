@@ -0,0 +1,258 @@
+/*******************************************************************\
+
+Module: Function Summaries for Abstract Interpretation
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Function Summaries for Abstract Interpretation
+
+#include "ai_summaries.h"
+
+#include <cassert>
+#include <fstream>
+
+#include <util/irep_hash.h>
+#include <util/irep_serialization.h>
+#include <util/std_code.h>
+#include <util/std_expr.h>
+
+static void collect_called_functions(
+  const exprt &function,
+  std::set<irep_idt> &dest)
+{
+  if(function.id()==ID_symbol)
+    dest.insert(to_symbol_expr(function).get_identifier());
+  else if(function.id()==ID_if)
+  {
+    collect_called_functions(to_if_expr(function).true_case(), dest);
+    collect_called_functions(to_if_expr(function).false_case(), dest);
+  }
+}
+
+/// Hash of the instructions of a body. Targets are hashed relative to
+/// the first instruction, so that the hash does not depend on the
+/// numbering of other functions.
+std::size_t ai_summariest::body_hash(const goto_programt &goto_program)
+{
+  std::size_t h=0;
+
+  if(goto_program.instructions.empty())
+    return h;
+
+  const unsigned begin=
+    goto_program.instructions.begin()->location_number;
+
+  forall_goto_program_instructions(i_it, goto_program)
+  {
+    h=hash_combine(h, static_cast<std::size_t>(i_it->type));
+    h=hash_combine(h, i_it->code.hash());
+    h=hash_combine(h, i_it->guard.hash());
+
+    for(const auto &t : i_it->targets)
+      h=hash_combine(h, t->location_number-begin);
+  }
+
+  return h;
+}
+
+void ai_summariest::set_program(const goto_functionst &goto_functions)
+{
+  function_infos.clear();
+
+  typedef std::unordered_map<irep_idt, std::size_t, irep_id_hash>
+    body_hashest;
+  body_hashest body_hashes;
+  typedef std::unordered_map<irep_idt, std::set<irep_idt>, irep_id_hash>
+    direct_callst;
+  direct_callst direct_calls;
+
+  forall_goto_functions(f_it, goto_functions)
+  {
+    body_hashes[f_it->first]=body_hash(f_it->second.body);
+
+    std::set<irep_idt> &calls=direct_calls[f_it->first];
+    forall_goto_program_instructions(i_it, f_it->second.body)
+      if(i_it->is_function_call())
+        collect_called_functions(
+          to_code_function_call(i_it->code).function(), calls);
+  }
+
+  forall_goto_functions(f_it, goto_functions)
+  {
+    function_infot &info=function_infos[f_it->first];
+
+    // transitive closure of the call relation, including the
+    // function itself
+    std::vector<irep_idt> stack(1, f_it->first);
+    while(!stack.empty())
+    {
+      irep_idt f=stack.back();
+      stack.pop_back();
+
+      if(!info.callees.insert(f).second)
+        continue;
+
+      direct_callst::const_iterator c_it=direct_calls.find(f);
+      if(c_it!=direct_calls.end())
+        stack.insert(stack.end(), c_it->second.begin(), c_it->second.end());
+    }
+
+    std::size_t h=0;
+    for(const auto &f : info.callees)
+    {
+      body_hashest::const_iterator b_it=body_hashes.find(f);
+      h=hash_combine(h, f.hash());
+      h=hash_combine(h, b_it==body_hashes.end()?0:b_it->second);
+    }
+
+    info.fingerprint=h;
+  }
+}
+
+const ai_summariest::summaryt *ai_summariest::find(
+  const irep_idt &function,
+  const irept &entry) const
+{
+  function_infost::const_iterator i_it=function_infos.find(function);
+  summariest::const_iterator s_it=summaries.find(function);
+
+  if(i_it==function_infos.end() || s_it==summaries.end())
+    return nullptr;
+
+  for(const auto &summary : s_it->second)
+    if(summary.fingerprint==i_it->second.fingerprint &&
+       summary.entry==entry)
+      return &summary;
+
+  return nullptr;
+}
+
+void ai_summariest::insert(
+  const irep_idt &function,
+  const irept &entry,
+  const location_statest &states)
+{
+  function_infost::const_iterator i_it=function_infos.find(function);
+  assert(i_it!=function_infos.end());
+
+  summaryt summary;
+  summary.fingerprint=i_it->second.fingerprint;
+  summary.entry=entry;
+  summary.states=states;
+
+  summaries[function].push_back(summary);
+}
+
+const std::set<irep_idt> &ai_summariest::get_callees(
+  const irep_idt &function) const
+{
+  function_infost::const_iterator i_it=function_infos.find(function);
+  assert(i_it!=function_infos.end());
+  return i_it->second.callees;
+}
+
+bool ai_summariest::load(const std::string &file_name)
+{
+  std::ifstream in(file_name, std::ios::binary);
+
+  // no summaries yet
+  if(!in)
+    return false;
+
+  irep_serializationt::ireps_containert ic;
+  irep_serializationt irepconverter(ic);
+
+  if(id2string(irepconverter.read_gb_string(in))!="AI-SUMMARIES")
+    return true;
+
+  // summaries of a different domain
+  if(id2string(irepconverter.read_gb_string(in))!=tag)
+    return false;
+
+  std::size_t function_count=irepconverter.read_gb_word(in);
+
+  for(std::size_t f=0; f<function_count; f++)
+  {
+    irep_idt function=irepconverter.read_string_ref(in);
+    std::vector<summaryt> &function_summaries=summaries[function];
+
+    std::size_t summary_count=irepconverter.read_gb_word(in);
+
+    for(std::size_t s=0; s<summary_count; s++)
+    {
+      function_summaries.push_back(summaryt());
+      summaryt &summary=function_summaries.back();
+
+      summary.fingerprint=irepconverter.read_gb_word(in);
+      irepconverter.reference_convert(in, summary.entry);
+
+      summary.states.resize(irepconverter.read_gb_word(in));
+      for(auto &location_state : summary.states)
+      {
+        location_state.function=irepconverter.read_string_ref(in);
+        location_state.offset=irepconverter.read_gb_word(in);
+        irepconverter.reference_convert(in, location_state.state);
+      }
+    }
+  }
+
+  return !in;
+}
+
+bool ai_summariest::save(const std::string &file_name) const
+{
+  std::ofstream out(file_name, std::ios::binary);
+
+  if(!out)
+    return true;
+
+  irep_serializationt::ireps_containert ic;
+  irep_serializationt irepconverter(ic);
+
+  write_gb_string(out, "AI-SUMMARIES");
+  write_gb_string(out, tag);
+
+  // summaries of functions that have changed are dropped
+  std::vector<std::pair<irep_idt, std::vector<const summaryt *> > > valid;
+
+  for(const auto &entry : summaries)
+  {
+    function_infost::const_iterator i_it=function_infos.find(entry.first);
+    if(i_it==function_infos.end())
+      continue;
+
+    valid.push_back(std::make_pair(entry.first,
+      std::vector<const summaryt *>()));
+
+    for(const auto &summary : entry.second)
+      if(summary.fingerprint==i_it->second.fingerprint)
+        valid.back().second.push_back(&summary);
+  }
+
+  write_gb_word(out, valid.size());
+
+  for(const auto &entry : valid)
+  {
+    irepconverter.write_string_ref(out, entry.first);
+    write_gb_word(out, entry.second.size());
+
+    for(const auto summary : entry.second)
+    {
+      write_gb_word(out, summary->fingerprint);
+      irepconverter.reference_convert(summary->entry, out);
+
+      write_gb_word(out, summary->states.size());
+      for(const auto &location_state : summary->states)
+      {
+        irepconverter.write_string_ref(out, location_state.function);
+        write_gb_word(out, location_state.offset);
+        irepconverter.reference_convert(location_state.state, out);
+      }
+    }
+  }
+
+  return !out;
+}
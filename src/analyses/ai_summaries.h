@@ -0,0 +1,102 @@
+/*******************************************************************\
+
+Module: Function Summaries for Abstract Interpretation
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Function Summaries for Abstract Interpretation
+
+#ifndef CPROVER_ANALYSES_AI_SUMMARIES_H
+#define CPROVER_ANALYSES_AI_SUMMARIES_H
+
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <goto-programs/goto_functions.h>
+
+/// A store of function summaries for ai_baset. A summary records, for
+/// one entry state of a function, the states at all locations of the
+/// function and of the functions it transitively calls. A summary is
+/// only valid as long as the fingerprint of the function (which covers
+/// the bodies of all transitive callees) is unchanged, which allows
+/// summaries to be kept on disk and reused by later runs.
+class ai_summariest
+{
+public:
+  /// \param _tag: identifies the abstract domain; summaries stored with
+  ///   a different tag are ignored on load
+  explicit ai_summariest(const std::string &_tag):
+    hits(0),
+    misses(0),
+    tag(_tag)
+  {
+  }
+
+  struct location_statet
+  {
+    irep_idt function;
+    std::size_t offset;
+    irept state;
+  };
+
+  typedef std::vector<location_statet> location_statest;
+
+  struct summaryt
+  {
+    std::size_t fingerprint;
+    irept entry;
+    location_statest states;
+  };
+
+  /// compute the fingerprints of all functions in goto_functions
+  void set_program(const goto_functionst &goto_functions);
+
+  /// returns nullptr if there is no matching summary
+  const summaryt *find(
+    const irep_idt &function,
+    const irept &entry) const;
+
+  void insert(
+    const irep_idt &function,
+    const irept &entry,
+    const location_statest &states);
+
+  /// the functions whose states are recorded in a summary of 'function'
+  const std::set<irep_idt> &get_callees(const irep_idt &function) const;
+
+  // true on error
+  bool load(const std::string &file_name);
+  bool save(const std::string &file_name) const;
+
+  std::size_t hits, misses;
+
+protected:
+  const std::string tag;
+
+  struct function_infot
+  {
+    function_infot():fingerprint(0)
+    {
+    }
+
+    std::size_t fingerprint;
+    std::set<irep_idt> callees;
+  };
+
+  typedef std::unordered_map<irep_idt, function_infot, irep_id_hash>
+    function_infost;
+  function_infost function_infos;
+
+  typedef std::unordered_map<irep_idt, std::vector<summaryt>, irep_id_hash>
+    summariest;
+  summariest summaries;
+
+  static std::size_t body_hash(const goto_programt &);
+};
+
+#endif // CPROVER_ANALYSES_AI_SUMMARIES_H
@@ -0,0 +1,185 @@
+/*******************************************************************\
+
+Module: Available Expressions
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Available Expressions
+
+#include "available_expressions.h"
+
+#include <util/find_symbols.h>
+#include <util/std_code.h>
+
+#include <langapi/language_util.h>
+
+/// \return true iff expr is a side-effect free computation over tracked
+///   local variables
+bool available_expressionst::is_tracked(const exprt &expr) const
+{
+  if(expr.id()==ID_symbol)
+  {
+    const irep_idt &identifier=to_symbol_expr(expr).get_identifier();
+    return locals.is_local(identifier) && !dirty(identifier);
+  }
+  else if(expr.id()==ID_constant)
+    return true;
+  else if(expr.id()==ID_code ||
+          expr.id()==ID_side_effect ||
+          expr.id()==ID_dereference ||
+          expr.id()==ID_address_of ||
+          expr.id()==ID_nondet_symbol ||
+          expr.id()==ID_function_application ||
+          !expr.has_operands())
+    return false;
+
+  forall_operands(it, expr)
+    if(!is_tracked(*it))
+      return false;
+
+  return true;
+}
+
+/// adds the tracked expressions computed by src to dest
+void available_expressionst::collect(
+  const exprt &src,
+  dense_bitvectort &dest)
+{
+  forall_operands(it, src)
+    collect(*it, dest);
+
+  if(src.id()==ID_symbol ||
+     src.id()==ID_constant ||
+     !is_tracked(src))
+    return;
+
+  const std::size_t old_size=expressions.size();
+  const std::size_t n=expressions.number(src);
+  dest.insert(n);
+
+  if(expressions.size()!=old_size)
+  {
+    find_symbols_sett symbols;
+    find_symbols(src, symbols);
+
+    for(const auto &identifier : symbols)
+      readers[identifier].insert(n);
+  }
+}
+
+/// adds the expressions that an assignment to lhs invalidates to dest
+void available_expressionst::kill(
+  const exprt &lhs,
+  dense_bitvectort &dest) const
+{
+  find_symbols_sett symbols;
+  find_symbols(lhs, symbols);
+
+  for(const auto &identifier : symbols)
+  {
+    readerst::const_iterator r_it=readers.find(identifier);
+    if(r_it!=readers.end())
+      dest.union_with(r_it->second);
+  }
+}
+
+void available_expressionst::build(const goto_functiont &goto_function)
+{
+  // number the expressions, which gives the gen sets
+  for(node_nrt n=0; n<cfg.nodes.size(); n++)
+  {
+    const goto_programt::instructiont &instruction=*cfg.nodes[n].t;
+    loc_infot &loc_info=loc_infos[n];
+
+    switch(instruction.type)
+    {
+    case ASSIGN:
+      collect(to_code_assign(instruction.code).rhs(), loc_info.gen);
+      break;
+
+    case FUNCTION_CALL:
+      for(const auto &arg :
+            to_code_function_call(instruction.code).arguments())
+        collect(arg, loc_info.gen);
+      break;
+
+    case DECL:
+    case DEAD:
+      break;
+
+    default:
+      collect(instruction.code, loc_info.gen);
+    }
+
+    collect(instruction.guard, loc_info.gen);
+  }
+
+  // the kill sets need all expressions
+  for(node_nrt n=0; n<cfg.nodes.size(); n++)
+  {
+    const goto_programt::instructiont &instruction=*cfg.nodes[n].t;
+    loc_infot &loc_info=loc_infos[n];
+
+    switch(instruction.type)
+    {
+    case ASSIGN:
+      kill(to_code_assign(instruction.code).lhs(), loc_info.kill);
+      break;
+
+    case FUNCTION_CALL:
+      kill(to_code_function_call(instruction.code).lhs(), loc_info.kill);
+      break;
+
+    case DECL:
+      kill(to_code_decl(instruction.code).symbol(), loc_info.kill);
+      break;
+
+    case DEAD:
+      kill(to_code_dead(instruction.code).symbol(), loc_info.kill);
+      break;
+
+    default:
+      {
+      }
+    }
+
+    // x=x+1 does not make x+1 available
+    loc_info.gen.subtract(loc_info.kill);
+  }
+
+  solve(expressions.size());
+}
+
+bool available_expressionst::is_available(
+  goto_programt::const_targett t,
+  const exprt &expr) const
+{
+  hash_numbering<exprt, irep_hash>::number_type n;
+  if(expressions.get_number(expr, n))
+    return false;
+
+  return get_in(t).contains(n);
+}
+
+void available_expressionst::output(
+  std::ostream &out,
+  const goto_functiont &goto_function,
+  const namespacet &ns) const
+{
+  forall_goto_program_instructions(i_it, goto_function.body)
+  {
+    out << "**** " << i_it->source_location << "\n";
+
+    get_in(i_it).for_each([&](std::size_t n)
+    {
+      out << "  " << from_expr(ns, i_it->function, expressions[n]) << "\n";
+    });
+
+    out << "\n";
+    goto_function.body.output_instruction(ns, "", out, i_it);
+    out << "\n";
+  }
+}
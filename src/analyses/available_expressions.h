@@ -0,0 +1,65 @@
+/*******************************************************************\
+
+Module: Available Expressions
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Available Expressions
+
+#ifndef CPROVER_ANALYSES_AVAILABLE_EXPRESSIONS_H
+#define CPROVER_ANALYSES_AVAILABLE_EXPRESSIONS_H
+
+#include <util/numbering.h>
+
+#include "dirty.h"
+#include "gen_kill_analysis.h"
+#include "locals.h"
+
+/// Forward must-analysis of the expressions that have been computed on
+/// every path to a location, and whose operands have not been changed
+/// since. Only side-effect free expressions over local variables whose
+/// address is never taken are tracked, as these cannot be changed by
+/// assignments through pointers or by function calls.
+class available_expressionst:public gen_kill_analysist
+{
+public:
+  explicit available_expressionst(const goto_functiont &goto_function):
+    gen_kill_analysist(
+      goto_function, directiont::FORWARD, meett::INTERSECTION),
+    dirty(goto_function),
+    locals(goto_function)
+  {
+    build(goto_function);
+  }
+
+  /// true iff expr is tracked and available before t
+  bool is_available(
+    goto_programt::const_targett t,
+    const exprt &expr) const;
+
+  void output(
+    std::ostream &out,
+    const goto_functiont &goto_function,
+    const namespacet &ns) const;
+
+protected:
+  dirtyt dirty;
+  localst locals;
+  hash_numbering<exprt, irep_hash> expressions;
+
+  // the expressions that read a variable
+  typedef std::unordered_map<irep_idt, dense_bitvectort, irep_id_hash>
+    readerst;
+  readerst readers;
+
+  void build(const goto_functiont &goto_function);
+
+  bool is_tracked(const exprt &expr) const;
+  void collect(const exprt &src, dense_bitvectort &dest);
+  void kill(const exprt &lhs, dense_bitvectort &dest) const;
+};
+
+#endif // CPROVER_ANALYSES_AVAILABLE_EXPRESSIONS_H
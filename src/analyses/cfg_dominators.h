@@ -13,15 +13,22 @@ Author: Georg Weissenbacher, georg@weissenbacher.name
 #define CPROVER_ANALYSES_CFG_DOMINATORS_H
 
 #include <set>
-#include <list>
 #include <map>
 #include <iosfwd>
 #include <cassert>
+#include <limits>
+#include <vector>
 
 #include <goto-programs/goto_functions.h>
 #include <goto-programs/goto_program.h>
 #include <goto-programs/cfg.h>
 
+/// Computes (post-)dominators using the algorithm by Cooper, Harvey and
+/// Kennedy ("A Simple, Fast Dominance Algorithm"). The result is kept as
+/// the immediate dominator of each node together with a pre/post
+/// numbering of the dominator tree, which answers dominance queries in
+/// constant time. The sets of dominators of all nodes are only built if
+/// store_dominator_sets is set, which is the default.
 template <class P, class T, bool post_dom>
 class cfg_dominators_templatet
 {
@@ -34,17 +41,71 @@ public:
   };
 
   typedef procedure_local_cfg_baset<nodet, P, T> cfgt;
+  typedef typename cfgt::node_indext entryt;
   cfgt cfg;
 
+  cfg_dominators_templatet():store_dominator_sets(true)
+  {
+  }
+
+  bool store_dominator_sets;
+
   void operator()(P &program);
 
   T entry_node;
 
   void output(std::ostream &) const;
 
+  /// \return true iff node n is reached from the entry node (for
+  ///   post-dominators: reaches the exit node)
+  bool is_reachable(entryt n) const
+  {
+    return n<idom.size() && idom[n]!=none();
+  }
+
+  /// \return true iff node a (post-)dominates node b
+  bool dominates_node(entryt a, entryt b) const
+  {
+    return is_reachable(a) && is_reachable(b) &&
+           tree_in[a]<=tree_in[b] && tree_out[b]<=tree_out[a];
+  }
+
+  /// \return true iff a (post-)dominates b
+  bool dominates(const T &a, const T &b) const
+  {
+    typename cfgt::entry_mapt::const_iterator a_it=cfg.entry_map.find(a);
+    typename cfgt::entry_mapt::const_iterator b_it=cfg.entry_map.find(b);
+    return a_it!=cfg.entry_map.end() &&
+           b_it!=cfg.entry_map.end() &&
+           dominates_node(a_it->second, b_it->second);
+  }
+
+  /// \return true iff n is reachable and not the entry node
+  bool has_immediate_dominator(entryt n) const
+  {
+    return is_reachable(n) && idom[n]!=n;
+  }
+
+  entryt immediate_dominator(entryt n) const
+  {
+    assert(has_immediate_dominator(n));
+    return idom[n];
+  }
+
 protected:
+  // indexed by node, none() for unreachable nodes, and the
+  // entry node is its own immediate dominator
+  std::vector<entryt> idom;
+  std::vector<std::size_t> tree_in, tree_out;
+
+  static entryt none()
+  {
+    return std::numeric_limits<entryt>::max();
+  }
+
   void initialise(P &program);
   void fixedpoint(P &program);
+  void number_tree(entryt root);
 };
 
 /// Print the result of the dominator computation
@@ -72,11 +133,13 @@ void cfg_dominators_templatet<P, T, post_dom>::initialise(P &program)
   cfg(program);
 }
 
-/// Computes the MOP for the dominator analysis
+/// Computes the immediate dominators
 template <class P, class T, bool post_dom>
 void cfg_dominators_templatet<P, T, post_dom>::fixedpoint(P &program)
 {
-  std::list<T> worklist;
+  idom.assign(cfg.size(), none());
+  tree_in.assign(cfg.size(), 0);
+  tree_out.assign(cfg.size(), 0);
 
   if(cfg.nodes_empty(program))
     return;
@@ -85,85 +148,141 @@ void cfg_dominators_templatet<P, T, post_dom>::fixedpoint(P &program)
     entry_node=cfg.get_last_node(program);
   else
     entry_node=cfg.get_first_node(program);
-  typename cfgt::nodet &n=cfg[cfg.entry_map[entry_node]];
-  n.dominators.insert(entry_node);
-
-  for(typename cfgt::edgest::const_iterator
-      s_it=(post_dom?n.in:n.out).begin();
-      s_it!=(post_dom?n.in:n.out).end();
-      ++s_it)
-    worklist.push_back(cfg[s_it->first].PC);
+  const entryt entry=cfg.entry_map[entry_node];
 
-  while(!worklist.empty())
+  // postorder by iterative depth-first search from the entry
+  std::vector<entryt> postorder;
+  std::vector<std::size_t> postorder_number(cfg.size(), 0);
   {
-    // get node from worklist
-    T current=worklist.front();
-    worklist.pop_front();
+    typedef typename cfgt::edgest::const_iterator edge_itt;
+    std::vector<bool> visited(cfg.size(), false);
+    std::vector<std::pair<entryt, edge_itt> > stack;
 
-    bool changed=false;
-    typename cfgt::nodet &node=cfg[cfg.entry_map[current]];
-    if(node.dominators.empty())
+    const typename cfgt::nodet &e=cfg[entry];
+    stack.push_back(std::make_pair(entry, (post_dom?e.in:e.out).begin()));
+    visited[entry]=true;
+
+    while(!stack.empty())
     {
-      for(const auto &edge : (post_dom ? node.out : node.in))
-        if(!cfg[edge.first].dominators.empty())
+      const entryt current=stack.back().first;
+      const typename cfgt::edgest &successors=
+        post_dom?cfg[current].in:cfg[current].out;
+
+      if(stack.back().second!=successors.end())
+      {
+        const entryt s=(stack.back().second++)->first;
+        if(!visited[s])
         {
-          node.dominators=cfg[edge.first].dominators;
-          node.dominators.insert(current);
-          changed=true;
+          visited[s]=true;
+          const typename cfgt::nodet &n=cfg[s];
+          stack.push_back(std::make_pair(s, (post_dom?n.in:n.out).begin()));
         }
+      }
+      else
+      {
+        postorder_number[current]=postorder.size();
+        postorder.push_back(current);
+        stack.pop_back();
+      }
     }
+  }
 
-    // compute intersection of predecessors
-    for(const auto &edge : (post_dom ? node.out : node.in))
-    {
-      const target_sett &other=cfg[edge.first].dominators;
-      if(other.empty())
-        continue;
+  idom[entry]=entry;
+
+  bool changed=true;
+  while(changed)
+  {
+    changed=false;
 
-      typename target_sett::const_iterator n_it=node.dominators.begin();
-      typename target_sett::const_iterator o_it=other.begin();
+    // reverse postorder, skipping the entry
+    for(std::size_t i=postorder.size()-1; i>0; i--)
+    {
+      const entryt current=postorder[i-1];
+      entryt new_idom=none();
 
-      // in-place intersection. not safe to use set_intersect
-      while(n_it!=node.dominators.end() && o_it!=other.end())
+      for(const auto &edge : (post_dom?cfg[current].out:cfg[current].in))
       {
-        if(*n_it==current)
-          ++n_it;
-        else if(*n_it<*o_it)
+        entryt p=edge.first;
+        if(idom[p]==none())
+          continue;
+
+        if(new_idom==none())
         {
-          changed=true;
-          node.dominators.erase(n_it++);
+          new_idom=p;
+          continue;
         }
-        else if(*o_it<*n_it)
-          ++o_it;
-        else
+
+        // walk up to the common ancestor in the dominator tree
+        entryt q=new_idom;
+        while(p!=q)
         {
-          ++n_it;
-          ++o_it;
+          while(postorder_number[p]<postorder_number[q])
+            p=idom[p];
+          while(postorder_number[q]<postorder_number[p])
+            q=idom[q];
         }
+        new_idom=p;
       }
 
-      while(n_it!=node.dominators.end())
+      if(idom[current]!=new_idom)
       {
-        if(*n_it==current)
-          ++n_it;
-        else
-        {
-          changed=true;
-          node.dominators.erase(n_it++);
-        }
+        idom[current]=new_idom;
+        changed=true;
       }
     }
+  }
+
+  number_tree(entry);
 
-    if(changed) // fixed point for node reached?
+  if(store_dominator_sets)
+  {
+    for(const auto n : postorder)
     {
-      for(const auto &edge : (post_dom ? node.in : node.out))
+      target_sett &dominators=cfg[n].dominators;
+      dominators.clear();
+
+      for(entryt d=n; ; d=idom[d])
       {
-        worklist.push_back(cfg[edge.first].PC);
+        dominators.insert(cfg[d].PC);
+        if(idom[d]==d)
+          break;
       }
     }
   }
 }
 
+/// Numbers the dominator tree in pre- and postorder
+template <class P, class T, bool post_dom>
+void cfg_dominators_templatet<P, T, post_dom>::number_tree(entryt root)
+{
+  std::vector<std::vector<entryt> > children(cfg.size());
+  for(entryt n=0; n<idom.size(); n++)
+    if(idom[n]!=none() && idom[n]!=n)
+      children[idom[n]].push_back(n);
+
+  std::size_t counter=0;
+  std::vector<std::pair<entryt, std::size_t> > stack;
+  stack.push_back(std::make_pair(root, 0));
+  tree_in[root]=counter++;
+
+  while(!stack.empty())
+  {
+    const entryt current=stack.back().first;
+
+    if(stack.back().second<children[current].size())
+    {
+      const entryt c=children[current][stack.back().second++];
+      tree_in[c]=counter++;
+      stack.push_back(std::make_pair(c, 0));
+    }
+    else
+    {
+      tree_out[current]=counter++;
+      stack.pop_back();
+    }
+  }
+}
+
 /// Pretty-print a single node in the dominator tree. Supply a specialisation if
 /// operator<< is not sufficient.
 /// \par parameters: `node` to print and stream `out` to pretty-print it to
@@ -193,8 +312,17 @@ void cfg_dominators_templatet<P, T, post_dom>::output(std::ostream &out) const
       out << " post-dominated by ";
     else
       out << " dominated by ";
+    target_sett dominators;
+    if(is_reachable(node.second))
+      for(entryt d=node.second; ; d=idom[d])
+      {
+        dominators.insert(cfg[d].PC);
+        if(idom[d]==d)
+          break;
+      }
+
     bool first=true;
-    for(const auto &d : cfg[node.second].dominators)
+    for(const auto &d : dominators)
     {
       if(!first)
         out << ", ";
@@ -0,0 +1,191 @@
+/*******************************************************************\
+
+Module: Dense Bit Vectors for Dataflow Analyses
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Dense Bit Vectors for Dataflow Analyses
+
+#ifndef CPROVER_ANALYSES_DENSE_BITVECTOR_H
+#define CPROVER_ANALYSES_DENSE_BITVECTOR_H
+
+#include <cstddef>
+#include <vector>
+
+/// A set of small integers, stored as a vector of machine words. The set
+/// operations work on a whole word at a time, and the loops are simple
+/// enough for the compiler to vectorise them.
+class dense_bitvectort
+{
+public:
+  typedef std::size_t wordt;
+  static const std::size_t word_bits=sizeof(wordt)*8;
+
+  /// \return true iff the element is new
+  bool insert(std::size_t i)
+  {
+    const std::size_t w=i/word_bits;
+    const wordt mask=wordt(1)<<(i%word_bits);
+
+    if(w>=words.size())
+      words.resize(w+1, 0);
+    else if((words[w]&mask)!=0)
+      return false;
+
+    words[w]|=mask;
+    return true;
+  }
+
+  /// \return true iff the element was present
+  bool erase(std::size_t i)
+  {
+    const std::size_t w=i/word_bits;
+    const wordt mask=wordt(1)<<(i%word_bits);
+
+    if(w>=words.size() || (words[w]&mask)==0)
+      return false;
+
+    words[w]&=~mask;
+    return true;
+  }
+
+  bool contains(std::size_t i) const
+  {
+    const std::size_t w=i/word_bits;
+    return w<words.size() &&
+           (words[w]&(wordt(1)<<(i%word_bits)))!=0;
+  }
+
+  bool empty() const
+  {
+    for(const auto w : words)
+      if(w!=0)
+        return false;
+    return true;
+  }
+
+  std::size_t count() const
+  {
+    std::size_t result=0;
+    for(wordt w : words)
+      for(; w!=0; w&=w-1)
+        result++;
+    return result;
+  }
+
+  void clear()
+  {
+    words.clear();
+  }
+
+  void swap(dense_bitvectort &other)
+  {
+    words.swap(other.words);
+  }
+
+  /// make the set {0, ..., n-1}
+  void fill(std::size_t n)
+  {
+    words.assign(n/word_bits, ~wordt(0));
+    if(n%word_bits!=0)
+      words.push_back((wordt(1)<<(n%word_bits))-1);
+  }
+
+  /// \return true iff there is something new
+  bool union_with(const dense_bitvectort &other)
+  {
+    if(words.size()<other.words.size())
+      words.resize(other.words.size(), 0);
+
+    wordt changed=0;
+    for(std::size_t i=0; i<other.words.size(); i++)
+    {
+      changed|=other.words[i]&~words[i];
+      words[i]|=other.words[i];
+    }
+
+    return changed!=0;
+  }
+
+  /// \return true iff an element was removed
+  bool intersect_with(const dense_bitvectort &other)
+  {
+    const std::size_t common=
+      words.size()<other.words.size()?words.size():other.words.size();
+
+    wordt changed=0;
+    for(std::size_t i=0; i<common; i++)
+    {
+      changed|=words[i]&~other.words[i];
+      words[i]&=other.words[i];
+    }
+
+    for(std::size_t i=common; i<words.size(); i++)
+      changed|=words[i];
+    words.resize(common);
+
+    return changed!=0;
+  }
+
+  /// remove all elements of other
+  void subtract(const dense_bitvectort &other)
+  {
+    const std::size_t common=
+      words.size()<other.words.size()?words.size():other.words.size();
+
+    for(std::size_t i=0; i<common; i++)
+      words[i]&=~other.words[i];
+  }
+
+  /// call f(i) for every element i, in increasing order
+  template<typename F>
+  void for_each(F f) const
+  {
+    for(std::size_t w=0; w<words.size(); w++)
+      for(wordt bits=words[w]; bits!=0; bits&=bits-1)
+        f(w*word_bits+lowest_bit(bits));
+  }
+
+  bool operator==(const dense_bitvectort &other) const
+  {
+    const dense_bitvectort &longer=
+      words.size()<other.words.size()?other:*this;
+    const dense_bitvectort &shorter=
+      words.size()<other.words.size()?*this:other;
+
+    for(std::size_t i=0; i<shorter.words.size(); i++)
+      if(shorter.words[i]!=longer.words[i])
+        return false;
+
+    for(std::size_t i=shorter.words.size(); i<longer.words.size(); i++)
+      if(longer.words[i]!=0)
+        return false;
+
+    return true;
+  }
+
+  bool operator!=(const dense_bitvectort &other) const
+  {
+    return !(*this==other);
+  }
+
+protected:
+  std::vector<wordt> words;
+
+  static std::size_t lowest_bit(wordt bits)
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(bits);
+#else
+    std::size_t result=0;
+    for(; (bits&1)==0; bits>>=1)
+      result++;
+    return result;
+#endif
+  }
+};
+
+#endif // CPROVER_ANALYSES_DENSE_BITVECTOR_H
@@ -79,6 +79,12 @@ void dep_graph_domaint::control_dependencies(
   const irep_idt id=goto_programt::get_function_id(from);
   const cfg_post_dominatorst &pd=dep_graph.cfg_post_dominators().at(id);
 
+  // on the edge into a callee, 'to' is in a different function and
+  // post-dominates none of the candidates
+  cfg_post_dominatorst::cfgt::entry_mapt::const_iterator to_entry=
+    pd.cfg.entry_map.find(to);
+  const bool to_in_function=to_entry!=pd.cfg.entry_map.end();
+
   // check all candidates for M
   for(depst::iterator
       it=control_deps.begin();
@@ -105,10 +111,8 @@ void dep_graph_domaint::control_dependencies(
 
     for(const auto &edge : m.out)
     {
-      const cfg_post_dominatorst::cfgt::nodet &m_s=
-        pd.cfg[edge.first];
-
-      if(m_s.dominators.find(to)!=m_s.dominators.end())
+      if(to_in_function &&
+         pd.dominates_node(to_entry->second, edge.first))
         post_dom_one=true;
       else
         post_dom_all=false;
@@ -177,6 +177,8 @@ public:
     {
       const irep_idt id=goto_programt::get_function_id(goto_program);
       cfg_post_dominatorst &pd=post_dominators[id];
+      // only dominance queries are needed
+      pd.store_dominator_sets=false;
       pd(goto_program);
     }
   }
@@ -0,0 +1,149 @@
+/*******************************************************************\
+
+Module: Intraprocedural Gen/Kill Dataflow Analyses
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Intraprocedural Gen/Kill Dataflow Analyses
+
+#include "gen_kill_analysis.h"
+
+#include <algorithm>
+
+std::vector<gen_kill_analysist::node_nrt>
+gen_kill_analysist::visit_order() const
+{
+  std::vector<node_nrt> order;
+  order.reserve(cfg.nodes.size());
+
+  if(cfg.nodes.empty())
+    return order;
+
+  // iterative depth-first search from the entry, recording postorder
+  std::vector<bool> visited(cfg.nodes.size(), false);
+  std::vector<std::pair<node_nrt, std::size_t> > stack;
+
+  stack.push_back(std::make_pair(0, 0));
+  visited[0]=true;
+
+  while(!stack.empty())
+  {
+    const node_nrt n=stack.back().first;
+    const local_cfgt::successorst &successors=cfg.nodes[n].successors;
+
+    if(stack.back().second<successors.size())
+    {
+      const node_nrt s=successors[stack.back().second++];
+      if(s<cfg.nodes.size() && !visited[s])
+      {
+        visited[s]=true;
+        stack.push_back(std::make_pair(s, 0));
+      }
+    }
+    else
+    {
+      order.push_back(n);
+      stack.pop_back();
+    }
+  }
+
+  // unreachable locations are visited last
+  for(node_nrt n=0; n<cfg.nodes.size(); n++)
+    if(!visited[n])
+      order.insert(order.begin(), n);
+
+  if(direction==directiont::FORWARD)
+    std::reverse(order.begin(), order.end());
+
+  return order;
+}
+
+void gen_kill_analysist::solve(std::size_t number_of_facts)
+{
+  if(cfg.nodes.empty())
+    return;
+
+  // edges in the direction of the analysis
+  std::vector<std::vector<node_nrt> > sources(cfg.nodes.size());
+
+  for(node_nrt n=0; n<cfg.nodes.size(); n++)
+    for(const auto &s : cfg.nodes[n].successors)
+    {
+      if(s>=cfg.nodes.size())
+        continue;
+
+      if(direction==directiont::FORWARD)
+        sources[s].push_back(n);
+      else
+        sources[n].push_back(s);
+    }
+
+  // Locations without a source are boundary locations and start from
+  // the empty set. All others start from the top of the lattice.
+  dense_bitvectort top;
+  if(meet==meett::INTERSECTION)
+    top.fill(number_of_facts);
+
+  for(node_nrt n=0; n<cfg.nodes.size(); n++)
+  {
+    loc_infot &loc_info=loc_infos[n];
+    dense_bitvectort &after=
+      direction==directiont::FORWARD?loc_info.out:loc_info.in;
+    after=top;
+  }
+
+  const std::vector<node_nrt> order=visit_order();
+
+  bool changed=true;
+
+  while(changed)
+  {
+    changed=false;
+
+    for(const auto n : order)
+    {
+      iterations++;
+
+      loc_infot &loc_info=loc_infos[n];
+      dense_bitvectort &before=
+        direction==directiont::FORWARD?loc_info.in:loc_info.out;
+      dense_bitvectort &after=
+        direction==directiont::FORWARD?loc_info.out:loc_info.in;
+
+      // the entry of a forward problem has an implicit source that
+      // contributes the empty set, as have locations without a source
+      bool first=direction==directiont::BACKWARD || n!=0;
+      before.clear();
+
+      for(const auto s : sources[n])
+      {
+        const dense_bitvectort &source=
+          direction==directiont::FORWARD?
+            loc_infos[s].out:loc_infos[s].in;
+
+        if(first)
+        {
+          before=source;
+          first=false;
+        }
+        else if(meet==meett::UNION)
+          before.union_with(source);
+        else
+          before.intersect_with(source);
+      }
+
+      dense_bitvectort new_after=before;
+      new_after.subtract(loc_info.kill);
+      new_after.union_with(loc_info.gen);
+
+      if(new_after!=after)
+      {
+        after.swap(new_after);
+        changed=true;
+      }
+    }
+  }
+}
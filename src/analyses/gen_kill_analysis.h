@@ -0,0 +1,92 @@
+/*******************************************************************\
+
+Module: Intraprocedural Gen/Kill Dataflow Analyses
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Intraprocedural Gen/Kill Dataflow Analyses
+
+#ifndef CPROVER_ANALYSES_GEN_KILL_ANALYSIS_H
+#define CPROVER_ANALYSES_GEN_KILL_ANALYSIS_H
+
+#include "dense_bitvector.h"
+#include "local_cfg.h"
+
+/// Solver for the classic bit-vector problems over the body of a single
+/// function. Derived classes number the facts they track, fill in the
+/// gen and kill sets of each location and call solve(). The transfer
+/// function of every location is out=gen|(in&~kill), where 'in' and
+/// 'out' are swapped for backward problems.
+class gen_kill_analysist
+{
+public:
+  typedef goto_functionst::goto_functiont goto_functiont;
+  typedef local_cfgt::node_nrt node_nrt;
+
+  enum class directiont { FORWARD, BACKWARD };
+  enum class meett { UNION, INTERSECTION };
+
+  /// facts that hold before the instruction is executed
+  const dense_bitvectort &get_in(goto_programt::const_targett t) const
+  {
+    return loc_infos[get_node(t)].in;
+  }
+
+  /// facts that hold after the instruction is executed
+  const dense_bitvectort &get_out(goto_programt::const_targett t) const
+  {
+    return loc_infos[get_node(t)].out;
+  }
+
+  /// number of locations visited until the fixed point was reached
+  std::size_t get_iterations() const
+  {
+    return iterations;
+  }
+
+protected:
+  gen_kill_analysist(
+    const goto_functiont &goto_function,
+    directiont _direction,
+    meett _meet):
+    cfg(goto_function.body),
+    direction(_direction),
+    meet(_meet),
+    iterations(0)
+  {
+    loc_infos.resize(cfg.nodes.size());
+  }
+
+  local_cfgt cfg;
+  const directiont direction;
+  const meett meet;
+  std::size_t iterations;
+
+  struct loc_infot
+  {
+    dense_bitvectort gen, kill, in, out;
+  };
+
+  typedef std::vector<loc_infot> loc_infost;
+  loc_infost loc_infos;
+
+  node_nrt get_node(goto_programt::const_targett t) const
+  {
+    local_cfgt::loc_mapt::const_iterator entry=cfg.loc_map.find(t);
+    assert(entry!=cfg.loc_map.end());
+    return entry->second;
+  }
+
+  /// computes the fixed point; number_of_facts is the size of the
+  /// universe, which is needed for problems that use intersection
+  void solve(std::size_t number_of_facts);
+
+  /// the order in which locations are visited: reverse postorder for
+  /// forward problems and postorder for backward problems
+  std::vector<node_nrt> visit_order() const;
+};
+
+#endif // CPROVER_ANALYSES_GEN_KILL_ANALYSIS_H
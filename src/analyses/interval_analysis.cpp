@@ -80,7 +80,7 @@ void interval_analysis(
   const namespacet &ns,
   goto_functionst &goto_functions)
 {
-  ait<interval_domaint> interval_analysis;
+  interval_ait interval_analysis;
 
   interval_analysis(goto_functions, ns);
 
@@ -176,10 +176,254 @@ bool interval_domaint::join(
   return result;
 }
 
+/// Joins b into *this, but bounds that have grown are moved to the next
+/// threshold, or dropped if there is none. This guarantees termination
+/// of the analysis of loops.
+/// \param b: the interval domain to join with
+/// \param thresholds: the candidate bounds
+/// \return True if *this has changed.
+bool interval_domaint::widen(
+  const interval_domaint &b,
+  const thresholdst &thresholds)
+{
+  if(bottom)
+    return join(b);
+
+  const int_mapt old_int_map=int_map;
+  const float_mapt old_float_map=float_map;
+
+  if(!join(b))
+    return false;
+
+  // join only removes variables, hence all remaining ones are in the
+  // old maps
+  for(auto &interval : int_map)
+  {
+    const int_mapt::const_iterator old=old_int_map.find(interval.first);
+    if(old==old_int_map.end())
+      continue;
+
+    integer_intervalt &i=interval.second;
+
+    if(i.lower_set && i.lower<old->second.lower)
+    {
+      thresholdst::const_iterator t=thresholds.upper_bound(i.lower);
+      if(t==thresholds.begin())
+        i.lower_set=false;
+      else
+        i.lower=*(--t);
+    }
+
+    if(i.upper_set && i.upper>old->second.upper)
+    {
+      thresholdst::const_iterator t=thresholds.lower_bound(i.upper);
+      if(t==thresholds.end())
+        i.upper_set=false;
+      else
+        i.upper=*t;
+    }
+  }
+
+  for(auto &interval : float_map)
+  {
+    const float_mapt::const_iterator old=old_float_map.find(interval.first);
+    if(old==old_float_map.end())
+      continue;
+
+    ieee_float_intervalt &i=interval.second;
+
+    if(i.lower_set && i.lower<old->second.lower)
+      i.lower_set=false;
+
+    if(i.upper_set && i.upper>old->second.upper)
+      i.upper_set=false;
+  }
+
+  return true;
+}
+
+/// Refines the bounds of *this that are not set with those of b, which
+/// is expected to be included in *this.
+/// \param b: the interval domain to narrow with
+/// \return True if *this has changed.
+bool interval_domaint::narrow(const interval_domaint &b)
+{
+  if(bottom)
+    return false;
+
+  if(b.bottom)
+  {
+    make_bottom();
+    return true;
+  }
+
+  bool result=false;
+
+  for(const auto &interval : b.int_map)
+  {
+    integer_intervalt &i=int_map[interval.first];
+    const integer_intervalt previous=i;
+    i.narrow(interval.second);
+    if(i!=previous)
+      result=true;
+  }
+
+  for(const auto &interval : b.float_map)
+  {
+    ieee_float_intervalt &i=float_map[interval.first];
+    const ieee_float_intervalt previous=i;
+    i.narrow(interval.second);
+    if(i!=previous)
+      result=true;
+  }
+
+  return result;
+}
+
 void interval_domaint::assign(const code_assignt &code_assign)
 {
-  havoc_rec(code_assign.lhs());
-  assume_rec(code_assign.lhs(), ID_equal, code_assign.rhs());
+  const exprt &lhs=code_assign.lhs();
+  const exprt &rhs=code_assign.rhs();
+
+  if(lhs.id()==ID_symbol && is_int(lhs.type()) && is_int(rhs.type()))
+  {
+    // evaluate before the lhs is havocked, as it may occur in rhs
+    integer_intervalt rhs_interval=get_int_rec(rhs);
+    clamp(rhs_interval, lhs.type());
+
+    havoc_rec(lhs);
+
+    if(!rhs_interval.is_top())
+      int_map[to_symbol_expr(lhs).get_identifier()]=rhs_interval;
+  }
+  else
+  {
+    havoc_rec(lhs);
+    assume_rec(lhs, ID_equal, rhs);
+  }
+}
+
+/// Drops the bounds of an interval if it is not contained in the range of
+/// the given bit-vector type, as the value may have wrapped around.
+void interval_domaint::clamp(integer_intervalt &interval, const typet &type)
+{
+  mp_integer smallest, largest;
+
+  if(type.id()==ID_signedbv)
+  {
+    smallest=to_signedbv_type(type).smallest();
+    largest=to_signedbv_type(type).largest();
+  }
+  else if(type.id()==ID_unsignedbv)
+  {
+    smallest=to_unsignedbv_type(type).smallest();
+    largest=to_unsignedbv_type(type).largest();
+  }
+  else
+  {
+    interval=integer_intervalt();
+    return;
+  }
+
+  if(!interval.lower_set || !interval.upper_set ||
+     interval.lower<smallest || interval.upper>largest)
+    interval=integer_intervalt();
+}
+
+/// Evaluates an integer expression over the intervals of the variables,
+/// for constants, symbols, typecasts, additions, subtractions and
+/// multiplications by constants. The result is top for anything else.
+integer_intervalt interval_domaint::get_int_rec(const exprt &expr)
+{
+  if(expr.id()==ID_constant)
+  {
+    mp_integer value;
+    if(!to_integer(expr, value))
+      return integer_intervalt(value);
+  }
+  else if(expr.id()==ID_symbol)
+  {
+    int_mapt::const_iterator it=
+      int_map.find(to_symbol_expr(expr).get_identifier());
+    if(it!=int_map.end())
+      return it->second;
+  }
+  else if(expr.id()==ID_typecast)
+  {
+    const exprt &op=to_typecast_expr(expr).op();
+    if(is_int(op.type()))
+    {
+      integer_intervalt result=get_int_rec(op);
+      clamp(result, expr.type());
+      return result;
+    }
+  }
+  else if(expr.id()==ID_unary_minus)
+  {
+    integer_intervalt op=get_int_rec(to_unary_minus_expr(expr).op());
+    integer_intervalt result;
+    result.lower_set=op.upper_set;
+    result.lower=-op.upper;
+    result.upper_set=op.lower_set;
+    result.upper=-op.lower;
+    return result;
+  }
+  else if(expr.id()==ID_plus)
+  {
+    integer_intervalt result(0);
+
+    forall_operands(it, expr)
+    {
+      integer_intervalt op=get_int_rec(*it);
+      result.lower_set=result.lower_set && op.lower_set;
+      result.lower+=op.lower;
+      result.upper_set=result.upper_set && op.upper_set;
+      result.upper+=op.upper;
+    }
+
+    return result;
+  }
+  else if(expr.id()==ID_minus && expr.operands().size()==2)
+  {
+    integer_intervalt op0=get_int_rec(expr.op0());
+    integer_intervalt op1=get_int_rec(expr.op1());
+    integer_intervalt result;
+    result.lower_set=op0.lower_set && op1.upper_set;
+    result.lower=op0.lower-op1.upper;
+    result.upper_set=op0.upper_set && op1.lower_set;
+    result.upper=op0.upper-op1.lower;
+    return result;
+  }
+  else if(expr.id()==ID_mult && expr.operands().size()==2)
+  {
+    integer_intervalt op0=get_int_rec(expr.op0());
+    integer_intervalt op1=get_int_rec(expr.op1());
+
+    if(op0.singleton())
+      std::swap(op0, op1);
+
+    if(op1.singleton())
+    {
+      const mp_integer &factor=op1.lower;
+      integer_intervalt result;
+      result.lower_set=op0.lower_set;
+      result.lower=op0.lower*factor;
+      result.upper_set=op0.upper_set;
+      result.upper=op0.upper*factor;
+
+      if(factor<0)
+      {
+        std::swap(result.lower_set, result.upper_set);
+        std::swap(result.lower, result.upper);
+      }
+      else if(factor==0)
+        return integer_intervalt(0);
+
+      return result;
+    }
+  }
+
+  return integer_intervalt();
 }
 
 void interval_domaint::havoc_rec(const exprt &lhs)
@@ -487,3 +731,256 @@ bool interval_domaint::ai_simplify(
 
   return unchanged;
 }
+
+/// Stores the intervals as an irept, for use in function summaries.
+/// Top intervals are not stored.
+/// \param dest: the irept to store the domain in
+/// \return False, as the domain supports this.
+bool interval_domaint::to_irep(irept &dest) const
+{
+  dest=irept(bottom?"bottom":"intervals");
+
+  if(bottom)
+    return false;
+
+  irept::subt &ints=dest.add("int").get_sub();
+  for(const auto &interval : int_map)
+  {
+    if(interval.second.is_top())
+      continue;
+    ints.push_back(irept(interval.first));
+    if(interval.second.lower_set)
+      ints.back().set("lower", integer2string(interval.second.lower));
+    if(interval.second.upper_set)
+      ints.back().set("upper", integer2string(interval.second.upper));
+  }
+
+  irept::subt &floats=dest.add("float").get_sub();
+  for(const auto &interval : float_map)
+  {
+    if(interval.second.is_top())
+      continue;
+    floats.push_back(irept(interval.first));
+    if(interval.second.lower_set)
+      floats.back().add("lower")=interval.second.lower.to_expr();
+    if(interval.second.upper_set)
+      floats.back().add("upper")=interval.second.upper.to_expr();
+  }
+
+  return false;
+}
+
+/// Restores the intervals from an irept produced by to_irep.
+/// \param src: the irept to read the domain from
+/// \return True if src is not a valid interval domain.
+bool interval_domaint::from_irep(const irept &src)
+{
+  int_map.clear();
+  float_map.clear();
+
+  if(src.id()=="bottom")
+  {
+    bottom=true;
+    return false;
+  }
+
+  if(src.id()!="intervals")
+    return true;
+
+  bottom=false;
+
+  forall_irep(it, src.find("int").get_sub())
+  {
+    integer_intervalt &interval=int_map[it->id()];
+    const irep_idt &lower=it->get("lower");
+    const irep_idt &upper=it->get("upper");
+    if(!lower.empty())
+      interval.make_ge_than(string2integer(id2string(lower)));
+    if(!upper.empty())
+      interval.make_le_than(string2integer(id2string(upper)));
+  }
+
+  forall_irep(it, src.find("float").get_sub())
+  {
+    ieee_float_intervalt &interval=float_map[it->id()];
+    const irept &lower=it->find("lower");
+    const irept &upper=it->find("upper");
+    if(lower.is_not_nil())
+    {
+      ieee_floatt tmp;
+      tmp.from_expr(to_constant_expr(static_cast<const exprt &>(lower)));
+      interval.make_ge_than(tmp);
+    }
+    if(upper.is_not_nil())
+    {
+      ieee_floatt tmp;
+      tmp.from_expr(to_constant_expr(static_cast<const exprt &>(upper)));
+      interval.make_le_than(tmp);
+    }
+  }
+
+  return false;
+}
+
+class threshold_collectort:public const_expr_visitort
+{
+public:
+  explicit threshold_collectort(interval_domaint::thresholdst &_thresholds):
+    thresholds(_thresholds)
+  {
+  }
+
+  void operator()(const exprt &expr) override
+  {
+    mp_integer value;
+
+    if(expr.id()==ID_constant &&
+       interval_domaint::is_int(expr.type()) &&
+       !to_integer(expr, value))
+    {
+      // to also capture the bounds of i<c and i<=c
+      thresholds.insert(value-1);
+      thresholds.insert(value);
+      thresholds.insert(value+1);
+    }
+  }
+
+protected:
+  interval_domaint::thresholdst &thresholds;
+};
+
+void interval_ait::initialize(const goto_programt &goto_program)
+{
+  ait<interval_domaint>::initialize(goto_program);
+
+  if(!widening || !widening_thresholds)
+    return;
+
+  threshold_collectort threshold_collector(thresholds);
+
+  forall_goto_program_instructions(i_it, goto_program)
+  {
+    i_it->code.visit(threshold_collector);
+    i_it->guard.visit(threshold_collector);
+  }
+}
+
+/// A location is a widening point if it is the target of a backwards
+/// edge.
+bool interval_ait::is_widening_point(locationt l)
+{
+  for(const auto &from : l->incoming_edges)
+    if(from->location_number>=l->location_number)
+      return true;
+
+  return false;
+}
+
+bool interval_ait::merge(const statet &src, locationt from, locationt to)
+{
+  interval_domaint &dest=static_cast<interval_domaint &>(get_state(to));
+  const interval_domaint &b=static_cast<const interval_domaint &>(src);
+
+  std::size_t &count=iteration_counts[to];
+
+  const bool over_budget=iteration_budget!=0 && count>=iteration_budget;
+
+  bool changed;
+
+  if((over_budget || (widening && count>=widening_delay)) &&
+     is_widening_point(to))
+  {
+    static const interval_domaint::thresholdst no_thresholds;
+
+    changed=dest.widen(b, over_budget?no_thresholds:thresholds);
+
+    if(changed)
+      widenings++;
+  }
+  else
+    changed=dest.merge(b, from, to);
+
+  if(changed)
+    count++;
+
+  return changed;
+}
+
+void interval_ait::fixedpoint(
+  const goto_functionst &goto_functions,
+  const namespacet &ns)
+{
+  ait<interval_domaint>::fixedpoint(goto_functions, ns);
+
+  if(widenings==0)
+    return;
+
+  for(unsigned round=0; round<narrowing_rounds; round++)
+  {
+    bool changed=false;
+
+    forall_goto_functions(f_it, goto_functions)
+      if(narrow(f_it->second.body, ns))
+        changed=true;
+
+    if(!changed)
+      break;
+  }
+}
+
+/// One round of narrowing: the state at each location is recomputed from
+/// the states of its predecessors. The heads of functions and the
+/// locations following function calls are left unchanged.
+/// \return True if any state has changed.
+bool interval_ait::narrow(
+  const goto_programt &goto_program,
+  const namespacet &ns)
+{
+  bool changed=false;
+
+  forall_goto_program_instructions(l, goto_program)
+  {
+    if(l==goto_program.instructions.begin() ||
+       l->incoming_edges.empty())
+      continue;
+
+    interval_domaint new_state;
+    bool skip=false;
+
+    for(const auto &from : l->incoming_edges)
+    {
+      if(from->is_function_call())
+      {
+        skip=true;
+        break;
+      }
+
+      interval_domaint tmp=(*this)[from];
+      tmp.transform(from, l, *this, ns);
+      new_state.merge(tmp, from, l);
+    }
+
+    if(skip)
+      continue;
+
+    interval_domaint &state=(*this)[l];
+
+    if(is_widening_point(l))
+    {
+      if(state.narrow(new_state))
+        changed=true;
+    }
+    else
+    {
+      // new_state is included in state; replace if it is smaller
+      interval_domaint tmp=new_state;
+      if(tmp.merge(state, l, l))
+      {
+        state=new_state;
+        changed=true;
+      }
+    }
+  }
+
+  return changed;
+}
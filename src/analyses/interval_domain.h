@@ -12,6 +12,8 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef CPROVER_ANALYSES_INTERVAL_DOMAIN_H
 #define CPROVER_ANALYSES_INTERVAL_DOMAIN_H
 
+#include <set>
+
 #include <util/ieee_float.h>
 #include <util/mp_arith.h>
 
@@ -55,6 +57,11 @@ public:
     return join(b);
   }
 
+  typedef std::set<mp_integer> thresholdst;
+
+  bool widen(const interval_domaint &b, const thresholdst &thresholds);
+  bool narrow(const interval_domaint &b);
+
   // no states
   void make_bottom() final
   {
@@ -99,6 +106,9 @@ public:
     exprt &condition,
     const namespacet &ns) const override;
 
+  bool to_irep(irept &dest) const override;
+  bool from_irep(const irept &src) override;
+
 protected:
   bool bottom;
 
@@ -114,6 +124,75 @@ protected:
   void assign(const class code_assignt &assignment);
   integer_intervalt get_int_rec(const exprt &);
   ieee_float_intervalt get_float_rec(const exprt &);
+  static void clamp(integer_intervalt &, const typet &);
+};
+
+class interval_ait:public ait<interval_domaint>
+{
+public:
+  interval_ait():
+    widening(true),
+    widening_delay(3),
+    widening_thresholds(true),
+    narrowing_rounds(2),
+    iteration_budget(0),
+    widenings(0)
+  {
+  }
+
+  // Unless disabled, widening is applied at loop heads once their state
+  // has changed widening_delay times. Unless widening_thresholds is false, bounds
+  // are widened to the next constant occurring in the program rather
+  // than to infinity. Widening is followed by narrowing_rounds rounds
+  // of narrowing.
+  bool widening;
+  unsigned widening_delay;
+  bool widening_thresholds;
+  unsigned narrowing_rounds;
+
+  // Once the state at a loop head has changed this often, it is widened
+  // to infinity, even if widening is off; 0 means no limit.
+  unsigned iteration_budget;
+
+  // the number of times the state at each location has changed
+  typedef std::unordered_map<locationt, std::size_t, const_target_hash>
+    iteration_countst;
+
+  const iteration_countst &get_iteration_counts() const
+  {
+    return iteration_counts;
+  }
+
+  std::size_t get_widenings() const
+  {
+    return widenings;
+  }
+
+  void clear() override
+  {
+    thresholds.clear();
+    iteration_counts.clear();
+    widenings=0;
+    ait<interval_domaint>::clear();
+  }
+
+protected:
+  interval_domaint::thresholdst thresholds;
+  iteration_countst iteration_counts;
+  std::size_t widenings;
+
+  using ait<interval_domaint>::initialize;
+  void initialize(const goto_programt &) override;
+
+  bool merge(const statet &src, locationt from, locationt to) override;
+
+  void fixedpoint(
+    const goto_functionst &goto_functions,
+    const namespacet &ns) override;
+
+  bool narrow(const goto_programt &, const namespacet &);
+
+  static bool is_widening_point(locationt);
 };
 
 #endif // CPROVER_ANALYSES_INTERVAL_DOMAIN_H
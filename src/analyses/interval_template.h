@@ -113,6 +113,22 @@ public:
     intersect_with(i);
   }
 
+  // Narrowing: only bounds that are not set are refined
+  void narrow(const interval_templatet<T> &i)
+  {
+    if(!lower_set && i.lower_set)
+    {
+      lower_set=true;
+      lower=i.lower;
+    }
+
+    if(!upper_set && i.upper_set)
+    {
+      upper_set=true;
+      upper=i.upper;
+    }
+  }
+
   void intersect_with(const interval_templatet &i)
   {
     if(i.lower_set)
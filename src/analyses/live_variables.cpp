@@ -0,0 +1,128 @@
+/*******************************************************************\
+
+Module: Live Variables
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Live Variables
+
+#include "live_variables.h"
+
+#include <util/find_symbols.h>
+#include <util/std_code.h>
+
+/// adds the tracked variables read by src to dest
+void live_variablest::uses(const exprt &src, dense_bitvectort &dest)
+{
+  find_symbols_sett symbols;
+  find_symbols(src, symbols);
+
+  for(const auto &identifier : symbols)
+  {
+    numbering<irep_idt>::number_type n;
+    if(!variables.get_number(identifier, n))
+      dest.insert(n);
+  }
+}
+
+void live_variablest::assign(const exprt &lhs, loc_infot &loc_info)
+{
+  numbering<irep_idt>::number_type n;
+
+  if(lhs.id()==ID_symbol &&
+     !variables.get_number(to_symbol_expr(lhs).get_identifier(), n))
+    loc_info.kill.insert(n);
+  else
+  {
+    // partial updates, e.g., of an array element, keep the rest of
+    // the object alive, and the index expressions are read
+    uses(lhs, loc_info.gen);
+  }
+}
+
+void live_variablest::build(const goto_functiont &goto_function)
+{
+  for(const auto &local : locals.locals_map)
+    if(is_tracked(local.first))
+      variables.number(local.first);
+
+  for(node_nrt n=0; n<cfg.nodes.size(); n++)
+  {
+    const goto_programt::instructiont &instruction=*cfg.nodes[n].t;
+    loc_infot &loc_info=loc_infos[n];
+
+    switch(instruction.type)
+    {
+    case ASSIGN:
+      {
+        const code_assignt &code_assign=to_code_assign(instruction.code);
+        assign(code_assign.lhs(), loc_info);
+        uses(code_assign.rhs(), loc_info.gen);
+      }
+      break;
+
+    case DECL:
+      assign(to_code_decl(instruction.code).symbol(), loc_info);
+      break;
+
+    case DEAD:
+      assign(to_code_dead(instruction.code).symbol(), loc_info);
+      break;
+
+    case FUNCTION_CALL:
+      {
+        const code_function_callt &code_function_call=
+          to_code_function_call(instruction.code);
+
+        if(code_function_call.lhs().is_not_nil())
+          assign(code_function_call.lhs(), loc_info);
+
+        uses(code_function_call.function(), loc_info.gen);
+        for(const auto &arg : code_function_call.arguments())
+          uses(arg, loc_info.gen);
+      }
+      break;
+
+    default:
+      uses(instruction.code, loc_info.gen);
+    }
+
+    uses(instruction.guard, loc_info.gen);
+  }
+
+  solve(variables.size());
+}
+
+bool live_variablest::is_live_after(
+  goto_programt::const_targett t,
+  const irep_idt &identifier) const
+{
+  numbering<irep_idt>::number_type n;
+  if(variables.get_number(identifier, n))
+    return false;
+
+  return get_out(t).contains(n);
+}
+
+void live_variablest::output(
+  std::ostream &out,
+  const goto_functiont &goto_function,
+  const namespacet &ns) const
+{
+  forall_goto_program_instructions(i_it, goto_function.body)
+  {
+    out << "**** " << i_it->source_location << "\n";
+
+    get_in(i_it).for_each([&](std::size_t n)
+    {
+      out << "  " << variables[n] << "\n";
+    });
+
+    out << "\n";
+    goto_function.body.output_instruction(ns, "", out, i_it);
+    out << "\n";
+  }
+}
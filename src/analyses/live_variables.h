@@ -0,0 +1,62 @@
+/*******************************************************************\
+
+Module: Live Variables
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Live Variables
+
+#ifndef CPROVER_ANALYSES_LIVE_VARIABLES_H
+#define CPROVER_ANALYSES_LIVE_VARIABLES_H
+
+#include <util/numbering.h>
+
+#include "dirty.h"
+#include "gen_kill_analysis.h"
+#include "locals.h"
+
+/// Backward may-analysis of the local variables whose current value may
+/// be read later in the function. Variables whose address is taken are
+/// not tracked.
+class live_variablest:public gen_kill_analysist
+{
+public:
+  explicit live_variablest(const goto_functiont &goto_function):
+    gen_kill_analysist(
+      goto_function, directiont::BACKWARD, meett::UNION),
+    dirty(goto_function),
+    locals(goto_function)
+  {
+    build(goto_function);
+  }
+
+  /// true iff the variable is tracked and may be read after t
+  bool is_live_after(
+    goto_programt::const_targett t,
+    const irep_idt &identifier) const;
+
+  void output(
+    std::ostream &out,
+    const goto_functiont &goto_function,
+    const namespacet &ns) const;
+
+protected:
+  dirtyt dirty;
+  localst locals;
+  numbering<irep_idt> variables;
+
+  void build(const goto_functiont &goto_function);
+
+  bool is_tracked(const irep_idt &identifier) const
+  {
+    return locals.is_local(identifier) && !dirty(identifier);
+  }
+
+  void uses(const exprt &src, dense_bitvectort &dest);
+  void assign(const exprt &lhs, loc_infot &loc_info);
+};
+
+#endif // CPROVER_ANALYSES_LIVE_VARIABLES_H
@@ -97,15 +97,12 @@ void natural_loops_templatet<P, T>::compute(P &program)
       {
         if(target->location_number<=m_it->location_number)
         {
-          const nodet &node=
-            cfg_dominators.cfg[cfg_dominators.cfg.entry_map[m_it]];
-
 #ifdef DEBUG
           std::cout << "Computing loop for "
                     << m_it->location_number << " -> "
                     << target->location_number << "\n";
 #endif
-          if(node.dominators.find(target)!=node.dominators.end())
+          if(cfg_dominators.dominates(target, m_it))
           {
             compute_natural_loop(m_it, target);
           }
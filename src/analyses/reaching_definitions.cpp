@@ -34,13 +34,13 @@ void rd_range_domaint::populate_cache(const irep_idt &identifier) const
 
   ranges_at_loct &export_entry=export_cache[identifier];
 
-  for(const auto &id : v_entry->second)
+  v_entry->second.for_each([&](std::size_t id)
   {
-    const reaching_definitiont &v=bv_container->get(id);
+    const reaching_definitiont &v=bv_container->get(identifier, id);
 
     export_entry[v.definition_at].insert(
       std::make_pair(v.bit_begin, v.bit_end));
-  }
+  });
 }
 
 void rd_range_domaint::transform(
@@ -238,18 +238,18 @@ void rd_range_domaint::transform_end_function(
        (!ns.lookup(identifier).is_shared() &&
         !rd.get_is_dirty()(identifier)))
     {
-      for(const auto &id : new_value.second)
+      new_value.second.for_each([&](std::size_t id)
       {
-        const reaching_definitiont &v=bv_container->get(id);
+        const reaching_definitiont &v=bv_container->get(identifier, id);
         kill(v.identifier, v.bit_begin, v.bit_end);
-      }
+      });
     }
 
-    for(const auto &id : new_value.second)
+    new_value.second.for_each([&](std::size_t id)
     {
-      const reaching_definitiont &v=bv_container->get(id);
+      const reaching_definitiont &v=bv_container->get(identifier, id);
       gen(v.definition_at, v.identifier, v.bit_begin, v.bit_end);
-    }
+    });
   }
 
   const code_typet &code_type=
@@ -339,44 +339,42 @@ void rd_range_domaint::kill(
   if(entry==values.end())
     return;
 
+  std::vector<std::size_t> old_values;
+  entry->second.for_each([&](std::size_t id)
+  {
+    old_values.push_back(id);
+  });
+
   bool clear_export_cache=false;
   values_innert new_values;
 
-  for(values_innert::iterator
-      it=entry->second.begin();
-      it!=entry->second.end();
-     ) // no ++it
+  for(const auto &id : old_values)
   {
-    const reaching_definitiont &v=bv_container->get(*it);
+    const reaching_definitiont &v=bv_container->get(identifier, id);
 
     if(v.bit_begin >= range_end)
-      ++it;
+      continue;
     else if(v.bit_end!=-1 &&
             v.bit_end <= range_start)
-      ++it;
-    else if(v.bit_begin >= range_start &&
-            v.bit_end!=-1 &&
-            v.bit_end <= range_end) // rs <= a < b <= re
-    {
-      clear_export_cache=true;
+      continue;
 
-      entry->second.erase(it++);
-    }
-    else if(v.bit_begin >= range_start) // rs <= a <= re < b
-    {
-      clear_export_cache=true;
+    clear_export_cache=true;
+    entry->second.erase(id);
+
+    if(v.bit_begin >= range_start &&
+       v.bit_end!=-1 &&
+       v.bit_end <= range_end) // rs <= a < b <= re
+      continue;
 
+    if(v.bit_begin >= range_start) // rs <= a <= re < b
+    {
       reaching_definitiont v_new=v;
       v_new.bit_begin=range_end;
       new_values.insert(bv_container->add(v_new));
-
-      entry->second.erase(it++);
     }
     else if(v.bit_end==-1 ||
             v.bit_end > range_end) // a <= rs < re < b
     {
-      clear_export_cache=true;
-
       reaching_definitiont v_new=v;
       v_new.bit_end=range_start;
 
@@ -385,39 +383,19 @@ void rd_range_domaint::kill(
 
       new_values.insert(bv_container->add(v_new));
       new_values.insert(bv_container->add(v_new2));
-
-      entry->second.erase(it++);
     }
     else // a <= rs < b <= re
     {
-      clear_export_cache=true;
-
       reaching_definitiont v_new=v;
       v_new.bit_end=range_start;
       new_values.insert(bv_container->add(v_new));
-
-      entry->second.erase(it++);
     }
   }
 
   if(clear_export_cache)
     export_cache.erase(identifier);
 
-  values_innert::iterator it=entry->second.begin();
-  for(const auto &id : new_values)
-  {
-    while(it!=entry->second.end() && *it<id)
-      ++it;
-    if(it==entry->second.end() || id<*it)
-    {
-      entry->second.insert(it, id);
-    }
-    else if(it!=entry->second.end())
-    {
-      assert(*it==id);
-      ++it;
-    }
-  }
+  entry->second.union_with(new_values);
 }
 
 void rd_range_domaint::kill_inf(
@@ -475,7 +453,7 @@ bool rd_range_domaint::gen(
   v.bit_begin=range_start;
   v.bit_end=range_end;
 
-  if(!values[identifier].insert(bv_container->add(v)).second)
+  if(!values[identifier].insert(bv_container->add(v)))
     return false;
 
   export_cache.erase(identifier);
@@ -595,22 +573,7 @@ bool rd_range_domaint::merge_inner(
     }
   }
 #else
-  values_innert::iterator itr=dest.begin();
-  for(const auto &id : other)
-  {
-    while(itr!=dest.end() && *itr<id)
-      ++itr;
-    if(itr==dest.end() || id<*itr)
-    {
-      dest.insert(itr, id);
-      more=true;
-    }
-    else if(itr!=dest.end())
-    {
-      assert(*itr==id);
-      ++itr;
-    }
-  }
+  more=dest.union_with(other);
 #endif
 
   return more;
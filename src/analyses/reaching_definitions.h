@@ -20,6 +20,7 @@ Date: February 2013
 #include <util/threeval.h>
 
 #include "ai.h"
+#include "dense_bitvector.h"
 #include "goto_rw.h"
 
 class value_setst;
@@ -28,25 +29,31 @@ class dirtyt;
 class reaching_definitions_analysist;
 
 // requirement: V has a member "identifier" of type irep_idt
+// Values are numbered per identifier, which keeps the numbers small
+// enough to be stored in dense bit vectors.
 template<typename V>
 class sparse_bitvector_analysist
 {
 public:
-  const V &get(const std::size_t value_index) const
+  const V &get(
+    const irep_idt &identifier,
+    const std::size_t value_index) const
   {
-    assert(value_index<values.size());
-    return values[value_index]->first;
+    typename value_mapt::const_iterator entry=value_map.find(identifier);
+    assert(entry!=value_map.end());
+    assert(value_index<entry->second.values.size());
+    return entry->second.values[value_index]->first;
   }
 
   std::size_t add(const V &value)
   {
-    inner_mapt &m=value_map[value.identifier];
+    inner_valuest &v=value_map[value.identifier];
 
     std::pair<typename inner_mapt::iterator, bool> entry=
-      m.insert(std::make_pair(value, values.size()));
+      v.map.insert(std::make_pair(value, v.values.size()));
 
     if(entry.second)
-      values.push_back(entry.first);
+      v.values.push_back(entry.first);
 
     return entry.first->second;
   }
@@ -54,13 +61,20 @@ public:
   void clear()
   {
     value_map.clear();
-    values.clear();
   }
 
 protected:
   typedef typename std::map<V, std::size_t> inner_mapt;
-  std::vector<typename inner_mapt::const_iterator> values;
-  std::unordered_map<irep_idt, inner_mapt, irep_id_hash> value_map;
+
+  struct inner_valuest
+  {
+    inner_mapt map;
+    std::vector<typename inner_mapt::const_iterator> values;
+  };
+
+  typedef std::unordered_map<irep_idt, inner_valuest, irep_id_hash>
+    value_mapt;
+  value_mapt value_map;
 };
 
 struct reaching_definitiont
@@ -175,7 +189,7 @@ private:
 
   sparse_bitvector_analysist<reaching_definitiont> *bv_container;
 
-  typedef std::set<std::size_t> values_innert;
+  typedef dense_bitvectort values_innert;
   #ifdef USE_DSTRING
   typedef std::map<irep_idt, values_innert> valuest;
   #else
@@ -0,0 +1,739 @@
+/*******************************************************************\
+
+Module: Sparse Constant Propagation
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Sparse Constant Propagation
+
+#include "sparse_constant_propagator.h"
+
+#include <limits>
+
+#include <util/replace_symbol.h>
+#include <util/simplify_expr.h>
+#include <util/std_code.h>
+#include <util/std_expr.h>
+
+#include "cfg_dominators.h"
+#include "dirty.h"
+
+/// The SSA form and the propagation for one function body. Locations are
+/// numbered in program order; all per-location data is kept in vectors
+/// indexed by these numbers.
+class ssa_constant_propagationt
+{
+public:
+  ssa_constant_propagationt(
+    goto_functionst::goto_functiont &_goto_function,
+    const namespacet &_ns):
+    goto_function(_goto_function),
+    ns(_ns)
+  {
+  }
+
+  void operator()();
+
+protected:
+  goto_functionst::goto_functiont &goto_function;
+  const namespacet &ns;
+
+  static const std::size_t none=std::numeric_limits<std::size_t>::max();
+
+  typedef std::vector<std::size_t> indicest;
+
+  // the control-flow graph
+  std::vector<goto_programt::targett> locations;
+  std::vector<indicest> predecessors, successors;
+
+  // the dominator tree
+  cfg_dominatorst dominators;
+  indicest idom;
+  std::vector<indicest> children;
+
+  // the tracked variables
+  std::unordered_map<irep_idt, std::size_t, irep_id_hash> variables;
+  std::vector<irep_idt> variable_names;
+
+  // SSA values
+  enum class latticet { UNKNOWN, CONSTANT, VARYING };
+
+  struct ssa_valuet
+  {
+    // the rhs is evaluated for assignments to the variable; all other
+    // definitions are VARYING
+    bool is_phi;
+    bool is_assignment;
+    std::size_t location;
+    latticet lattice;
+    exprt constant;
+    // for phis, one for each predecessor
+    indicest operands;
+    // the locations that use the value
+    indicest users;
+  };
+
+  std::vector<ssa_valuet> ssa_values;
+
+  typedef std::vector<std::pair<std::size_t, std::size_t> > var_ssa_listt;
+  // (variable, SSA value) pairs at each location
+  std::vector<var_ssa_listt> uses, defs, phis;
+
+  // the propagation
+  std::vector<std::vector<bool> > executable;
+  std::vector<bool> visited, in_worklist;
+  indicest worklist;
+
+  void build_cfg();
+  void compute_dominators();
+  void collect_variables();
+  void place_phis();
+  void rename();
+  void propagate();
+  void replace();
+
+  std::size_t new_ssa_value(std::size_t location, bool is_phi);
+
+  void get_uses_and_defs(
+    std::size_t location,
+    std::vector<std::size_t> &use_vars,
+    std::vector<std::pair<std::size_t, bool> > &def_vars) const;
+  void find_uses(
+    const exprt &expr,
+    std::vector<std::size_t> &use_vars) const;
+
+  bool evaluate(std::size_t location, exprt &expr) const;
+  void visit(std::size_t location);
+  bool update(std::size_t ssa, latticet lattice, const exprt &constant);
+  void mark_executable(std::size_t from, std::size_t to);
+  void push(std::size_t location);
+};
+
+const std::size_t ssa_constant_propagationt::none;
+
+void ssa_constant_propagationt::operator()()
+{
+  if(!goto_function.body_available())
+    return;
+
+  build_cfg();
+  compute_dominators();
+  collect_variables();
+
+  if(variables.empty())
+    return;
+
+  place_phis();
+  rename();
+  propagate();
+  replace();
+}
+
+/// Numbers the locations and takes the edges from the control-flow graph
+/// of the dominator analysis, so that the dominator tree and the edges
+/// used for placing phis agree.
+void ssa_constant_propagationt::build_cfg()
+{
+  goto_programt &body=goto_function.body;
+
+  dominators.store_dominator_sets=false;
+  dominators(body);
+
+  const cfg_dominatorst::cfgt &cfg=dominators.cfg;
+  std::vector<std::size_t> numbers(cfg.size(), none);
+
+  Forall_goto_program_instructions(it, body)
+  {
+    numbers[cfg.entry_map.at(it)]=locations.size();
+    locations.push_back(it);
+  }
+
+  predecessors.resize(locations.size());
+  successors.resize(locations.size());
+
+  for(std::size_t i=0; i<locations.size(); i++)
+  {
+    for(const auto &edge : cfg[cfg.entry_map.at(locations[i])].out)
+    {
+      std::size_t j=numbers[edge.first];
+      successors[i].push_back(j);
+      predecessors[j].push_back(i);
+    }
+  }
+}
+
+/// Immediate dominators from cfg_dominatorst. Unreachable locations have
+/// no dominator, and the entry location is its own dominator.
+void ssa_constant_propagationt::compute_dominators()
+{
+  const std::size_t n=locations.size();
+  const cfg_dominatorst::cfgt &cfg=dominators.cfg;
+
+  idom.assign(n, none);
+  children.resize(n);
+
+  std::vector<std::size_t> numbers(cfg.size(), none);
+  for(std::size_t i=0; i<n; i++)
+    numbers[cfg.entry_map.at(locations[i])]=i;
+
+  for(std::size_t i=0; i<n; i++)
+  {
+    const cfg_dominatorst::entryt node=cfg.entry_map.at(locations[i]);
+
+    if(!dominators.is_reachable(node))
+      continue;
+
+    if(dominators.has_immediate_dominator(node))
+    {
+      idom[i]=numbers[dominators.immediate_dominator(node)];
+      children[idom[i]].push_back(i);
+    }
+    else
+      idom[i]=i;
+  }
+}
+
+void ssa_constant_propagationt::collect_variables()
+{
+  const dirtyt dirty(goto_function);
+
+  std::vector<symbol_exprt> candidates;
+
+  for(const auto &parameter : goto_function.type.parameters())
+    if(!parameter.get_identifier().empty())
+      candidates.push_back(
+        symbol_exprt(parameter.get_identifier(), parameter.type()));
+
+  for(const auto &l : locations)
+    if(l->is_decl())
+      candidates.push_back(to_symbol_expr(to_code_decl(l->code).symbol()));
+
+  for(const auto &symbol : candidates)
+  {
+    const typet &type=ns.follow(symbol.type());
+
+    if(type.id()==ID_array ||
+       type.id()==ID_struct ||
+       type.id()==ID_union ||
+       type.id()==ID_vector ||
+       type.id()==ID_complex ||
+       dirty(symbol))
+      continue;
+
+    if(variables.insert(
+         std::make_pair(symbol.get_identifier(), variables.size())).second)
+      variable_names.push_back(symbol.get_identifier());
+  }
+}
+
+void ssa_constant_propagationt::find_uses(
+  const exprt &expr,
+  std::vector<std::size_t> &use_vars) const
+{
+  if(expr.id()==ID_symbol)
+  {
+    auto v_it=variables.find(to_symbol_expr(expr).get_identifier());
+    if(v_it!=variables.end())
+      use_vars.push_back(v_it->second);
+  }
+  else
+    forall_operands(it, expr)
+      find_uses(*it, use_vars);
+}
+
+/// Collects the variables used and defined at a location. For the
+/// definitions, the flag says whether the value is given by the rhs of
+/// an assignment.
+void ssa_constant_propagationt::get_uses_and_defs(
+  std::size_t location,
+  std::vector<std::size_t> &use_vars,
+  std::vector<std::pair<std::size_t, bool> > &def_vars) const
+{
+  const goto_programt::instructiont &instruction=*locations[location];
+
+  find_uses(instruction.guard, use_vars);
+
+  if(instruction.is_decl() || instruction.is_dead())
+  {
+    // these define the variable as unknown
+    std::vector<std::size_t> vars;
+    find_uses(instruction.code.op0(), vars);
+    for(const auto v : vars)
+      def_vars.push_back(std::make_pair(v, false));
+  }
+  else if(instruction.is_assign() || instruction.is_function_call())
+  {
+    const exprt &lhs=
+      instruction.is_assign()?
+        to_code_assign(instruction.code).lhs():
+        to_code_function_call(instruction.code).lhs();
+
+    // the variables written to; anything else in the lhs is a use
+    std::vector<const exprt *> roots(1, &lhs);
+    while(!roots.empty())
+    {
+      const exprt &root=*roots.back();
+      roots.pop_back();
+
+      if(root.id()==ID_symbol)
+      {
+        auto v_it=variables.find(to_symbol_expr(root).get_identifier());
+        if(v_it!=variables.end())
+          def_vars.push_back(std::make_pair(
+            v_it->second,
+            instruction.is_assign() && &root==&lhs));
+      }
+      else if(root.id()==ID_if)
+      {
+        find_uses(to_if_expr(root).cond(), use_vars);
+        roots.push_back(&to_if_expr(root).true_case());
+        roots.push_back(&to_if_expr(root).false_case());
+      }
+      else if(root.id()==ID_typecast)
+        roots.push_back(&to_typecast_expr(root).op());
+      else
+        find_uses(root, use_vars);
+    }
+
+    if(instruction.is_assign())
+      find_uses(to_code_assign(instruction.code).rhs(), use_vars);
+    else
+    {
+      const code_function_callt &call=
+        to_code_function_call(instruction.code);
+      find_uses(call.function(), use_vars);
+      for(const auto &argument : call.arguments())
+        find_uses(argument, use_vars);
+    }
+  }
+  else
+    find_uses(instruction.code, use_vars);
+}
+
+std::size_t ssa_constant_propagationt::new_ssa_value(
+  std::size_t location,
+  bool is_phi)
+{
+  ssa_values.push_back(ssa_valuet());
+  ssa_valuet &value=ssa_values.back();
+  value.is_phi=is_phi;
+  value.is_assignment=false;
+  value.location=location;
+  value.lattice=latticet::UNKNOWN;
+  return ssa_values.size()-1;
+}
+
+/// Places phi functions at the iterated dominance frontiers of the
+/// definitions of each variable.
+void ssa_constant_propagationt::place_phis()
+{
+  const std::size_t n=locations.size();
+
+  // dominance frontiers
+  std::vector<indicest> frontier(n);
+
+  for(std::size_t node=0; node<n; node++)
+  {
+    if(idom[node]==none || predecessors[node].size()<2)
+      continue;
+
+    for(const auto p : predecessors[node])
+    {
+      std::size_t runner=p;
+      while(idom[runner]!=none && runner!=idom[node])
+      {
+        if(frontier[runner].empty() || frontier[runner].back()!=node)
+          frontier[runner].push_back(node);
+        runner=idom[runner];
+      }
+    }
+  }
+
+  // definition sites of each variable
+  std::vector<indicest> def_sites(variables.size());
+  uses.resize(n);
+  defs.resize(n);
+  phis.resize(n);
+
+  std::vector<std::size_t> use_vars;
+  std::vector<std::pair<std::size_t, bool> > def_vars;
+
+  for(std::size_t node=0; node<n; node++)
+  {
+    if(idom[node]==none)
+      continue;
+
+    use_vars.clear();
+    def_vars.clear();
+    get_uses_and_defs(node, use_vars, def_vars);
+
+    for(const auto v : use_vars)
+      uses[node].push_back(std::make_pair(v, none));
+
+    for(const auto &d : def_vars)
+    {
+      std::size_t ssa=new_ssa_value(node, false);
+      ssa_values[ssa].is_assignment=d.second;
+      defs[node].push_back(std::make_pair(d.first, ssa));
+      def_sites[d.first].push_back(node);
+    }
+  }
+
+  std::vector<std::size_t> has_phi(n, none), in_work(n, none);
+
+  for(std::size_t v=0; v<variables.size(); v++)
+  {
+    indicest work=def_sites[v];
+    for(const auto node : work)
+      in_work[node]=v;
+
+    while(!work.empty())
+    {
+      std::size_t node=work.back();
+      work.pop_back();
+
+      for(const auto f : frontier[node])
+      {
+        if(has_phi[f]==v)
+          continue;
+
+        has_phi[f]=v;
+        std::size_t ssa=new_ssa_value(f, true);
+        ssa_values[ssa].operands.resize(predecessors[f].size(), none);
+        phis[f].push_back(std::make_pair(v, ssa));
+
+        if(in_work[f]!=v)
+        {
+          in_work[f]=v;
+          work.push_back(f);
+        }
+      }
+    }
+  }
+}
+
+/// Walks the dominator tree, connecting each use to the definition that
+/// reaches it.
+void ssa_constant_propagationt::rename()
+{
+  // the values at the entry are unknown
+  std::vector<indicest> stacks(variables.size());
+  for(auto &stack : stacks)
+  {
+    std::size_t ssa=new_ssa_value(0, false);
+    ssa_values[ssa].lattice=latticet::VARYING;
+    stack.push_back(ssa);
+  }
+
+  // iterative walk, as the dominator tree of long straight-line code
+  // is very deep
+  std::vector<std::pair<std::size_t, bool> > walk;
+  walk.push_back(std::make_pair(0, false));
+
+  while(!walk.empty())
+  {
+    const std::size_t node=walk.back().first;
+
+    if(walk.back().second)
+    {
+      walk.pop_back();
+
+      for(const auto &d : defs[node])
+        stacks[d.first].pop_back();
+      for(const auto &phi : phis[node])
+        stacks[phi.first].pop_back();
+
+      continue;
+    }
+
+    walk.back().second=true;
+
+    for(const auto &phi : phis[node])
+      stacks[phi.first].push_back(phi.second);
+
+    for(auto &use : uses[node])
+    {
+      use.second=stacks[use.first].back();
+      ssa_values[use.second].users.push_back(node);
+    }
+
+    for(const auto &d : defs[node])
+      stacks[d.first].push_back(d.second);
+
+    for(const auto s : successors[node])
+    {
+      for(std::size_t j=0; j<predecessors[s].size(); j++)
+      {
+        if(predecessors[s][j]!=node)
+          continue;
+
+        for(const auto &phi : phis[s])
+        {
+          std::size_t operand=stacks[phi.first].back();
+          ssa_values[phi.second].operands[j]=operand;
+          ssa_values[operand].users.push_back(s);
+        }
+      }
+    }
+
+    for(const auto c : children[node])
+      walk.push_back(std::make_pair(c, false));
+  }
+}
+
+/// Replaces the uses at a location that are known to be constant.
+/// \return True if the expression depends on a value that is not known
+///   yet.
+bool ssa_constant_propagationt::evaluate(
+  std::size_t location,
+  exprt &expr) const
+{
+  replace_symbolt replace_const;
+
+  for(const auto &use : uses[location])
+  {
+    const ssa_valuet &value=ssa_values[use.second];
+
+    if(value.lattice==latticet::UNKNOWN)
+      return true;
+
+    if(value.lattice==latticet::CONSTANT)
+      replace_const.insert(variable_names[use.first], value.constant);
+  }
+
+  if(!replace_const.empty())
+  {
+    replace_const(expr);
+    simplify(expr, ns);
+  }
+
+  return false;
+}
+
+/// \return True if the value has changed.
+bool ssa_constant_propagationt::update(
+  std::size_t ssa,
+  latticet lattice,
+  const exprt &constant)
+{
+  ssa_valuet &value=ssa_values[ssa];
+
+  if(value.lattice==latticet::VARYING || lattice==latticet::UNKNOWN)
+    return false;
+
+  if(value.lattice==latticet::CONSTANT)
+  {
+    if(lattice==latticet::CONSTANT && value.constant==constant)
+      return false;
+
+    value.lattice=latticet::VARYING;
+    value.constant.make_nil();
+  }
+  else
+  {
+    value.lattice=lattice;
+    value.constant=constant;
+  }
+
+  for(const auto user : value.users)
+    if(visited[user])
+      push(user);
+
+  return true;
+}
+
+void ssa_constant_propagationt::push(std::size_t location)
+{
+  if(!in_worklist[location])
+  {
+    in_worklist[location]=true;
+    worklist.push_back(location);
+  }
+}
+
+void ssa_constant_propagationt::mark_executable(
+  std::size_t from,
+  std::size_t to)
+{
+  for(std::size_t j=0; j<predecessors[to].size(); j++)
+  {
+    if(predecessors[to][j]==from && !executable[to][j])
+    {
+      executable[to][j]=true;
+      push(to);
+    }
+  }
+}
+
+void ssa_constant_propagationt::visit(std::size_t location)
+{
+  visited[location]=true;
+
+  // phis: the meet of the operands on executable edges
+  for(const auto &phi : phis[location])
+  {
+    const ssa_valuet &value=ssa_values[phi.second];
+    latticet lattice=latticet::UNKNOWN;
+    exprt constant;
+
+    for(std::size_t j=0; j<value.operands.size(); j++)
+    {
+      if(!executable[location][j] || value.operands[j]==none)
+        continue;
+
+      const ssa_valuet &operand=ssa_values[value.operands[j]];
+
+      if(operand.lattice==latticet::UNKNOWN)
+        continue;
+      else if(operand.lattice==latticet::VARYING ||
+              (lattice==latticet::CONSTANT && constant!=operand.constant))
+      {
+        lattice=latticet::VARYING;
+        break;
+      }
+      else
+      {
+        lattice=latticet::CONSTANT;
+        constant=operand.constant;
+      }
+    }
+
+    update(phi.second, lattice, constant);
+  }
+
+  const goto_programt::instructiont &instruction=*locations[location];
+
+  // definitions
+  for(const auto &d : defs[location])
+  {
+    if(!ssa_values[d.second].is_assignment)
+    {
+      update(d.second, latticet::VARYING, nil_exprt());
+      continue;
+    }
+
+    exprt rhs=to_code_assign(instruction.code).rhs();
+
+    if(evaluate(location, rhs))
+      continue;
+
+    if(rhs.is_constant())
+      update(d.second, latticet::CONSTANT, rhs);
+    else
+      update(d.second, latticet::VARYING, nil_exprt());
+  }
+
+  // control flow
+  if(instruction.is_goto() && !instruction.guard.is_true())
+  {
+    exprt guard=instruction.guard;
+
+    if(evaluate(location, guard))
+      return;
+
+    for(const auto s : successors[location])
+    {
+      const bool to_target=locations[s]==instruction.get_target();
+      const bool to_next=s==location+1;
+
+      if(guard.is_true()?to_target:guard.is_false()?to_next:true)
+        mark_executable(location, s);
+    }
+  }
+  else if(instruction.is_assume())
+  {
+    exprt guard=instruction.guard;
+
+    if(evaluate(location, guard) || guard.is_false())
+      return;
+
+    for(const auto s : successors[location])
+      mark_executable(location, s);
+  }
+  else
+  {
+    for(const auto s : successors[location])
+      mark_executable(location, s);
+  }
+}
+
+void ssa_constant_propagationt::propagate()
+{
+  const std::size_t n=locations.size();
+
+  executable.resize(n);
+  for(std::size_t i=0; i<n; i++)
+    executable[i].resize(predecessors[i].size(), false);
+
+  visited.resize(n, false);
+  in_worklist.resize(n, false);
+
+  push(0);
+
+  while(!worklist.empty())
+  {
+    std::size_t location=worklist.back();
+    worklist.pop_back();
+    in_worklist[location]=false;
+
+    visit(location);
+  }
+}
+
+void ssa_constant_propagationt::replace()
+{
+  for(std::size_t location=0; location<locations.size(); location++)
+  {
+    if(!visited[location] || uses[location].empty())
+      continue;
+
+    goto_programt::instructiont &instruction=*locations[location];
+
+    if(instruction.is_goto() ||
+       instruction.is_assume() ||
+       instruction.is_assert())
+    {
+      evaluate(location, instruction.guard);
+    }
+    else if(instruction.is_assign())
+    {
+      exprt &rhs=to_code_assign(instruction.code).rhs();
+      evaluate(location, rhs);
+      if(rhs.id()==ID_constant)
+        rhs.add_source_location()=instruction.code.op0().source_location();
+    }
+    else if(instruction.is_function_call())
+    {
+      code_function_callt &call=to_code_function_call(instruction.code);
+
+      evaluate(location, call.function());
+
+      for(auto &argument : call.arguments())
+        evaluate(location, argument);
+    }
+    else if(instruction.is_other())
+    {
+      if(instruction.code.get_statement()==ID_expression)
+        evaluate(location, instruction.code);
+    }
+  }
+}
+
+void sparse_constant_propagatort::replace(
+  goto_functionst::goto_functiont &goto_function,
+  const namespacet &ns)
+{
+  ssa_constant_propagationt propagation(goto_function, ns);
+  propagation();
+}
+
+void sparse_constant_propagatort::replace(
+  goto_functionst &goto_functions,
+  const namespacet &ns)
+{
+  Forall_goto_functions(f_it, goto_functions)
+    replace(f_it->second, ns);
+}
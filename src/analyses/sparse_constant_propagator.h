@@ -0,0 +1,54 @@
+/*******************************************************************\
+
+Module: Sparse Constant Propagation
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Sparse Constant Propagation
+
+#ifndef CPROVER_ANALYSES_SPARSE_CONSTANT_PROPAGATOR_H
+#define CPROVER_ANALYSES_SPARSE_CONSTANT_PROPAGATOR_H
+
+#include <goto-programs/goto_functions.h>
+
+/// Constant propagation on SSA form, following Wegman and Zadeck's sparse
+/// conditional constant propagation. The local variables of each function
+/// are renamed into SSA form, and constants are propagated along def-use
+/// chains only, instead of storing a map of all variables at every
+/// location as constant_propagator_ait does.
+///
+/// Only non-aggregate local variables and parameters whose address is
+/// never taken are tracked, which means that function calls cannot
+/// change them. Constants in global variables and arrays, and facts
+/// implied by branch conditions, are not propagated.
+class sparse_constant_propagatort
+{
+public:
+  sparse_constant_propagatort(
+    goto_functionst &goto_functions,
+    const namespacet &ns)
+  {
+    replace(goto_functions, ns);
+  }
+
+  sparse_constant_propagatort(
+    goto_functionst::goto_functiont &goto_function,
+    const namespacet &ns)
+  {
+    replace(goto_function, ns);
+  }
+
+protected:
+  void replace(
+    goto_functionst::goto_functiont &,
+    const namespacet &);
+
+  void replace(
+    goto_functionst &,
+    const namespacet &);
+};
+
+#endif // CPROVER_ANALYSES_SPARSE_CONSTANT_PROPAGATOR_H
@@ -0,0 +1,286 @@
+/*******************************************************************\
+
+Module: Cache for Parsed Header Files
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Cache for Parsed Header Files
+
+#include "ansi_c_header_cache.h"
+
+#include <cctype>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include <util/irep_serialization.h>
+#include <util/string_hash.h>
+
+#include "ansi_c_parser.h"
+
+/// \return whether the line is a line directive, in which case the line
+///   number and the file name are returned
+static bool line_directive(
+  const std::string &line,
+  unsigned &line_no,
+  std::string &file)
+{
+  std::size_t pos=line.find_first_not_of(" \t");
+
+  if(pos==std::string::npos || line[pos]!='#')
+    return false;
+
+  pos=line.find_first_not_of(" \t", pos+1);
+
+  if(pos!=std::string::npos && line.compare(pos, 4, "line")==0)
+    pos=line.find_first_not_of(" \t", pos+4);
+
+  if(pos==std::string::npos || !isdigit(line[pos]))
+    return false;
+
+  line_no=0;
+  for(; pos<line.size() && isdigit(line[pos]); pos++)
+    line_no=line_no*10+(line[pos]-'0');
+
+  std::size_t start=line.find('"', pos);
+  if(start==std::string::npos)
+    return false;
+
+  // file names are escaped, and we keep them that way
+  std::size_t end=start+1;
+  while(end<line.size() && line[end]!='"')
+    end+=(line[end]=='\\')?2:1;
+
+  if(end>=line.size())
+    return false;
+
+  file=line.substr(start+1, end-start-1);
+
+  return true;
+}
+
+/// \return whether the line is neither blank nor a directive
+static bool is_code(const std::string &line)
+{
+  std::size_t pos=line.find_first_not_of(" \t\r");
+  return pos!=std::string::npos && line[pos]!='#';
+}
+
+void ansi_c_header_cachet::split(
+  const std::string &text,
+  std::string &headers,
+  std::string &rest)
+{
+  headers.clear();
+  rest=text;
+
+  // the first line directive names the main file
+  std::string main_file, file;
+  unsigned line_no=0;
+  bool first=true;
+
+  for(std::size_t pos=0; pos<text.size();)
+  {
+    std::size_t eol=text.find('\n', pos);
+    if(eol==std::string::npos)
+      eol=text.size();
+
+    const std::string line=text.substr(pos, eol-pos);
+
+    unsigned new_line_no;
+    std::string new_file;
+
+    if(line_directive(line, new_line_no, new_file))
+    {
+      if(first)
+        main_file=new_file;
+
+      line_no=new_line_no;
+      file=new_file;
+    }
+    else if(first)
+      return; // not output of a preprocessor
+    else if(file==main_file && is_code(line))
+    {
+      headers=text.substr(0, pos);
+      rest="# "+std::to_string(line_no)+" \""+main_file+"\"\n"+
+           text.substr(pos);
+      return;
+    }
+    else
+      line_no++;
+
+    first=false;
+    pos=eol+1;
+  }
+}
+
+std::string ansi_c_header_cachet::file_name(
+  const std::string &text,
+  const ansi_c_parsert &parser) const
+{
+  std::ostringstream key;
+  key << static_cast<int>(parser.mode) << parser.for_has_scope
+      << parser.cpp98 << parser.cpp11 << '\n' << text;
+
+  std::ostringstream result;
+
+  result << directory;
+#ifdef _WIN32
+  result << '\\';
+#else
+  result << '/';
+#endif
+  result << std::hex << std::setw(16) << std::setfill('0')
+         << hash_string(key.str()) << ".hc";
+
+  return result.str();
+}
+
+bool ansi_c_header_cachet::read(
+  const std::string &text,
+  ansi_c_parsert &parser)
+{
+  const std::string name=file_name(text, parser);
+  std::ifstream in(name, std::ios::binary);
+
+  if(!in)
+    return true;
+
+  irep_serializationt::ireps_containert ic;
+  irep_serializationt irepconverter(ic);
+
+  if(id2string(irepconverter.read_gb_string(in))!="ANSI-C-HEADER-CACHE")
+    return true;
+
+  // compare the text, which avoids interning it
+  if(irepconverter.read_gb_word(in)!=text.size())
+    return true;
+
+  std::string cached_text(text.size(), 0);
+  in.read(&cached_text[0], cached_text.size());
+
+  if(!in || cached_text!=text)
+    return true;
+
+  ansi_c_parse_treet::itemst items;
+
+  for(std::size_t count=irepconverter.read_gb_word(in);
+      count>0 && in;
+      count--)
+  {
+    items.push_back(ansi_c_declarationt());
+    irepconverter.reference_convert(in, items.back());
+  }
+
+  ansi_c_parsert::scopet::name_mapt name_map;
+
+  for(std::size_t count=irepconverter.read_gb_word(in);
+      count>0 && in;
+      count--)
+  {
+    const irep_idt scope_name=irepconverter.read_string_ref(in);
+    ansi_c_identifiert &identifier=name_map[scope_name];
+    identifier.id_class=
+      static_cast<ansi_c_id_classt>(irepconverter.read_gb_word(in));
+    identifier.base_name=irepconverter.read_string_ref(in);
+    identifier.prefixed_name=irepconverter.read_string_ref(in);
+  }
+
+  const unsigned compound_counter=irepconverter.read_gb_word(in);
+  const unsigned anon_counter=irepconverter.read_gb_word(in);
+
+  std::list<exprt> pragma_pack;
+
+  for(std::size_t count=irepconverter.read_gb_word(in);
+      count>0 && in;
+      count--)
+  {
+    pragma_pack.push_back(exprt());
+    irepconverter.reference_convert(in, pragma_pack.back());
+  }
+
+  if(!in)
+    return true;
+
+  parser.parse_tree.items.swap(items);
+  parser.root_scope().name_map.swap(name_map);
+  parser.root_scope().compound_counter=compound_counter;
+  parser.root_scope().anon_counter=anon_counter;
+  parser.pragma_pack.swap(pragma_pack);
+
+  debug() << "using parsed headers from " << name << eom;
+
+  return false;
+}
+
+/// Entries are written to a temporary file first, which protects
+/// concurrent readers from partially written entries.
+bool ansi_c_header_cachet::write(
+  const std::string &text,
+  const ansi_c_parsert &parser)
+{
+  const std::string name=file_name(text, parser);
+  const std::string tmp_name=name+".tmp";
+
+  {
+    std::ofstream out(tmp_name, std::ios::binary);
+
+    if(!out)
+    {
+      warning() << "failed to write header cache entry " << name << eom;
+      return true;
+    }
+
+    irep_serializationt::ireps_containert ic;
+    irep_serializationt irepconverter(ic);
+
+    write_gb_string(out, "ANSI-C-HEADER-CACHE");
+
+    write_gb_word(out, text.size());
+    out.write(text.data(), text.size());
+
+    write_gb_word(out, parser.parse_tree.items.size());
+    for(const auto &item : parser.parse_tree.items)
+      irepconverter.reference_convert(item, out);
+
+    const ansi_c_parsert::scopet &scope=parser.root_scope();
+
+    write_gb_word(out, scope.name_map.size());
+    for(const auto &entry : scope.name_map)
+    {
+      irepconverter.write_string_ref(out, entry.first);
+      write_gb_word(out, static_cast<std::size_t>(entry.second.id_class));
+      irepconverter.write_string_ref(out, entry.second.base_name);
+      irepconverter.write_string_ref(out, entry.second.prefixed_name);
+    }
+
+    write_gb_word(out, scope.compound_counter);
+    write_gb_word(out, scope.anon_counter);
+
+    write_gb_word(out, parser.pragma_pack.size());
+    for(const auto &pack : parser.pragma_pack)
+      irepconverter.reference_convert(pack, out);
+
+    if(!out)
+    {
+      warning() << "failed to write header cache entry " << name << eom;
+      return true;
+    }
+  }
+
+  if(std::rename(tmp_name.c_str(), name.c_str())!=0)
+  {
+    std::remove(tmp_name.c_str());
+    warning() << "failed to write header cache entry " << name << eom;
+    return true;
+  }
+
+  debug() << "storing parsed headers in " << name << eom;
+
+  return false;
+}
@@ -0,0 +1,58 @@
+/*******************************************************************\
+
+Module: Cache for Parsed Header Files
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Cache for Parsed Header Files
+
+#ifndef CPROVER_ANSI_C_ANSI_C_HEADER_CACHE_H
+#define CPROVER_ANSI_C_ANSI_C_HEADER_CACHE_H
+
+#include <string>
+
+#include <util/message.h>
+
+class ansi_c_parsert;
+
+/// Stores the state of the parser after parsing the declarations of the
+/// headers that a preprocessed file starts with: the parse tree, the
+/// identifiers of the global scope, and the pragma pack stack. Many files
+/// include the same headers, and the parser then continues with the
+/// remainder of the file only. Entries are found by a hash of the text
+/// that was parsed.
+class ansi_c_header_cachet:public messaget
+{
+public:
+  explicit ansi_c_header_cachet(const std::string &_directory):
+    directory(_directory)
+  {
+  }
+
+  /// Splits preprocessed text just before the first line of code that
+  /// does not come from an included file. A line directive that gives
+  /// the position of that line starts the rest.
+  static void split(
+    const std::string &text,
+    std::string &headers,
+    std::string &rest);
+
+  /// restores the state of the parser after parsing the given text
+  /// \return true if there is no valid entry
+  bool read(const std::string &text, ansi_c_parsert &);
+
+  /// \return true on error
+  bool write(const std::string &text, const ansi_c_parsert &);
+
+protected:
+  const std::string directory;
+
+  std::string file_name(
+    const std::string &text,
+    const ansi_c_parsert &) const;
+};
+
+#endif // CPROVER_ANSI_C_ANSI_C_HEADER_CACHE_H
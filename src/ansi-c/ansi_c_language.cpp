@@ -11,6 +11,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <cstring>
 #include <sstream>
 #include <fstream>
+#include <vector>
 
 #include <util/config.h>
 #include <util/get_base_name.h>
@@ -19,6 +20,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <linking/remove_internal_symbols.h>
 
 #include "ansi_c_entry_point.h"
+#include "ansi_c_header_cache.h"
 #include "ansi_c_typecheck.h"
 #include "ansi_c_parser.h"
 #include "expr2c.h"
@@ -62,43 +64,170 @@ bool ansi_c_languaget::parse(
   if(preprocess(instream, path, o_preprocessed))
     return true;
 
-  std::istringstream i_preprocessed(o_preprocessed.str());
-
-  // parsing
-
   std::string code;
   ansi_c_internal_additions(code);
-  std::istringstream codestr(code);
 
+  bool result;
+
+  if(config.ansi_c.header_cache.empty())
+    result=parse_preprocessed(code, o_preprocessed.str(), path);
+  else
+    result=parse_with_header_cache(code, o_preprocessed.str(), path);
+
+  // save result
+  parse_tree.swap(ansi_c_parser.parse_tree);
+
+  // save some memory
+  ansi_c_parser.clear();
+
+  return result;
+}
+
+void ansi_c_languaget::init_parser()
+{
   ansi_c_parser.clear();
   ansi_c_parser.set_file(ID_built_in);
-  ansi_c_parser.in=&codestr;
   ansi_c_parser.set_message_handler(get_message_handler());
   ansi_c_parser.for_has_scope=config.ansi_c.for_has_scope;
   ansi_c_parser.cpp98=false; // it's not C++
   ansi_c_parser.cpp11=false; // it's not C++
   ansi_c_parser.mode=config.ansi_c.mode;
+}
 
+/// parses the given text, starting from the current state of the parser
+bool ansi_c_languaget::parse_text(
+  const std::string &text,
+  const std::string &path)
+{
+  std::istringstream in(text);
+
+  ansi_c_parser.set_line_no(0);
+  ansi_c_parser.set_file(path);
+  ansi_c_parser.in=&in;
+  ansi_c_scanner_init();
+
+  return ansi_c_parser.parse();
+}
+
+/// parses the internal additions followed by the preprocessed file
+bool ansi_c_languaget::parse_preprocessed(
+  const std::string &code,
+  const std::string &preprocessed,
+  const std::string &path)
+{
+  init_parser();
+
+  std::istringstream codestr(code);
+  ansi_c_parser.in=&codestr;
   ansi_c_scanner_init();
 
   bool result=ansi_c_parser.parse();
 
   if(!result)
+    result=parse_text(preprocessed, path);
+
+  return result;
+}
+
+/// Holds back the messages of a parse that may be discarded, and passes
+/// them on to another handler once the parse is known to be kept.
+class deferred_message_handlert:public message_handlert
+{
+public:
+  explicit deferred_message_handlert(message_handlert &_message_handler):
+    message_handler(_message_handler)
   {
-    ansi_c_parser.set_line_no(0);
-    ansi_c_parser.set_file(path);
-    ansi_c_parser.in=&i_preprocessed;
-    ansi_c_scanner_init();
-    result=ansi_c_parser.parse();
   }
 
-  // save result
-  parse_tree.swap(ansi_c_parser.parse_tree);
+  void print(unsigned level, const std::string &message) override
+  {
+    messages.push_back({ level, message, 0, source_locationt(), false });
+  }
 
-  // save some memory
-  ansi_c_parser.clear();
+  void print(
+    unsigned level,
+    const std::string &message,
+    int sequence_number,
+    const source_locationt &location) override
+  {
+    messages.push_back(
+      { level, message, sequence_number, location, true });
+  }
 
-  return result;
+  void forward()
+  {
+    for(const auto &m : messages)
+    {
+      if(m.has_location)
+        message_handler.print(
+          m.level, m.message, m.sequence_number, m.location);
+      else
+        message_handler.print(m.level, m.message);
+    }
+
+    messages.clear();
+  }
+
+protected:
+  message_handlert &message_handler;
+
+  struct deferred_messaget
+  {
+    unsigned level;
+    std::string message;
+    int sequence_number;
+    source_locationt location;
+    bool has_location;
+  };
+
+  std::vector<deferred_messaget> messages;
+};
+
+/// Parses the headers that the preprocessed file starts with, together
+/// with the internal additions, only if the header cache has no entry
+/// for them. The parser then continues with the rest of the file.
+bool ansi_c_languaget::parse_with_header_cache(
+  const std::string &code,
+  const std::string &preprocessed,
+  const std::string &path)
+{
+  std::string headers, rest;
+  ansi_c_header_cachet::split(preprocessed, headers, rest);
+
+  if(headers.empty())
+    return parse_preprocessed(code, preprocessed, path);
+
+  ansi_c_header_cachet header_cache(config.ansi_c.header_cache);
+  header_cache.set_message_handler(get_message_handler());
+
+  const std::string text=code+headers;
+
+  init_parser();
+
+  if(header_cache.read(text, ansi_c_parser))
+  {
+    // The headers may end in the middle of a declaration, in which case
+    // we parse the file as a whole, and report any errors then.
+    deferred_message_handlert deferred_message_handler(get_message_handler());
+    ansi_c_parser.set_message_handler(deferred_message_handler);
+
+    std::istringstream codestr(code);
+    ansi_c_parser.in=&codestr;
+    ansi_c_scanner_init();
+
+    bool result=ansi_c_parser.parse() || parse_text(headers, path);
+
+    ansi_c_parser.set_message_handler(get_message_handler());
+
+    if(result)
+      return parse_preprocessed(code, preprocessed, path);
+
+    deferred_message_handler.forward();
+
+    header_cache.write(text, ansi_c_parser);
+  }
+
+  return parse_text(rest, path);
 }
 
 bool ansi_c_languaget::typecheck(
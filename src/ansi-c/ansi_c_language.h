@@ -71,6 +71,19 @@ public:
 protected:
   ansi_c_parse_treet parse_tree;
   std::string parse_path;
+
+  void init_parser();
+  bool parse_text(const std::string &text, const std::string &path);
+
+  bool parse_preprocessed(
+    const std::string &code,
+    const std::string &preprocessed,
+    const std::string &path);
+
+  bool parse_with_header_cache(
+    const std::string &code,
+    const std::string &preprocessed,
+    const std::string &path);
 };
 
 languaget *new_ansi_c_language();
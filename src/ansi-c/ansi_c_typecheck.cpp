@@ -21,6 +21,9 @@ void ansi_c_typecheckt::typecheck()
   {
     typecheck_declaration(*it);
   }
+
+  statistics() << "Type cache: " << type_cache.size() << " types, "
+               << type_cache_hits << " hits" << eom;
 }
 
 bool ansi_c_typecheck(
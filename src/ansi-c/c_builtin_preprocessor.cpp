@@ -0,0 +1,2245 @@
+/*******************************************************************\
+
+Module: Built-in C Preprocessor
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Built-in C Preprocessor
+
+#include "c_builtin_preprocessor.h"
+
+#include <algorithm>
+#include <cctype>
+#include <climits>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include <util/file_util.h>
+#include <util/unicode.h>
+
+/// the headers that come with the compiler rather than the C library
+static const std::map<std::string, std::string> builtin_headers=
+{
+  { "stddef.h",
+    // with __need_size_t and the like, only the types asked for
+    "#if !defined(__need_size_t) && !defined(__need_ptrdiff_t) && \\\n"
+    "    !defined(__need_wchar_t) && !defined(__need_wint_t) && \\\n"
+    "    !defined(__need_NULL)\n"
+    "#define __cprover_stddef_all\n"
+    "#endif\n"
+    "#if (defined(__cprover_stddef_all) || defined(__need_size_t)) && \\\n"
+    "    !defined(_SIZE_T)\n"
+    "#define _SIZE_T\n"
+    "typedef __SIZE_TYPE__ size_t;\n"
+    "#endif\n"
+    "#if (defined(__cprover_stddef_all) || defined(__need_ptrdiff_t)) && \\\n"
+    "    !defined(_PTRDIFF_T)\n"
+    "#define _PTRDIFF_T\n"
+    "typedef __PTRDIFF_TYPE__ ptrdiff_t;\n"
+    "#endif\n"
+    "#if (defined(__cprover_stddef_all) || defined(__need_wchar_t)) && \\\n"
+    "    !defined(_WCHAR_T) && !defined(__cplusplus)\n"
+    "#define _WCHAR_T\n"
+    "typedef __WCHAR_TYPE__ wchar_t;\n"
+    "#endif\n"
+    "#if defined(__need_wint_t) && !defined(_WINT_T)\n"
+    "#define _WINT_T\n"
+    "typedef __WINT_TYPE__ wint_t;\n"
+    "#endif\n"
+    "#if defined(__cprover_stddef_all) || defined(__need_NULL)\n"
+    "#undef NULL\n"
+    "#define NULL ((void *)0)\n"
+    "#endif\n"
+    "#ifdef __cprover_stddef_all\n"
+    "#ifndef offsetof\n"
+    "#define offsetof(TYPE, MEMBER) __builtin_offsetof(TYPE, MEMBER)\n"
+    "#endif\n"
+    "#if (defined(__STDC_VERSION__) && __STDC_VERSION__>=201112L) || \\\n"
+    "    (defined(__cplusplus) && __cplusplus>=201103L)\n"
+    "#ifndef _GCC_MAX_ALIGN_T\n"
+    "#define _GCC_MAX_ALIGN_T\n"
+    "typedef struct {\n"
+    "  long long __max_align_ll\n"
+    "    __attribute__((__aligned__(__alignof__(long long))));\n"
+    "  long double __max_align_ld\n"
+    "    __attribute__((__aligned__(__alignof__(long double))));\n"
+    "} max_align_t;\n"
+    "#endif\n"
+    "#endif\n"
+    "#define _STDDEF_H\n"
+    "#undef __cprover_stddef_all\n"
+    "#endif\n"
+    "#undef __need_size_t\n"
+    "#undef __need_ptrdiff_t\n"
+    "#undef __need_wchar_t\n"
+    "#undef __need_wint_t\n"
+    "#undef __need_NULL\n" },
+  { "stdarg.h",
+    "#ifndef __GNUC_VA_LIST\n"
+    "#define __GNUC_VA_LIST\n"
+    "typedef __builtin_va_list __gnuc_va_list;\n"
+    "#endif\n"
+    "#if !defined(__need___va_list) && !defined(_STDARG_H)\n"
+    "#define _STDARG_H\n"
+    "#ifndef _VA_LIST_DEFINED\n"
+    "#define _VA_LIST_DEFINED\n"
+    "typedef __gnuc_va_list va_list;\n"
+    "#endif\n"
+    "#define va_start(v, l) __builtin_va_start(v, l)\n"
+    "#define va_end(v) __builtin_va_end(v)\n"
+    "#define va_arg(v, l) __builtin_va_arg(v, l)\n"
+    "#define va_copy(d, s) __builtin_va_copy(d, s)\n"
+    "#define __va_copy(d, s) __builtin_va_copy(d, s)\n"
+    "#endif\n"
+    "#undef __need___va_list\n" },
+  { "stdbool.h",
+    "#ifndef _STDBOOL_H\n"
+    "#define _STDBOOL_H\n"
+    "#define bool _Bool\n"
+    "#define true 1\n"
+    "#define false 0\n"
+    "#define __bool_true_false_are_defined 1\n"
+    "#endif\n" },
+  { "stdalign.h",
+    "#ifndef _STDALIGN_H\n"
+    "#define _STDALIGN_H\n"
+    "#define alignas _Alignas\n"
+    "#define alignof _Alignof\n"
+    "#define __alignas_is_defined 1\n"
+    "#define __alignof_is_defined 1\n"
+    "#endif\n" },
+  { "stdnoreturn.h",
+    "#ifndef _STDNORETURN_H\n"
+    "#define _STDNORETURN_H\n"
+    "#define noreturn _Noreturn\n"
+    "#endif\n" },
+  { "iso646.h",
+    "#ifndef _ISO646_H\n"
+    "#define _ISO646_H\n"
+    "#define and &&\n"
+    "#define and_eq &=\n"
+    "#define bitand &\n"
+    "#define bitor |\n"
+    "#define compl ~\n"
+    "#define not !\n"
+    "#define not_eq !=\n"
+    "#define or ||\n"
+    "#define or_eq |=\n"
+    "#define xor ^\n"
+    "#define xor_eq ^=\n"
+    "#endif\n" },
+  { "float.h",
+    "#ifndef _FLOAT_H___\n"
+    "#define _FLOAT_H___\n"
+    "#define FLT_RADIX __FLT_RADIX__\n"
+    "#define FLT_ROUNDS 1\n"
+    "#define FLT_EVAL_METHOD __FLT_EVAL_METHOD__\n"
+    "#define DECIMAL_DIG __DECIMAL_DIG__\n"
+    "#define FLT_MANT_DIG __FLT_MANT_DIG__\n"
+    "#define DBL_MANT_DIG __DBL_MANT_DIG__\n"
+    "#define LDBL_MANT_DIG __LDBL_MANT_DIG__\n"
+    "#define FLT_DIG __FLT_DIG__\n"
+    "#define DBL_DIG __DBL_DIG__\n"
+    "#define LDBL_DIG __LDBL_DIG__\n"
+    "#define FLT_MIN_EXP __FLT_MIN_EXP__\n"
+    "#define DBL_MIN_EXP __DBL_MIN_EXP__\n"
+    "#define LDBL_MIN_EXP __LDBL_MIN_EXP__\n"
+    "#define FLT_MIN_10_EXP __FLT_MIN_10_EXP__\n"
+    "#define DBL_MIN_10_EXP __DBL_MIN_10_EXP__\n"
+    "#define LDBL_MIN_10_EXP __LDBL_MIN_10_EXP__\n"
+    "#define FLT_MAX_EXP __FLT_MAX_EXP__\n"
+    "#define DBL_MAX_EXP __DBL_MAX_EXP__\n"
+    "#define LDBL_MAX_EXP __LDBL_MAX_EXP__\n"
+    "#define FLT_MAX_10_EXP __FLT_MAX_10_EXP__\n"
+    "#define DBL_MAX_10_EXP __DBL_MAX_10_EXP__\n"
+    "#define LDBL_MAX_10_EXP __LDBL_MAX_10_EXP__\n"
+    "#define FLT_MAX __FLT_MAX__\n"
+    "#define DBL_MAX __DBL_MAX__\n"
+    "#define LDBL_MAX __LDBL_MAX__\n"
+    "#define FLT_EPSILON __FLT_EPSILON__\n"
+    "#define DBL_EPSILON __DBL_EPSILON__\n"
+    "#define LDBL_EPSILON __LDBL_EPSILON__\n"
+    "#define FLT_MIN __FLT_MIN__\n"
+    "#define DBL_MIN __DBL_MIN__\n"
+    "#define LDBL_MIN __LDBL_MIN__\n"
+    "#endif\n" },
+  { "limits.h",
+    "#ifndef _GCC_LIMITS_H_\n"
+    "#define _GCC_LIMITS_H_\n"
+    "#define CHAR_BIT __CHAR_BIT__\n"
+    "#ifndef MB_LEN_MAX\n"
+    "#define MB_LEN_MAX 16\n"
+    "#endif\n"
+    "#define SCHAR_MAX __SCHAR_MAX__\n"
+    "#define SCHAR_MIN (-SCHAR_MAX - 1)\n"
+    "#define UCHAR_MAX (SCHAR_MAX * 2 + 1)\n"
+    "#ifdef __CHAR_UNSIGNED__\n"
+    "#define CHAR_MIN 0\n"
+    "#define CHAR_MAX UCHAR_MAX\n"
+    "#else\n"
+    "#define CHAR_MIN SCHAR_MIN\n"
+    "#define CHAR_MAX SCHAR_MAX\n"
+    "#endif\n"
+    "#define SHRT_MAX __SHRT_MAX__\n"
+    "#define SHRT_MIN (-SHRT_MAX - 1)\n"
+    "#define USHRT_MAX (SHRT_MAX * 2 + 1)\n"
+    "#define INT_MAX __INT_MAX__\n"
+    "#define INT_MIN (-INT_MAX - 1)\n"
+    "#define UINT_MAX (INT_MAX * 2U + 1U)\n"
+    "#define LONG_MAX __LONG_MAX__\n"
+    "#define LONG_MIN (-LONG_MAX - 1L)\n"
+    "#define ULONG_MAX (LONG_MAX * 2UL + 1UL)\n"
+    "#define LLONG_MAX __LONG_LONG_MAX__\n"
+    "#define LLONG_MIN (-LLONG_MAX - 1LL)\n"
+    "#define ULLONG_MAX (LLONG_MAX * 2ULL + 1ULL)\n"
+    "#endif\n" }
+};
+
+static bool is_identifier_start(char ch)
+{
+  return isalpha(ch) || ch=='_' || ch=='$' ||
+         static_cast<unsigned char>(ch)>=0x80;
+}
+
+static bool is_identifier_char(char ch)
+{
+  return is_identifier_start(ch) || isdigit(ch);
+}
+
+/// the punctuators, longest first
+static const char *punctuators[]=
+{
+  "%:%:", "...", "<<=", ">>=",
+  "->", "++", "--", "<<", ">>", "<=", ">=", "==", "!=", "&&", "||",
+  "*=", "/=", "%=", "+=", "-=", "&=", "^=", "|=", "##",
+  "<:", ":>", "<%", "%>", "%:",
+  nullptr
+};
+
+/// Lexes a single preprocessing token that starts at pos, which must not
+/// be white space or a comment.
+/// \return false if the token is not complete, in which case the first
+///   character is returned as a token
+bool c_builtin_preprocessort::lex_token(
+  const std::string &text,
+  std::size_t &pos,
+  tokent &token)
+{
+  const std::size_t start=pos;
+  const char ch=text[pos];
+
+  auto peek=[&text](std::size_t p) -> char
+  {
+    return p<text.size()?text[p]:0;
+  };
+
+  // string and character literals, with an optional prefix
+  std::size_t quote=std::string::npos;
+
+  if(ch=='"' || ch=='\'')
+    quote=pos;
+  else if((ch=='L' || ch=='U' || ch=='u') &&
+          (peek(pos+1)=='"' || peek(pos+1)=='\''))
+    quote=pos+1;
+  else if(ch=='u' && peek(pos+1)=='8' && peek(pos+2)=='"')
+    quote=pos+2;
+
+  if(quote!=std::string::npos)
+  {
+    const char delimiter=text[quote];
+    std::size_t p=quote+1;
+
+    while(p<text.size() && text[p]!=delimiter && text[p]!='\n')
+      p+=(text[p]=='\\' && p+1<text.size() && text[p+1]!='\n')?2:1;
+
+    if(p<text.size() && text[p]==delimiter)
+    {
+      pos=p+1;
+      token.kind=delimiter=='"'?
+        token_kindt::STRING_LITERAL:token_kindt::CHAR_LITERAL;
+      token.text=text.substr(start, pos-start);
+      return true;
+    }
+
+    if(quote==start)
+    {
+      // unterminated, e.g., an apostrophe in a skipped group
+      pos=start+1;
+      token.kind=token_kindt::OTHER;
+      token.text=std::string(1, ch);
+      return false;
+    }
+
+    // the prefix is just an identifier
+  }
+
+  if(is_identifier_start(ch))
+  {
+    while(pos<text.size() && is_identifier_char(text[pos]))
+      pos++;
+
+    token.kind=token_kindt::IDENTIFIER;
+    token.text=text.substr(start, pos-start);
+    return true;
+  }
+
+  if(isdigit(ch) || (ch=='.' && isdigit(peek(pos+1))))
+  {
+    pos++;
+
+    while(pos<text.size())
+    {
+      const char c=text[pos];
+
+      if((c=='+' || c=='-') &&
+         strchr("eEpP", text[pos-1])!=nullptr)
+        pos++;
+      else if(is_identifier_char(c) || c=='.')
+        pos++;
+      else
+        break;
+    }
+
+    token.kind=token_kindt::NUMBER;
+    token.text=text.substr(start, pos-start);
+    return true;
+  }
+
+  for(const char **p=punctuators; *p!=nullptr; p++)
+  {
+    const std::size_t length=strlen(*p);
+
+    if(text.compare(pos, length, *p)==0)
+    {
+      pos+=length;
+      token.kind=token_kindt::PUNCTUATOR;
+      token.text=*p;
+
+      // digraphs
+      if(token.text=="%:")
+        token.text="#";
+      else if(token.text=="%:%:")
+        token.text="##";
+      else if(token.text=="<:")
+        token.text="[";
+      else if(token.text==":>")
+        token.text="]";
+      else if(token.text=="<%")
+        token.text="{";
+      else if(token.text=="%>")
+        token.text="}";
+
+      return true;
+    }
+  }
+
+  pos++;
+
+  token.text=std::string(1, ch);
+  token.kind=strchr("[](){}.&*+-~!/%<>^|?:;=,#", ch)!=nullptr?
+    token_kindt::PUNCTUATOR:token_kindt::OTHER;
+
+  return true;
+}
+
+/// removes backslash-newline sequences
+std::string c_builtin_preprocessort::remove_splices(
+  const std::string &text,
+  std::vector<std::size_t> &splices)
+{
+  std::string result;
+  result.reserve(text.size());
+
+  for(std::size_t i=0; i<text.size(); i++)
+  {
+    if(text[i]=='\\')
+    {
+      std::size_t j=i+1;
+
+      // tolerate white space after the backslash, as gcc does
+      while(j<text.size() && (text[j]==' ' || text[j]=='\t' ||
+                              text[j]=='\r'))
+        j++;
+
+      if(j<text.size() && text[j]=='\n')
+      {
+        splices.push_back(result.size());
+        i=j;
+        continue;
+      }
+    }
+
+    if(text[i]=='\r' && i+1<text.size() && text[i+1]=='\n')
+      continue;
+
+    result+=text[i];
+  }
+
+  // the last line need not end in a newline
+  if(!result.empty() && result.back()!='\n')
+    result+='\n';
+
+  return result;
+}
+
+/// advances to the given position, counting lines
+void c_builtin_preprocessort::skip_to(filet &f, std::size_t pos)
+{
+  for(; f.pos<pos; f.pos++)
+    if(f.text[f.pos]=='\n')
+      f.line++;
+
+  while(f.splice_index<f.splices.size() &&
+        f.splices[f.splice_index]<=f.pos)
+  {
+    f.line++;
+    f.splice_index++;
+  }
+}
+
+/// reads the tokens of the next line, which ends with a newline that is
+/// not within a comment
+/// \return false at the end of the file
+bool c_builtin_preprocessort::get_line(filet &f, tokenst &tokens)
+{
+  tokens.clear();
+
+  if(f.pos>=f.text.size())
+    return false;
+
+  bool space=false;
+
+  while(f.pos<f.text.size())
+  {
+    const char ch=f.text[f.pos];
+
+    if(ch=='\n')
+    {
+      skip_to(f, f.pos+1);
+      return true;
+    }
+    else if(ch==' ' || ch=='\t' || ch=='\f' || ch=='\v' || ch=='\r')
+    {
+      skip_to(f, f.pos+1);
+      space=true;
+    }
+    else if(ch=='/' && f.text.compare(f.pos, 2, "/*")==0)
+    {
+      const unsigned line=f.line;
+      std::size_t end=f.text.find("*/", f.pos+2);
+
+      if(end==std::string::npos)
+      {
+        error(line, "unterminated comment");
+        skip_to(f, f.text.size()-1);
+      }
+      else
+        skip_to(f, end+2);
+
+      space=true;
+    }
+    else if(ch=='/' && f.text.compare(f.pos, 2, "//")==0)
+    {
+      skip_to(f, f.text.find('\n', f.pos));
+      space=true;
+    }
+    else
+    {
+      tokent token;
+      token.space_before=space;
+      token.line=f.line;
+
+      std::size_t pos=f.pos;
+      lex_token(f.text, pos, token);
+      skip_to(f, pos);
+
+      tokens.push_back(token);
+      space=false;
+    }
+  }
+
+  return true;
+}
+
+/// get_line, but takes a line read ahead into account
+bool c_builtin_preprocessort::read_line(filet &f, tokenst &tokens)
+{
+  if(f.has_lookahead)
+  {
+    f.has_lookahead=false;
+    tokens.swap(f.lookahead);
+    return true;
+  }
+
+  return get_line(f, tokens);
+}
+
+bool c_builtin_preprocessort::read_file(
+  const std::string &path,
+  std::string &text)
+{
+  #ifdef _MSC_VER
+  std::ifstream in(widen(path), std::ios::binary);
+  #else
+  std::ifstream in(path, std::ios::binary);
+  #endif
+
+  if(!in)
+    return false;
+
+  std::ostringstream data;
+  data << in.rdbuf();
+  text=data.str();
+
+  return true;
+}
+
+std::string c_builtin_preprocessort::quote(const std::string &src)
+{
+  std::string result="\"";
+
+  for(const char ch : src)
+  {
+    if(ch=='"' || ch=='\\')
+      result+='\\';
+    result+=ch;
+  }
+
+  return result+'"';
+}
+
+void c_builtin_preprocessort::error(unsigned line, const std::string &msg)
+{
+  source_locationt location;
+
+  if(!file_stack.empty())
+    location.set_file(file_stack.back()->presumed_name);
+  location.set_line(line);
+
+  messaget::error().source_location=location;
+  messaget::error() << msg << eom;
+
+  error_found=true;
+}
+
+void c_builtin_preprocessort::warning(
+  unsigned line,
+  const std::string &msg)
+{
+  // as with gcc, there are no warnings for system headers
+  if(!file_stack.empty() &&
+     file_stack.back()->dir_index!=std::string::npos &&
+     file_stack.back()->dir_index>=include_paths.size())
+    return;
+
+  source_locationt location;
+
+  if(!file_stack.empty())
+    location.set_file(file_stack.back()->presumed_name);
+  location.set_line(line);
+
+  messaget::warning().source_location=location;
+  messaget::warning() << msg << eom;
+}
+
+/// emits a line marker unless a few newlines get us to the given line
+void c_builtin_preprocessort::sync(
+  const std::string &file,
+  unsigned line,
+  int flag)
+{
+  if(flag!=0 || file!=out_file || line<out_line || line>out_line+8)
+  {
+    out << "# " << line << ' ' << quote(file);
+    if(flag!=0)
+      out << ' ' << flag;
+    out << '\n';
+
+    out_file=file;
+    out_line=line;
+  }
+  else
+  {
+    for(; out_line<line; out_line++)
+      out << '\n';
+  }
+}
+
+/// writes tokens, separating those that would otherwise form a different
+/// token
+void c_builtin_preprocessort::output(const tokenst &tokens)
+{
+  const tokent *previous=nullptr;
+
+  for(const auto &t : tokens)
+  {
+    if(previous!=nullptr)
+    {
+      const bool words=
+        (previous->kind==token_kindt::IDENTIFIER ||
+         previous->kind==token_kindt::NUMBER) &&
+        (t.kind==token_kindt::IDENTIFIER ||
+         t.kind==token_kindt::NUMBER);
+
+      const bool operators=
+        previous->kind!=token_kindt::IDENTIFIER &&
+        t.kind==token_kindt::PUNCTUATOR &&
+        strchr("+-*/%<>=&|^!.:#", t.text[0])!=nullptr;
+
+      if(t.space_before || words || operators)
+        out << ' ';
+    }
+
+    out << t.text;
+    previous=&t;
+  }
+
+  out << '\n';
+  out_line++;
+}
+
+void c_builtin_preprocessort::preprocessor()
+{
+  // the search path, with the built-in headers at the end
+  search_path.assign(include_paths.begin(), include_paths.end());
+  search_path.insert(
+    search_path.end(),
+    system_include_paths.begin(),
+    system_include_paths.end());
+
+  macros["__FILE__"].kind=macro_kindt::FILE;
+  macros["__LINE__"].kind=macro_kindt::LINE;
+  macros["__COUNTER__"].kind=macro_kindt::COUNTER;
+  macros["__INCLUDE_LEVEL__"].kind=macro_kindt::INCLUDE_LEVEL;
+  macros["__BASE_FILE__"].kind=macro_kindt::BASE_FILE;
+  macros["__has_include"].kind=macro_kindt::HAS_INCLUDE;
+  macros["__has_include_next"].kind=macro_kindt::HAS_INCLUDE_NEXT;
+
+  // __DATE__ and __TIME__
+  {
+    char date[32], time_of_day[32];
+    std::time_t now=std::time(nullptr);
+    std::strftime(date, sizeof(date), "%b %e %Y", std::localtime(&now));
+    std::strftime(
+      time_of_day, sizeof(time_of_day), "%H:%M:%S", std::localtime(&now));
+    defines.push_front(std::string("__TIME__=\"")+time_of_day+"\"");
+    defines.push_front(std::string("__DATE__=\"")+date+"\"");
+  }
+
+  defines.push_front("__STDC_HOSTED__=1");
+  defines.push_front("__STDC__=1");
+
+  // The command line is processed like a file.
+  std::string command_line;
+
+  for(const auto &d : defines)
+  {
+    std::size_t eq=d.find('=');
+    if(eq==std::string::npos)
+      command_line+="#define "+d+" 1\n";
+    else
+      command_line+="#define "+d.substr(0, eq)+" "+d.substr(eq+1)+"\n";
+  }
+
+  for(const auto &u : undefines)
+    command_line+="#undef "+u+"\n";
+
+  for(const auto &i : include_files)
+    command_line+="#include "+quote(i)+"\n";
+
+  out << "# 1 " << quote(filename) << '\n';
+  out_file=filename;
+  out_line=1;
+
+  // neither is found on the search path
+  if(include_file("", "<command-line>", command_line, std::string::npos))
+    return;
+
+  std::ostringstream data;
+  data << in.rdbuf();
+
+  include_file(filename, filename, data.str(), std::string::npos);
+}
+
+/// \return true on error
+bool c_builtin_preprocessort::include_file(
+  const std::string &path,
+  const std::string &presumed_name,
+  const std::string &text,
+  std::size_t dir_index)
+{
+  if(file_stack.size()>=200)
+  {
+    error(
+      file_stack.back()->line-1,
+      "#include nested too deeply");
+    return true;
+  }
+
+  filet f;
+  f.path=path;
+  f.presumed_name=presumed_name;
+  f.text=remove_splices(text, f.splices);
+  f.dir_index=dir_index;
+  f.conditional_depth=conditionals.size();
+
+  file_stack.push_back(&f);
+
+  // the main file and the command line are not included from anywhere
+  const bool nested=file_stack.size()>1;
+
+  if(nested)
+    sync(presumed_name, 1, 1);
+
+  process_file(f);
+
+  if(conditionals.size()>f.conditional_depth)
+  {
+    error(f.line, "unterminated conditional directive");
+    conditionals.resize(f.conditional_depth);
+  }
+
+  file_stack.pop_back();
+
+  if(nested)
+    sync(file_stack.back()->presumed_name, file_stack.back()->line, 2);
+
+  return false;
+}
+
+void c_builtin_preprocessort::process_file(filet &f)
+{
+  tokenst tokens;
+
+  while(read_line(f, tokens))
+  {
+    if(!tokens.empty() && tokens.front().is("#"))
+      directive(f, tokens);
+    else if(!skipping() && !tokens.empty())
+      text_line(f, tokens);
+  }
+}
+
+/// macro-expands a line of text, and reads more lines when the arguments
+/// of a macro continue on them
+void c_builtin_preprocessort::text_line(filet &f, tokenst &tokens)
+{
+  const unsigned line=tokens.front().line;
+
+  std::deque<tokent> input(tokens.begin(), tokens.end());
+
+  auto more=[this, &f, &input](bool arguments) -> bool
+  {
+    tokenst next;
+
+    while(true)
+    {
+      if(!get_line(f, next))
+        return false;
+
+      if(!next.empty() && next.front().is("#"))
+      {
+        // As gcc does, directives within the arguments of a macro are
+        // processed, but a directive ends the search for the arguments.
+        if(!arguments)
+        {
+          f.has_lookahead=true;
+          f.lookahead.swap(next);
+          return false;
+        }
+
+        directive(f, next);
+        continue;
+      }
+
+      if(!next.empty() && !skipping())
+        break;
+    }
+
+    next.front().space_before=true;
+    input.insert(input.end(), next.begin(), next.end());
+    return true;
+  };
+
+  tokenst result;
+  expand(input, more, result, false);
+
+  sync(f.presumed_name, line);
+
+  // the _Pragma operator yields a #pragma directive
+  tokenst current;
+
+  for(std::size_t i=0; i<result.size(); i++)
+  {
+    if(result[i].is("_Pragma") &&
+       i+3<result.size() &&
+       result[i+1].is("(") &&
+       result[i+2].kind==token_kindt::STRING_LITERAL &&
+       result[i+3].is(")"))
+    {
+      if(!current.empty())
+      {
+        output(current);
+        current.clear();
+      }
+
+      std::string text=result[i+2].text;
+      text=text.substr(text.find('"')+1);
+      text.resize(text.size()-1);
+
+      out << "#pragma ";
+      for(std::size_t j=0; j<text.size(); j++)
+      {
+        if(text[j]=='\\' && j+1<text.size() &&
+           (text[j+1]=='"' || text[j+1]=='\\'))
+          j++;
+        out << text[j];
+      }
+      out << '\n';
+      out_line++;
+
+      i+=3;
+    }
+    else
+      current.push_back(result[i]);
+  }
+
+  if(!current.empty())
+    output(current);
+}
+
+void c_builtin_preprocessort::directive(filet &f, tokenst &tokens)
+{
+  const unsigned line=tokens.front().line;
+
+  // the null directive
+  if(tokens.size()==1)
+    return;
+
+  const tokent &name=tokens[1];
+
+  // line markers, as in the output of a preprocessor
+  if(name.kind==token_kindt::NUMBER)
+  {
+    if(!skipping())
+      line_directive(f, tokens, 1);
+    return;
+  }
+
+  const std::string &d=name.text;
+
+  if(d=="if" || d=="ifdef" || d=="ifndef")
+  {
+    conditionalt c;
+    c.parent_active=!skipping();
+    c.else_seen=false;
+
+    bool value=false;
+
+    if(c.parent_active)
+    {
+      if(d=="if")
+        value=evaluate(tokens);
+      else if(tokens.size()<3 ||
+              tokens[2].kind!=token_kindt::IDENTIFIER)
+        error(line, "no macro name given in #"+d+" directive");
+      else
+      {
+        value=macros.find(tokens[2].text)!=macros.end();
+        if(d=="ifndef")
+          value=!value;
+      }
+    }
+
+    c.active=c.parent_active && value;
+    c.taken=c.active;
+    conditionals.push_back(c);
+  }
+  else if(d=="elif")
+  {
+    if(conditionals.size()<=f.conditional_depth)
+    {
+      error(line, "#elif without #if");
+      return;
+    }
+
+    conditionalt &c=conditionals.back();
+
+    if(c.else_seen)
+      error(line, "#elif after #else");
+
+    if(!c.parent_active || c.taken)
+      c.active=false;
+    else
+    {
+      c.active=evaluate(tokens);
+      c.taken=c.active;
+    }
+  }
+  else if(d=="else")
+  {
+    if(conditionals.size()<=f.conditional_depth)
+    {
+      error(line, "#else without #if");
+      return;
+    }
+
+    conditionalt &c=conditionals.back();
+
+    if(c.else_seen)
+      error(line, "#else after #else");
+
+    c.else_seen=true;
+    c.active=c.parent_active && !c.taken;
+    c.taken=true;
+  }
+  else if(d=="endif")
+  {
+    if(conditionals.size()<=f.conditional_depth)
+    {
+      error(line, "#endif without #if");
+      return;
+    }
+
+    conditionals.pop_back();
+  }
+  else if(skipping())
+  {
+    // all other directives are ignored in skipped groups
+  }
+  else if(d=="define")
+    define(tokens);
+  else if(d=="undef")
+  {
+    if(tokens.size()<3 || tokens[2].kind!=token_kindt::IDENTIFIER)
+      error(line, "no macro name given in #undef directive");
+    else
+      macros.erase(tokens[2].text);
+  }
+  else if(d=="include" || d=="import")
+    include(tokens, false);
+  else if(d=="include_next")
+    include(tokens, file_stack.size()>1);
+  else if(d=="line")
+    line_directive(f, tokens, 2);
+  else if(d=="pragma")
+    pragma(f, tokens);
+  else if(d=="error" || d=="warning")
+  {
+    std::string msg="#"+d;
+    for(std::size_t i=2; i<tokens.size(); i++)
+      msg+=" "+tokens[i].text;
+
+    if(d=="error")
+      error(line, msg);
+    else
+      warning(line, msg);
+  }
+  else if(d=="ident" || d=="sccs" || d=="assert" || d=="unassert")
+  {
+    // ignored
+  }
+  else
+    error(line, "invalid preprocessing directive #"+d);
+}
+
+void c_builtin_preprocessort::define(const tokenst &tokens)
+{
+  const unsigned line=tokens.front().line;
+
+  if(tokens.size()<3 || tokens[2].kind!=token_kindt::IDENTIFIER)
+  {
+    error(line, "macro names must be identifiers");
+    return;
+  }
+
+  const std::string &name=tokens[2].text;
+
+  if(name=="defined")
+  {
+    error(line, "\"defined\" cannot be used as a macro name");
+    return;
+  }
+
+  macrot macro;
+  std::size_t i=3;
+
+  // a parenthesis right after the name starts the parameters
+  if(i<tokens.size() && tokens[i].is("(") && !tokens[i].space_before)
+  {
+    macro.kind=macro_kindt::FUNCTION;
+    i++;
+
+    bool ok=false;
+
+    while(i<tokens.size())
+    {
+      if(tokens[i].is(")") && macro.parameters.empty())
+      {
+        i++;
+        ok=true;
+        break;
+      }
+
+      if(tokens[i].is("..."))
+      {
+        macro.parameters.push_back("__VA_ARGS__");
+        macro.variadic=true;
+        i++;
+      }
+      else if(tokens[i].kind==token_kindt::IDENTIFIER)
+      {
+        macro.parameters.push_back(tokens[i].text);
+        i++;
+
+        // GNU named variadic parameter
+        if(i<tokens.size() && tokens[i].is("..."))
+        {
+          macro.variadic=true;
+          i++;
+        }
+      }
+      else
+        break;
+
+      if(i<tokens.size() && tokens[i].is(")"))
+      {
+        i++;
+        ok=true;
+        break;
+      }
+
+      if(macro.variadic ||
+         i>=tokens.size() ||
+         !tokens[i].is(","))
+        break;
+
+      i++;
+    }
+
+    if(!ok)
+    {
+      error(line, "malformed parameter list of macro "+name);
+      return;
+    }
+  }
+
+  macro.body.assign(tokens.begin()+i, tokens.end());
+
+  for(std::size_t j=0; j<macro.body.size(); j++)
+  {
+    tokent &t=macro.body[j];
+
+    if(t.is("##"))
+    {
+      if(j==0 || j+1==macro.body.size())
+      {
+        error(line, "'##' cannot appear at either end of a macro");
+        return;
+      }
+
+      t.is_paste=true;
+    }
+    else if(t.is("#") && macro.kind==macro_kindt::FUNCTION)
+    {
+      if(j+1==macro.body.size() ||
+         std::find(
+           macro.parameters.begin(),
+           macro.parameters.end(),
+           macro.body[j+1].text)==macro.parameters.end())
+      {
+        error(line, "'#' is not followed by a macro parameter");
+        return;
+      }
+    }
+  }
+
+  if(!macro.body.empty())
+    macro.body.front().space_before=false;
+
+  macrost::iterator m_it=macros.find(name);
+
+  if(m_it!=macros.end())
+  {
+    const macrot &old=m_it->second;
+
+    bool same=
+      old.kind==macro.kind &&
+      old.parameters==macro.parameters &&
+      old.variadic==macro.variadic &&
+      old.body.size()==macro.body.size();
+
+    for(std::size_t j=0; same && j<macro.body.size(); j++)
+      same=old.body[j].text==macro.body[j].text &&
+           old.body[j].space_before==macro.body[j].space_before;
+
+    if(!same)
+      warning(line, "\""+name+"\" redefined");
+  }
+
+  macros[name]=macro;
+}
+
+void c_builtin_preprocessort::include(
+  tokenst &tokens,
+  bool next)
+{
+  const unsigned line=tokens.front().line;
+
+  tokenst operand(tokens.begin()+2, tokens.end());
+
+  // a computed include
+  if(!operand.empty() &&
+     operand.front().kind!=token_kindt::STRING_LITERAL &&
+     !operand.front().is("<"))
+  {
+    std::deque<tokent> input(operand.begin(), operand.end());
+    operand.clear();
+    expand(input, [](bool){ return false; }, operand, false);
+  }
+
+  std::string name;
+  bool angle;
+
+  if(!operand.empty() &&
+     operand.front().kind==token_kindt::STRING_LITERAL &&
+     operand.front().text[0]=='"')
+  {
+    name=operand.front().text.substr(1, operand.front().text.size()-2);
+    angle=false;
+  }
+  else if(!operand.empty() && operand.front().is("<"))
+  {
+    std::size_t i=1;
+    for(; i<operand.size() && !operand[i].is(">"); i++)
+    {
+      if(operand[i].space_before && i>1)
+        name+=' ';
+      name+=operand[i].text;
+    }
+
+    if(i==operand.size())
+    {
+      error(line, "missing terminating > character");
+      return;
+    }
+
+    angle=true;
+  }
+  else
+  {
+    error(line, "#include expects \"FILENAME\" or <FILENAME>");
+    return;
+  }
+
+  std::string path, text;
+  std::size_t dir_index;
+
+  if(!find_include(name, angle, next, path, text, dir_index))
+  {
+    error(line, name+": No such file or directory");
+    return;
+  }
+
+  if(once_files.find(path)!=once_files.end())
+    return;
+
+  include_file(path, path, text, dir_index);
+}
+
+/// \return true if the file is found
+bool c_builtin_preprocessort::find_include(
+  const std::string &name,
+  bool angle,
+  bool next,
+  std::string &path,
+  std::string &text,
+  std::size_t &dir_index)
+{
+  const filet &current=*file_stack.back();
+
+  if(!name.empty() && (name[0]=='/' || name[0]=='\\' ||
+                       (name.size()>1 && name[1]==':')))
+  {
+    path=name;
+    dir_index=current.dir_index;
+    return read_file(path, text);
+  }
+
+  std::size_t start=0;
+
+  if(next)
+    start=current.dir_index+1; // 0 for npos
+  else if(!angle)
+  {
+    // the directory of the current file
+    std::string dir;
+    std::size_t slash=current.path.find_last_of("/\\");
+    if(slash!=std::string::npos)
+      dir=current.path.substr(0, slash+1);
+
+    path=dir+name;
+
+    if(read_file(path, text))
+    {
+      dir_index=current.dir_index;
+      return true;
+    }
+  }
+
+  for(std::size_t i=start; i<search_path.size(); i++)
+  {
+    path=concat_dir_file(search_path[i], name);
+
+    if(read_file(path, text))
+    {
+      dir_index=i;
+      return true;
+    }
+  }
+
+  std::map<std::string, std::string>::const_iterator h_it=
+    builtin_headers.find(name);
+
+  if(h_it!=builtin_headers.end() && start<=search_path.size())
+  {
+    path="<built-in>/"+name;
+    text=h_it->second;
+    dir_index=search_path.size();
+    return true;
+  }
+
+  return false;
+}
+
+void c_builtin_preprocessort::line_directive(
+  filet &f,
+  tokenst &tokens,
+  std::size_t first)
+{
+  const unsigned line=tokens.front().line;
+
+  std::deque<tokent> input(tokens.begin()+first, tokens.end());
+  tokenst operand;
+
+  if(first==1)
+    operand.assign(input.begin(), input.end());
+  else
+    expand(input, [](bool){ return false; }, operand, false);
+
+  if(operand.empty() || operand.front().kind!=token_kindt::NUMBER)
+  {
+    error(line, "#line directive requires a simple digit sequence");
+    return;
+  }
+
+  f.line=std::stoul(operand.front().text);
+
+  if(operand.size()>=2 &&
+     operand[1].kind==token_kindt::STRING_LITERAL &&
+     operand[1].text[0]=='"')
+  {
+    const std::string &s=operand[1].text;
+    std::string name;
+
+    for(std::size_t i=1; i+1<s.size(); i++)
+    {
+      if(s[i]=='\\' && i+2<s.size())
+        i++;
+      name+=s[i];
+    }
+
+    f.presumed_name=name;
+  }
+
+  sync(f.presumed_name, f.line);
+}
+
+void c_builtin_preprocessort::pragma(filet &f, const tokenst &tokens)
+{
+  if(tokens.size()>=3 && tokens[2].is("once"))
+  {
+    once_files.insert(f.path);
+    return;
+  }
+
+  if(tokens.size()>=4 &&
+     tokens[2].is("GCC") &&
+     (tokens[3].is("system_header") || tokens[3].is("poison") ||
+      tokens[3].is("dependency")))
+    return;
+
+  // other pragmas go to the parser
+  sync(f.presumed_name, tokens.front().line);
+
+  out << "#pragma ";
+  output(tokenst(tokens.begin()+2, tokens.end()));
+}
+
+/// expands the built-in macros
+/// \return true if the macro is built in
+bool c_builtin_preprocessort::expand_builtin(
+  const tokent &t,
+  const macrot &macro,
+  tokenst &dest)
+{
+  tokent result;
+  result.space_before=t.space_before;
+  result.line=t.line;
+  result.kind=token_kindt::NUMBER;
+
+  const filet &f=*file_stack.back();
+
+  switch(macro.kind)
+  {
+  case macro_kindt::FILE:
+    result.kind=token_kindt::STRING_LITERAL;
+    result.text=quote(f.presumed_name);
+    break;
+
+  case macro_kindt::LINE:
+    result.text=std::to_string(t.line);
+    break;
+
+  case macro_kindt::COUNTER:
+    result.text=std::to_string(counter++);
+    break;
+
+  case macro_kindt::INCLUDE_LEVEL:
+    result.text=std::to_string(file_stack.size()-1);
+    break;
+
+  case macro_kindt::BASE_FILE:
+    result.kind=token_kindt::STRING_LITERAL;
+    result.text=quote(filename);
+    break;
+
+  case macro_kindt::HAS_INCLUDE:
+  case macro_kindt::HAS_INCLUDE_NEXT:
+    error(t.line, "\""+t.text+"\" used outside of preprocessing directive");
+    return true;
+
+  case macro_kindt::OBJECT:
+  case macro_kindt::FUNCTION:
+    return false;
+  }
+
+  dest.push_back(result);
+  return true;
+}
+
+/// Expands the macros in the input (Prosser's algorithm). The given
+/// function is called to obtain more input when the arguments of a
+/// macro call continue beyond the end of the input.
+void c_builtin_preprocessort::expand(
+  std::deque<tokent> &input,
+  const std::function<bool(bool)> &more,
+  tokenst &output,
+  bool in_if)
+{
+  while(!input.empty())
+  {
+    tokent t=input.front();
+    input.pop_front();
+
+    if(t.kind!=token_kindt::IDENTIFIER || t.no_expand)
+    {
+      output.push_back(t);
+      continue;
+    }
+
+    // the operand of defined is not expanded
+    if(in_if &&
+       (t.text=="defined" ||
+        t.text=="__has_include" ||
+        t.text=="__has_include_next"))
+    {
+      output.push_back(t);
+
+      if(!input.empty() && input.front().is("("))
+      {
+        while(!input.empty())
+        {
+          tokent operand=input.front();
+          input.pop_front();
+          operand.no_expand=true;
+          output.push_back(operand);
+          if(operand.is(")"))
+            break;
+        }
+      }
+      else if(!input.empty())
+      {
+        input.front().no_expand=true;
+        output.push_back(input.front());
+        input.pop_front();
+      }
+
+      continue;
+    }
+
+    macrost::const_iterator m_it=macros.find(t.text);
+
+    if(m_it==macros.end() ||
+       t.hide_set.find(t.text)!=t.hide_set.end())
+    {
+      output.push_back(t);
+      continue;
+    }
+
+    const macrot &macro=m_it->second;
+
+    if(expand_builtin(t, macro, output))
+      continue;
+
+    std::set<std::string> hide_set;
+    tokenst expansion;
+
+    if(macro.kind==macro_kindt::OBJECT)
+    {
+      hide_set=t.hide_set;
+      hide_set.insert(t.text);
+      expansion=substitute(macro, std::vector<tokenst>(), in_if);
+    }
+    else
+    {
+      // a function-like macro needs arguments
+      if(input.empty() && !more(false))
+      {
+        output.push_back(t);
+        continue;
+      }
+
+      if(!input.front().is("("))
+      {
+        output.push_back(t);
+        continue;
+      }
+
+      input.pop_front();
+
+      std::vector<tokenst> arguments(1);
+      std::size_t depth=1;
+      tokent rparen;
+      tokenst consumed;
+
+      while(depth>0)
+      {
+        if(input.empty() && !more(true))
+          break;
+
+        tokent a=input.front();
+        input.pop_front();
+        consumed.push_back(a);
+
+        if(a.is("("))
+          depth++;
+        else if(a.is(")"))
+          depth--;
+
+        if(depth==0)
+          rparen=a;
+        else if(depth==1 && a.is(","))
+          arguments.push_back(tokenst());
+        else
+          arguments.back().push_back(a);
+      }
+
+      if(depth>0)
+      {
+        error(t.line, "unterminated argument list invoking macro \""+
+              t.text+"\"");
+        output.push_back(t);
+        output.insert(output.end(), consumed.begin(), consumed.end());
+        continue;
+      }
+
+      const std::size_t parameters=macro.parameters.size();
+
+      // f() has no arguments
+      if(parameters==0 && arguments.size()==1 && arguments[0].empty())
+        arguments.clear();
+
+      if(macro.variadic)
+      {
+        // the variable arguments may be omitted
+        if(arguments.size()==parameters-1)
+          arguments.push_back(tokenst());
+
+        // and are joined by commas
+        while(arguments.size()>parameters && parameters>0)
+        {
+          tokent comma;
+          comma.kind=token_kindt::PUNCTUATOR;
+          comma.text=",";
+          comma.line=t.line;
+
+          tokenst &last=arguments[arguments.size()-2];
+          last.push_back(comma);
+          last.insert(
+            last.end(), arguments.back().begin(), arguments.back().end());
+          arguments.pop_back();
+        }
+      }
+
+      if(arguments.size()!=parameters)
+      {
+        error(
+          t.line,
+          "macro \""+t.text+"\" passed "+
+          std::to_string(arguments.size())+" arguments, but takes "+
+          std::to_string(parameters));
+        output.push_back(t);
+        continue;
+      }
+
+      std::set_intersection(
+        t.hide_set.begin(), t.hide_set.end(),
+        rparen.hide_set.begin(), rparen.hide_set.end(),
+        std::inserter(hide_set, hide_set.begin()));
+      hide_set.insert(t.text);
+
+      expansion=substitute(macro, arguments, in_if);
+    }
+
+    for(auto &e : expansion)
+    {
+      e.hide_set.insert(hide_set.begin(), hide_set.end());
+      e.line=t.line;
+    }
+
+    if(!expansion.empty())
+      expansion.front().space_before=t.space_before;
+    else if(!input.empty())
+      input.front().space_before|=t.space_before;
+
+    input.insert(input.begin(), expansion.begin(), expansion.end());
+  }
+}
+
+c_builtin_preprocessort::tokent c_builtin_preprocessort::stringize(
+  const tokenst &tokens,
+  bool space_before)
+{
+  std::string text="\"";
+
+  for(std::size_t i=0; i<tokens.size(); i++)
+  {
+    const tokent &t=tokens[i];
+
+    if(i!=0 && t.space_before)
+      text+=' ';
+
+    if(t.kind==token_kindt::STRING_LITERAL ||
+       t.kind==token_kindt::CHAR_LITERAL)
+    {
+      for(const char ch : t.text)
+      {
+        if(ch=='"' || ch=='\\')
+          text+='\\';
+        text+=ch;
+      }
+    }
+    else
+      text+=t.text;
+  }
+
+  text+='"';
+
+  tokent result;
+  result.kind=token_kindt::STRING_LITERAL;
+  result.text=text;
+  result.space_before=space_before;
+
+  return result;
+}
+
+/// pastes two tokens, which must form a single token
+void c_builtin_preprocessort::paste(
+  const tokent &lhs,
+  const tokent &rhs,
+  tokenst &dest)
+{
+  if(lhs.kind==token_kindt::PLACEMARKER)
+  {
+    dest.push_back(rhs);
+    dest.back().space_before=lhs.space_before;
+    return;
+  }
+
+  if(rhs.kind==token_kindt::PLACEMARKER)
+  {
+    dest.push_back(lhs);
+    return;
+  }
+
+  const std::string text=lhs.text+rhs.text;
+  std::size_t pos=0;
+  tokent result;
+
+  if(lex_token(text, pos, result) && pos==text.size())
+  {
+    result.space_before=lhs.space_before;
+    result.line=lhs.line;
+    dest.push_back(result);
+  }
+  else
+  {
+    error(
+      lhs.line,
+      "pasting \""+lhs.text+"\" and \""+rhs.text+
+      "\" does not give a valid preprocessing token");
+    dest.push_back(lhs);
+    dest.push_back(rhs);
+  }
+}
+
+/// replaces the parameters in the body of a macro, and applies the #
+/// and ## operators
+c_builtin_preprocessort::tokenst c_builtin_preprocessort::substitute(
+  const macrot &macro,
+  const std::vector<tokenst> &arguments,
+  bool in_if)
+{
+  const tokenst &body=macro.body;
+
+  auto parameter=[&macro](const tokent &t) -> std::size_t
+  {
+    if(macro.kind!=macro_kindt::FUNCTION ||
+       t.kind!=token_kindt::IDENTIFIER)
+      return std::string::npos;
+
+    std::vector<std::string>::const_iterator p_it=
+      std::find(macro.parameters.begin(), macro.parameters.end(), t.text);
+
+    if(p_it==macro.parameters.end())
+      return std::string::npos;
+
+    return p_it-macro.parameters.begin();
+  };
+
+  tokenst result;
+
+  for(std::size_t i=0; i<body.size(); i++)
+  {
+    const tokent &t=body[i];
+    const bool paste_before=i>0 && body[i-1].is_paste;
+    const bool paste_after=i+1<body.size() && body[i+1].is_paste;
+
+    if(macro.kind==macro_kindt::FUNCTION && t.is("#") && !t.is_paste)
+    {
+      std::size_t p=parameter(body[i+1]);
+      result.push_back(stringize(arguments[p], t.space_before));
+      i++;
+      continue;
+    }
+
+    // the GNU extension , ## __VA_ARGS__ drops the comma if there are
+    // no variable arguments
+    if(t.is(",") && paste_after && i+2<body.size() && macro.variadic &&
+       parameter(body[i+2])==macro.parameters.size()-1)
+    {
+      const tokenst &va_args=arguments.back();
+
+      if(!va_args.empty())
+      {
+        result.push_back(t);
+        result.insert(result.end(), va_args.begin(), va_args.end());
+      }
+
+      i+=2;
+      continue;
+    }
+
+    std::size_t p=parameter(t);
+
+    if(p!=std::string::npos)
+    {
+      const tokenst &argument=arguments[p];
+      const std::size_t start=result.size();
+
+      if(paste_before || paste_after)
+      {
+        if(argument.empty())
+        {
+          tokent placemarker;
+          placemarker.kind=token_kindt::PLACEMARKER;
+          result.push_back(placemarker);
+        }
+        else
+          result.insert(result.end(), argument.begin(), argument.end());
+      }
+      else
+      {
+        std::deque<tokent> input(argument.begin(), argument.end());
+        expand(input, [](bool){ return false; }, result, in_if);
+      }
+
+      if(result.size()>start)
+        result[start].space_before=t.space_before;
+
+      continue;
+    }
+
+    result.push_back(t);
+  }
+
+  // the ## operator
+  tokenst pasted;
+
+  for(std::size_t i=0; i<result.size(); i++)
+  {
+    if(result[i].is_paste && !pasted.empty() && i+1<result.size())
+    {
+      tokent lhs=pasted.back();
+      pasted.pop_back();
+      paste(lhs, result[i+1], pasted);
+      i++;
+    }
+    else
+      pasted.push_back(result[i]);
+  }
+
+  tokenst dest;
+  dest.reserve(pasted.size());
+
+  for(auto &t : pasted)
+  {
+    if(t.kind!=token_kindt::PLACEMARKER)
+    {
+      t.is_paste=false;
+      dest.push_back(t);
+    }
+  }
+
+  return dest;
+}
+
+/// \return whether the file named by the tokens starting at i, which
+///   follow __has_include, can be found
+bool c_builtin_preprocessort::has_include(
+  const tokenst &tokens,
+  std::size_t &i,
+  bool next)
+{
+  if(i>=tokens.size() || !tokens[i].is("("))
+    return false;
+
+  i++;
+
+  std::string name;
+  bool angle=false;
+
+  if(i<tokens.size() && tokens[i].kind==token_kindt::STRING_LITERAL)
+  {
+    name=tokens[i].text.substr(1, tokens[i].text.size()-2);
+    i++;
+  }
+  else if(i<tokens.size() && tokens[i].is("<"))
+  {
+    angle=true;
+    for(i++; i<tokens.size() && !tokens[i].is(">"); i++)
+      name+=tokens[i].text;
+    i++;
+  }
+
+  if(i<tokens.size() && tokens[i].is(")"))
+    i++;
+
+  std::string path, text;
+  std::size_t dir_index;
+
+  return find_include(name, angle, next, path, text, dir_index);
+}
+
+/// the constant expressions of #if
+class c_builtin_preprocessor_expressiont
+{
+public:
+  typedef c_builtin_preprocessort::tokent tokent;
+  typedef c_builtin_preprocessort::tokenst tokenst;
+
+  c_builtin_preprocessor_expressiont(
+    const tokenst &_tokens,
+    bool _char_is_unsigned):
+    tokens(_tokens),
+    char_is_unsigned(_char_is_unsigned),
+    index(0)
+  {
+  }
+
+  struct valuet
+  {
+    long long value;
+    bool is_unsigned;
+
+    valuet():value(0), is_unsigned(false)
+    {
+    }
+
+    valuet(long long _value, bool _is_unsigned):
+      value(_value), is_unsigned(_is_unsigned)
+    {
+    }
+  };
+
+  /// \return true on error
+  bool operator()(valuet &result)
+  {
+    result=conditional(true);
+
+    if(error.empty() && index<tokens.size())
+      error="missing binary operator before token \""+
+            tokens[index].text+"\"";
+
+    return !error.empty();
+  }
+
+  std::string error;
+
+protected:
+  const tokenst &tokens;
+  const bool char_is_unsigned;
+  std::size_t index;
+
+  bool next_is(const char *s) const
+  {
+    return index<tokens.size() &&
+           tokens[index].kind==
+             c_builtin_preprocessort::token_kindt::PUNCTUATOR &&
+           tokens[index].text==s;
+  }
+
+  static int precedence(const std::string &op)
+  {
+    if(op=="||")
+      return 1;
+    else if(op=="&&")
+      return 2;
+    else if(op=="|")
+      return 3;
+    else if(op=="^")
+      return 4;
+    else if(op=="&")
+      return 5;
+    else if(op=="==" || op=="!=")
+      return 6;
+    else if(op=="<" || op==">" || op=="<=" || op==">=")
+      return 7;
+    else if(op=="<<" || op==">>")
+      return 8;
+    else if(op=="+" || op=="-")
+      return 9;
+    else if(op=="*" || op=="/" || op=="%")
+      return 10;
+    else
+      return 0;
+  }
+
+  valuet conditional(bool evaluate)
+  {
+    valuet c=binary(1, evaluate);
+
+    if(!next_is("?"))
+      return c;
+
+    index++;
+
+    valuet t=conditional(evaluate && c.value!=0);
+
+    if(!next_is(":"))
+    {
+      if(error.empty())
+        error="'?' without following ':'";
+      return c;
+    }
+
+    index++;
+
+    valuet f=conditional(evaluate && c.value==0);
+
+    valuet result=c.value!=0?t:f;
+    result.is_unsigned=t.is_unsigned || f.is_unsigned;
+
+    return result;
+  }
+
+  valuet binary(int min_precedence, bool evaluate)
+  {
+    valuet lhs=unary(evaluate);
+
+    while(index<tokens.size() &&
+          tokens[index].kind==
+            c_builtin_preprocessort::token_kindt::PUNCTUATOR)
+    {
+      const std::string op=tokens[index].text;
+      const int p=precedence(op);
+
+      if(p==0 || p<min_precedence)
+        break;
+
+      index++;
+
+      if(op=="&&" || op=="||")
+      {
+        const bool short_circuit=(op=="&&")==(lhs.value==0);
+        valuet rhs=binary(p+1, evaluate && !short_circuit);
+
+        if(op=="&&")
+          lhs=valuet(lhs.value!=0 && rhs.value!=0, false);
+        else
+          lhs=valuet(lhs.value!=0 || rhs.value!=0, false);
+
+        continue;
+      }
+
+      valuet rhs=binary(p+1, evaluate);
+      lhs=apply(op, lhs, rhs, evaluate);
+    }
+
+    return lhs;
+  }
+
+  valuet apply(
+    const std::string &op,
+    const valuet &lhs,
+    const valuet &rhs,
+    bool evaluate)
+  {
+    const bool u=lhs.is_unsigned || rhs.is_unsigned;
+    const unsigned long long a=lhs.value, b=rhs.value;
+
+    if(op=="<<" || op==">>")
+    {
+      const long long shift=rhs.value;
+
+      if(shift<0 || shift>=64)
+        return valuet(0, lhs.is_unsigned);
+
+      if(op=="<<")
+        return valuet(a<<shift, lhs.is_unsigned);
+      else if(lhs.is_unsigned)
+        return valuet(a>>shift, true);
+      else
+        return valuet(lhs.value>>shift, false);
+    }
+
+    if(op=="/" || op=="%")
+    {
+      if(rhs.value==0)
+      {
+        if(evaluate && error.empty())
+          error="division by zero in #if";
+        return valuet(0, u);
+      }
+
+      if(u)
+        return valuet(op=="/"?a/b:a%b, true);
+      else if(lhs.value==LLONG_MIN && rhs.value==-1)
+        return valuet(op=="/"?lhs.value:0, false);
+      else
+        return valuet(
+          op=="/"?lhs.value/rhs.value:lhs.value%rhs.value, false);
+    }
+
+    if(op=="+")
+      return valuet(a+b, u);
+    else if(op=="-")
+      return valuet(a-b, u);
+    else if(op=="*")
+      return valuet(a*b, u);
+    else if(op=="&")
+      return valuet(a&b, u);
+    else if(op=="|")
+      return valuet(a|b, u);
+    else if(op=="^")
+      return valuet(a^b, u);
+    else if(op=="==")
+      return valuet(a==b, false);
+    else if(op=="!=")
+      return valuet(a!=b, false);
+    else if(op=="<")
+      return valuet(u?a<b:lhs.value<rhs.value, false);
+    else if(op==">")
+      return valuet(u?a>b:lhs.value>rhs.value, false);
+    else if(op=="<=")
+      return valuet(u?a<=b:lhs.value<=rhs.value, false);
+    else // >=
+      return valuet(u?a>=b:lhs.value>=rhs.value, false);
+  }
+
+  valuet unary(bool evaluate)
+  {
+    if(index>=tokens.size())
+    {
+      if(error.empty())
+        error="#if with no expression";
+      return valuet();
+    }
+
+    const tokent &t=tokens[index];
+    index++;
+
+    if(t.kind==c_builtin_preprocessort::token_kindt::PUNCTUATOR)
+    {
+      if(t.text=="(")
+      {
+        valuet v=conditional(evaluate);
+        if(next_is(")"))
+          index++;
+        else if(error.empty())
+          error="missing ')' in expression";
+        return v;
+      }
+      else if(t.text=="+")
+        return unary(evaluate);
+      else if(t.text=="-")
+      {
+        valuet v=unary(evaluate);
+        return valuet(0-static_cast<unsigned long long>(v.value),
+                      v.is_unsigned);
+      }
+      else if(t.text=="~")
+      {
+        valuet v=unary(evaluate);
+        return valuet(~v.value, v.is_unsigned);
+      }
+      else if(t.text=="!")
+      {
+        valuet v=unary(evaluate);
+        return valuet(v.value==0, false);
+      }
+    }
+    else if(t.kind==c_builtin_preprocessort::token_kindt::NUMBER)
+      return number(t.text);
+    else if(t.kind==c_builtin_preprocessort::token_kindt::CHAR_LITERAL)
+      return character(t.text);
+
+    if(error.empty())
+      error="token \""+t.text+"\" is not valid in preprocessor expressions";
+
+    return valuet();
+  }
+
+  valuet number(const std::string &text)
+  {
+    std::size_t end=text.size();
+    bool is_unsigned=false;
+
+    while(end>0 && strchr("uUlL", text[end-1])!=nullptr)
+    {
+      if(text[end-1]=='u' || text[end-1]=='U')
+        is_unsigned=true;
+      end--;
+    }
+
+    const std::string digits=text.substr(0, end);
+    unsigned long long value=0;
+    int base=10;
+    std::size_t i=0;
+
+    if(digits.size()>1 && digits[0]=='0' &&
+       (digits[1]=='x' || digits[1]=='X'))
+    {
+      base=16;
+      i=2;
+    }
+    else if(digits.size()>1 && digits[0]=='0' &&
+            (digits[1]=='b' || digits[1]=='B'))
+    {
+      base=2;
+      i=2;
+    }
+    else if(digits.size()>1 && digits[0]=='0')
+      base=8;
+
+    if(i==digits.size())
+    {
+      if(error.empty())
+        error="invalid integer constant \""+text+"\" in #if";
+      return valuet();
+    }
+
+    for(; i<digits.size(); i++)
+    {
+      const char ch=tolower(digits[i]);
+      int digit;
+
+      if(isdigit(ch))
+        digit=ch-'0';
+      else if(ch>='a' && ch<='f')
+        digit=ch-'a'+10;
+      else
+        digit=base;
+
+      if(digit>=base)
+      {
+        if(error.empty())
+          error="invalid integer constant \""+text+"\" in #if";
+        return valuet();
+      }
+
+      value=value*base+digit;
+    }
+
+    // too large for intmax_t
+    if(value>static_cast<unsigned long long>(LLONG_MAX))
+      is_unsigned=true;
+
+    return valuet(value, is_unsigned);
+  }
+
+  valuet character(const std::string &text)
+  {
+    const std::size_t start=text.find('\'')+1;
+    const bool wide=start>1;
+    long long value=0;
+    std::size_t count=0;
+
+    for(std::size_t i=start; i+1<text.size(); i++)
+    {
+      unsigned long long c=static_cast<unsigned char>(text[i]);
+
+      if(text[i]=='\\' && i+2<text.size())
+      {
+        i++;
+        const char e=text[i];
+
+        switch(e)
+        {
+        case 'n': c='\n'; break;
+        case 't': c='\t'; break;
+        case 'r': c='\r'; break;
+        case 'a': c='\a'; break;
+        case 'b': c='\b'; break;
+        case 'f': c='\f'; break;
+        case 'v': c='\v'; break;
+        case 'e': c=27; break;
+        case 'x':
+          c=0;
+          while(i+2<text.size() && isxdigit(text[i+1]))
+          {
+            i++;
+            c=c*16+(isdigit(text[i])?text[i]-'0':tolower(text[i])-'a'+10);
+          }
+          break;
+        default:
+          if(e>='0' && e<='7')
+          {
+            c=e-'0';
+            for(int n=0; n<2 && i+2<text.size() &&
+                         text[i+1]>='0' && text[i+1]<='7'; n++)
+            {
+              i++;
+              c=c*8+(text[i]-'0');
+            }
+          }
+          else
+            c=static_cast<unsigned char>(e);
+        }
+      }
+
+      value=wide?c:((value<<8)|(c&0xff));
+      count++;
+    }
+
+    // a plain char may be signed
+    if(!wide && !char_is_unsigned && count==1 && value>=128)
+      value-=256;
+
+    return valuet(value, false);
+  }
+};
+
+/// evaluates the condition of #if or #elif
+bool c_builtin_preprocessort::evaluate(tokenst &tokens)
+{
+  const unsigned line=tokens.front().line;
+
+  std::deque<tokent> input(tokens.begin()+2, tokens.end());
+  tokenst expanded;
+  expand(input, [](bool){ return false; }, expanded, true);
+
+  tokenst expression;
+
+  for(std::size_t i=0; i<expanded.size(); i++)
+  {
+    const tokent &t=expanded[i];
+
+    if(t.kind!=token_kindt::IDENTIFIER)
+    {
+      expression.push_back(t);
+      continue;
+    }
+
+    tokent value;
+    value.kind=token_kindt::NUMBER;
+    value.line=t.line;
+    value.text="0";
+
+    if(t.text=="defined")
+    {
+      i++;
+      bool parenthesis=false;
+
+      if(i<expanded.size() && expanded[i].is("("))
+      {
+        parenthesis=true;
+        i++;
+      }
+
+      if(i>=expanded.size() ||
+         expanded[i].kind!=token_kindt::IDENTIFIER)
+      {
+        error(line, "operator \"defined\" requires an identifier");
+        return false;
+      }
+
+      if(macros.find(expanded[i].text)!=macros.end())
+        value.text="1";
+
+      if(parenthesis)
+      {
+        i++;
+        if(i>=expanded.size() || !expanded[i].is(")"))
+        {
+          error(line, "missing ')' after \"defined\"");
+          return false;
+        }
+      }
+    }
+    else if(t.text=="__has_include" || t.text=="__has_include_next")
+    {
+      i++;
+      if(has_include(expanded, i, t.text=="__has_include_next" &&
+                                  file_stack.size()>1))
+        value.text="1";
+      i--;
+    }
+    else if(t.text=="true" || t.text=="false")
+    {
+      // C++ only, as are all other identifiers
+      if(t.text=="true")
+        value.text="1";
+    }
+
+    expression.push_back(value);
+  }
+
+  c_builtin_preprocessor_expressiont expr(expression, char_is_unsigned);
+  c_builtin_preprocessor_expressiont::valuet result;
+
+  if(expr(result))
+  {
+    error(line, expr.error);
+    return false;
+  }
+
+  return result.value!=0;
+}
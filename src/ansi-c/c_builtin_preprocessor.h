@@ -0,0 +1,254 @@
+/*******************************************************************\
+
+Module: Built-in C Preprocessor
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Built-in C Preprocessor
+
+#ifndef CPROVER_ANSI_C_C_BUILTIN_PREPROCESSOR_H
+#define CPROVER_ANSI_C_C_BUILTIN_PREPROCESSOR_H
+
+#include <deque>
+#include <functional>
+#include <list>
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <util/preprocessor.h>
+
+/// A C preprocessor that runs within the process, which avoids starting
+/// an external preprocessor for every file. The output uses the line
+/// markers that gcc produces. Macro expansion follows Prosser's
+/// algorithm, and supports the GNU extensions for variadic macros.
+/// The headers that the compiler would provide (stddef.h, stdarg.h and
+/// the like) are built in.
+class c_builtin_preprocessort:public preprocessort
+{
+public:
+  c_builtin_preprocessort(
+    std::istream &_in,
+    std::ostream &_out,
+    message_handlert &_message_handler,
+    const std::string &_filename):
+    preprocessort(_in, _out, _message_handler, _filename),
+    char_is_unsigned(false),
+    error_found(false),
+    counter(0),
+    out_line(0)
+  {
+  }
+
+  // as given to -D, that is, NAME or NAME=VALUE
+  std::list<std::string> defines;
+  std::list<std::string> undefines;
+
+  std::list<std::string> include_paths;
+  std::list<std::string> system_include_paths;
+
+  // as given to -include
+  std::list<std::string> include_files;
+
+  // for character constants in #if
+  bool char_is_unsigned;
+
+  bool error_found;
+
+  void preprocessor() override;
+
+protected:
+  enum class token_kindt
+  {
+    IDENTIFIER,
+    NUMBER,
+    CHAR_LITERAL,
+    STRING_LITERAL,
+    PUNCTUATOR,
+    OTHER,
+    PLACEMARKER
+  };
+
+  struct tokent
+  {
+    token_kindt kind;
+    std::string text;
+    bool space_before;
+    // the ## operator in the body of a macro
+    bool is_paste;
+    // the operand of defined in #if
+    bool no_expand;
+    unsigned line;
+    std::set<std::string> hide_set;
+
+    tokent():
+      kind(token_kindt::OTHER),
+      space_before(false),
+      is_paste(false),
+      no_expand(false),
+      line(0)
+    {
+    }
+
+    bool is(const char *s) const
+    {
+      return (kind==token_kindt::PUNCTUATOR ||
+              kind==token_kindt::IDENTIFIER) &&
+             text==s;
+    }
+  };
+
+  typedef std::vector<tokent> tokenst;
+
+  enum class macro_kindt
+  {
+    OBJECT,
+    FUNCTION,
+    FILE,
+    LINE,
+    COUNTER,
+    INCLUDE_LEVEL,
+    BASE_FILE,
+    HAS_INCLUDE,
+    HAS_INCLUDE_NEXT
+  };
+
+  struct macrot
+  {
+    macro_kindt kind;
+    std::vector<std::string> parameters;
+    bool variadic;
+    tokenst body;
+
+    macrot():kind(macro_kindt::OBJECT), variadic(false)
+    {
+    }
+  };
+
+  typedef std::unordered_map<std::string, macrot> macrost;
+  macrost macros;
+
+  struct filet
+  {
+    // as opened, and as reported by line markers and __FILE__
+    std::string path, presumed_name;
+    // the text without line splices
+    std::string text;
+    // the positions in text at which line splices were removed
+    std::vector<std::size_t> splices;
+    std::size_t pos, splice_index;
+    unsigned line;
+    // the entry of the search path the file was found in, or npos
+    // for files not found on the search path
+    std::size_t dir_index;
+    // the depth of the conditional stack when the file was entered
+    std::size_t conditional_depth;
+    // a line that has been read ahead
+    bool has_lookahead;
+    tokenst lookahead;
+
+    filet():
+      pos(0),
+      splice_index(0),
+      line(1),
+      dir_index(0),
+      conditional_depth(0),
+      has_lookahead(false)
+    {
+    }
+  };
+
+  std::list<filet *> file_stack;
+
+  struct conditionalt
+  {
+    // whether the current group is processed, whether any group was,
+    // and whether #else has been seen
+    bool active, taken, else_seen;
+    bool parent_active;
+  };
+
+  std::vector<conditionalt> conditionals;
+
+  std::vector<std::string> search_path;
+  std::set<std::string> once_files;
+  std::size_t counter;
+
+  std::string out_file;
+  unsigned out_line;
+
+  // lexing
+  static bool lex_token(
+    const std::string &text,
+    std::size_t &pos,
+    tokent &token);
+  void skip_to(filet &, std::size_t pos);
+  bool get_line(filet &, tokenst &);
+  bool read_line(filet &, tokenst &);
+  static std::string remove_splices(
+    const std::string &text,
+    std::vector<std::size_t> &splices);
+
+  // files
+  void process_file(filet &);
+  bool include_file(
+    const std::string &path,
+    const std::string &presumed_name,
+    const std::string &text,
+    std::size_t dir_index);
+  bool find_include(
+    const std::string &name,
+    bool angle,
+    bool next,
+    std::string &path,
+    std::string &text,
+    std::size_t &dir_index);
+  static bool read_file(const std::string &path, std::string &text);
+
+  // directives
+  void directive(filet &, tokenst &);
+  void define(const tokenst &);
+  void include(tokenst &, bool next);
+  void line_directive(filet &, tokenst &, std::size_t first);
+  void pragma(filet &, const tokenst &);
+  bool skipping() const
+  {
+    return !conditionals.empty() && !conditionals.back().active;
+  }
+
+  // expansion
+  void expand(
+    std::deque<tokent> &input,
+    const std::function<bool(bool)> &more,
+    tokenst &output,
+    bool in_if);
+  bool expand_builtin(const tokent &, const macrot &, tokenst &);
+  tokenst substitute(
+    const macrot &,
+    const std::vector<tokenst> &arguments,
+    bool in_if);
+  static tokent stringize(const tokenst &, bool space_before);
+  void paste(const tokent &lhs, const tokent &rhs, tokenst &dest);
+  void text_line(filet &, tokenst &);
+
+  // #if
+  bool evaluate(tokenst &);
+  bool has_include(const tokenst &, std::size_t &i, bool next);
+
+  // output
+  void sync(const std::string &file, unsigned line, int flag=0);
+  void output(const tokenst &);
+  static std::string quote(const std::string &);
+
+  void error(unsigned line, const std::string &);
+  void warning(unsigned line, const std::string &);
+
+  friend class c_builtin_preprocessor_expressiont;
+};
+
+#endif // CPROVER_ANSI_C_C_BUILTIN_PREPROCESSOR_H
@@ -8,6 +8,7 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "c_preprocess.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -22,6 +23,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #endif
 
 #include <fstream>
+#include <list>
 
 #include <util/c_types.h>
 #include <util/config.h>
@@ -32,69 +34,91 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/std_types.h>
 #include <util/prefix.h>
 
-#define GCC_DEFINES_16 \
-  " -D__INT_MAX__=32767"\
-  " -D__CHAR_BIT__=8"\
-  " -D__SCHAR_MAX__=127"\
-  " -D__SHRT_MAX__=32767"\
-  " -D__INT32_TYPE__=long"\
-  " -D__LONG_LONG_MAX__=2147483647L"\
-  " -D__LONG_MAX__=2147483647" \
-  " -D__SIZE_TYPE__=\"unsigned int\""\
-  " -D__PTRDIFF_TYPE__=int"\
-  " -D__WINT_TYPE__=\"unsigned int\""\
-  " -D__INTMAX_TYPE__=\"long long int\""\
-  " -D__UINTMAX_TYPE__=\"long long unsigned int\""\
-  " -D__INTPTR_TYPE__=\"int\""\
-  " -D__UINTPTR_TYPE__=\"unsigned int\""
-
-#define GCC_DEFINES_32 \
-  " -D__INT_MAX__=2147483647"\
-  " -D__CHAR_BIT__=8"\
-  " -D__SCHAR_MAX__=127"\
-  " -D__SHRT_MAX__=32767"\
-  " -D__INT32_TYPE__=int"\
-  " -D__LONG_LONG_MAX__=9223372036854775807LL"\
-  " -D__LONG_MAX__=2147483647L" \
-  " -D__SIZE_TYPE__=\"long unsigned int\""\
-  " -D__PTRDIFF_TYPE__=int"\
-  " -D__WINT_TYPE__=\"unsigned int\""\
-  " -D__INTMAX_TYPE__=\"long long int\""\
-  " -D__UINTMAX_TYPE__=\"long long unsigned int\""\
-  " -D__INTPTR_TYPE__=\"long int\""\
-  " -D__UINTPTR_TYPE__=\"long unsigned int\""
-
-#define GCC_DEFINES_LP64 \
-  " -D__INT_MAX__=2147483647"\
-  " -D__CHAR_BIT__=8"\
-  " -D__SCHAR_MAX__=127"\
-  " -D__SHRT_MAX__=32767"\
-  " -D__INT32_TYPE__=int"\
-  " -D__LONG_LONG_MAX__=9223372036854775807LL"\
-  " -D__LONG_MAX__=9223372036854775807L"\
-  " -D__SIZE_TYPE__=\"long unsigned int\""\
-  " -D__PTRDIFF_TYPE__=long"\
-  " -D__WINT_TYPE__=\"unsigned int\""\
-  " -D__INTMAX_TYPE__=\"long int\""\
-  " -D__UINTMAX_TYPE__=\"long unsigned int\""\
-  " -D__INTPTR_TYPE__=\"long int\""\
-  " -D__UINTPTR_TYPE__=\"long unsigned int\""
-
-#define GCC_DEFINES_LLP64 \
-  " -D__INT_MAX__=2147483647"\
-  " -D__CHAR_BIT__=8"\
-  " -D__SCHAR_MAX__=127"\
-  " -D__SHRT_MAX__=32767"\
-  " -D__INT32_TYPE__=int"\
-  " -D__LONG_LONG_MAX__=9223372036854775807LL"\
-  " -D__LONG_MAX__=2147483647"\
-  " -D__SIZE_TYPE__=\"long long unsigned int\""\
-  " -D__PTRDIFF_TYPE__=\"long long\""\
-  " -D__WINT_TYPE__=\"unsigned int\""\
-  " -D__INTMAX_TYPE__=\"long long int\""\
-  " -D__UINTMAX_TYPE__=\"long long unsigned int\""\
-  " -D__INTPTR_TYPE__=\"long long int\""\
-  " -D__UINTPTR_TYPE__=\"long long unsigned int\""
+#include "c_builtin_preprocessor.h"
+
+static const char *gcc_defines_16[]=
+{
+  "__INT_MAX__=32767",
+  "__CHAR_BIT__=8",
+  "__SCHAR_MAX__=127",
+  "__SHRT_MAX__=32767",
+  "__INT32_TYPE__=long",
+  "__LONG_LONG_MAX__=2147483647L",
+  "__LONG_MAX__=2147483647",
+  "__SIZE_TYPE__=unsigned int",
+  "__PTRDIFF_TYPE__=int",
+  "__WINT_TYPE__=unsigned int",
+  "__INTMAX_TYPE__=long long int",
+  "__UINTMAX_TYPE__=long long unsigned int",
+  "__INTPTR_TYPE__=int",
+  "__UINTPTR_TYPE__=unsigned int",
+  nullptr
+};
+
+static const char *gcc_defines_32[]=
+{
+  "__INT_MAX__=2147483647",
+  "__CHAR_BIT__=8",
+  "__SCHAR_MAX__=127",
+  "__SHRT_MAX__=32767",
+  "__INT32_TYPE__=int",
+  "__LONG_LONG_MAX__=9223372036854775807LL",
+  "__LONG_MAX__=2147483647L",
+  "__SIZE_TYPE__=long unsigned int",
+  "__PTRDIFF_TYPE__=int",
+  "__WINT_TYPE__=unsigned int",
+  "__INTMAX_TYPE__=long long int",
+  "__UINTMAX_TYPE__=long long unsigned int",
+  "__INTPTR_TYPE__=long int",
+  "__UINTPTR_TYPE__=long unsigned int",
+  nullptr
+};
+
+static const char *gcc_defines_lp64[]=
+{
+  "__INT_MAX__=2147483647",
+  "__CHAR_BIT__=8",
+  "__SCHAR_MAX__=127",
+  "__SHRT_MAX__=32767",
+  "__INT32_TYPE__=int",
+  "__LONG_LONG_MAX__=9223372036854775807LL",
+  "__LONG_MAX__=9223372036854775807L",
+  "__SIZE_TYPE__=long unsigned int",
+  "__PTRDIFF_TYPE__=long",
+  "__WINT_TYPE__=unsigned int",
+  "__INTMAX_TYPE__=long int",
+  "__UINTMAX_TYPE__=long unsigned int",
+  "__INTPTR_TYPE__=long int",
+  "__UINTPTR_TYPE__=long unsigned int",
+  nullptr
+};
+
+static const char *gcc_defines_llp64[]=
+{
+  "__INT_MAX__=2147483647",
+  "__CHAR_BIT__=8",
+  "__SCHAR_MAX__=127",
+  "__SHRT_MAX__=32767",
+  "__INT32_TYPE__=int",
+  "__LONG_LONG_MAX__=9223372036854775807LL",
+  "__LONG_MAX__=2147483647",
+  "__SIZE_TYPE__=long long unsigned int",
+  "__PTRDIFF_TYPE__=long long",
+  "__WINT_TYPE__=unsigned int",
+  "__INTMAX_TYPE__=long long int",
+  "__UINTMAX_TYPE__=long long unsigned int",
+  "__INTPTR_TYPE__=long long int",
+  "__UINTPTR_TYPE__=long long unsigned int",
+  nullptr
+};
+
+static void add_defines(
+  const char **src,
+  std::list<std::string> &dest)
+{
+  for(; *src!=nullptr; src++)
+    dest.push_back(*src);
+}
 
 /// produce a string with the maximum value of a given type
 static std::string type_max(const typet &src)
@@ -159,6 +183,10 @@ static std::string shell_quote(const std::string &src)
      src.find('>')==std::string::npos &&
      src.find('<')==std::string::npos &&
      src.find('^')==std::string::npos &&
+     src.find('(')==std::string::npos &&
+     src.find(')')==std::string::npos &&
+     src.find(';')==std::string::npos &&
+     src.find('`')==std::string::npos &&
      src.find('\'')==std::string::npos)
   {
     // seems fine -- return as is
@@ -352,6 +380,16 @@ static bool is_dot_i_file(const std::string &path)
   return false;
 }
 
+/// \return true if the file is C++ source, judging by its extension
+static bool is_cpp_file(const std::string &path)
+{
+  const char *ext=strrchr(path.c_str(), '.');
+  if(ext==nullptr)
+    return false;
+  const std::string s(ext);
+  return s==".cpp" || s==".cc" || s==".cxx" || s==".c++" || s==".C";
+}
+
 /// ANSI-C preprocessing
 bool c_preprocess_codewarrior(
   const std::string &, std::ostream &, message_handlert &);
@@ -364,6 +402,8 @@ bool c_preprocess_gcc_clang(
   configt::ansi_ct::preprocessort);
 bool c_preprocess_none(
   const std::string &, std::ostream &, message_handlert &);
+bool c_preprocess_builtin(
+  const std::string &, std::ostream &, message_handlert &);
 bool c_preprocess_visual_studio(
   const std::string &, std::ostream &, message_handlert &);
 
@@ -395,6 +435,9 @@ bool c_preprocess(
 
   case configt::ansi_ct::preprocessort::NONE:
     return c_preprocess_none(path, outstream, message_handler);
+
+  case configt::ansi_ct::preprocessort::BUILTIN:
+    return c_preprocess_builtin(path, outstream, message_handler);
   }
 
   // not reached
@@ -617,190 +660,179 @@ bool c_preprocess_codewarrior(
   return false;
 }
 
-/// ANSI-C preprocessing
-bool c_preprocess_gcc_clang(
-  const std::string &file,
-  std::ostream &outstream,
-  message_handlert &message_handler,
-  configt::ansi_ct::preprocessort preprocessor)
+/// the macros that gcc would define for the configured target
+static void gcc_defines(
+  configt::ansi_ct::preprocessort preprocessor,
+  std::list<std::string> &defines)
 {
-  // check extension
-  if(is_dot_i_file(file))
-    return c_preprocess_none(file, outstream, message_handler);
-
-  // preprocessing
-  messaget message(message_handler);
-
-  std::string stderr_file=get_temporary_file("tmp.stderr", "");
-
-  std::string command;
-
-  if(preprocessor==configt::ansi_ct::preprocessort::CLANG)
-    command="clang";
-  else
-    command="gcc";
-
-  command +=" -E -undef -D__CPROVER__";
-
-  command+=" -D__WORDSIZE="+std::to_string(config.ansi_c.pointer_width);
-
-  command+=" -D__DBL_MIN_EXP__=\"(-1021)\"";
-  command+=" -D__FLT_MIN__=1.17549435e-38F";
-  command+=" -D__DEC64_SUBNORMAL_MIN__=0.000000000000001E-383DD";
-  command+=" -D__CHAR_BIT__=8";
-  command+=" -D__DBL_DENORM_MIN__=4.9406564584124654e-324";
-  command+=" -D__FLT_EVAL_METHOD__=0";
-  command+=" -D__DBL_MIN_10_EXP__=\"(-307)\"";
-  command+=" -D__FINITE_MATH_ONLY__=0";
-  command+=" -D__DEC64_MAX_EXP__=384";
-  command+=" -D__SHRT_MAX__=32767";
-  command+=" -D__LDBL_MAX__=1.18973149535723176502e+4932L";
-  command+=" -D__DEC32_EPSILON__=1E-6DF";
-  command+=" -D__SCHAR_MAX__=127";
-  command+=" -D__USER_LABEL_PREFIX__=_";
-  command+=" -D__DEC64_MIN_EXP__=\"(-383)\"";
-  command+=" -D__DBL_DIG__=15";
-  command+=" -D__FLT_EPSILON__=1.19209290e-7F";
-  command+=" -D__LDBL_MIN__=3.36210314311209350626e-4932L";
-  command+=" -D__DEC32_MAX__=9.999999E96DF";
-  command+=" -D__DECIMAL_DIG__=21";
-  command+=" -D__LDBL_HAS_QUIET_NAN__=1";
-  command+=" -D__DYNAMIC__=1";
-  command+=" -D__GNUC__=4";
-  command+=" -D__FLT_HAS_DENORM__=1";
-  command+=" -D__DBL_MAX__=1.7976931348623157e+308";
-  command+=" -D__DBL_HAS_INFINITY__=1";
-  command+=" -D__DEC32_MIN_EXP__=\"(-95)\"";
-  command+=" -D__LDBL_HAS_DENORM__=1";
-  command+=" -D__DEC32_MIN__=1E-95DF";
-  command+=" -D__DBL_MAX_EXP__=1024";
-  command+=" -D__DEC128_EPSILON__=1E-33DL";
-  command+=" -D__SSE2_MATH__=1";
-  command+=" -D__GXX_ABI_VERSION=1002";
-  command+=" -D__FLT_MIN_EXP__=\"(-125)\"";
-  command+=" -D__DBL_MIN__=2.2250738585072014e-308";
-  command+=" -D__DBL_HAS_QUIET_NAN__=1";
-  command+=" -D__DEC128_MIN__=1E-6143DL";
-  command+=" -D__REGISTER_PREFIX__=";
-  command+=" -D__DBL_HAS_DENORM__=1";
-  command+=" -D__DEC_EVAL_METHOD__=2";
-  command+=" -D__DEC128_MAX__=9.999999999999999999999999999999999E6144DL";
-  command+=" -D__FLT_MANT_DIG__=24";
-  command+=" -D__DEC64_EPSILON__=1E-15DD";
-  command+=" -D__DEC128_MIN_EXP__=\"(-6143)\"";
-  command+=" -D__DEC32_SUBNORMAL_MIN__=0.000001E-95DF";
-  command+=" -D__FLT_RADIX__=2";
-  command+=" -D__LDBL_EPSILON__=1.08420217248550443401e-19L";
-  command+=" -D__k8=1";
-  command+=" -D__LDBL_DIG__=18";
-  command+=" -D__FLT_HAS_QUIET_NAN__=1";
-  command+=" -D__FLT_MAX_10_EXP__=38";
-  command+=" -D__FLT_HAS_INFINITY__=1";
-  command+=" -D__DEC64_MAX__=9.999999999999999E384DD";
-  command+=" -D__DEC64_MANT_DIG__=16";
-  command+=" -D__DEC32_MAX_EXP__=96";
+  defines.push_back("__CPROVER__");
+
+  defines.push_back(
+    "__WORDSIZE="+std::to_string(config.ansi_c.pointer_width));
+
+  defines.push_back("__DBL_MIN_EXP__=(-1021)");
+  defines.push_back("__FLT_MIN__=1.17549435e-38F");
+  defines.push_back("__DEC64_SUBNORMAL_MIN__=0.000000000000001E-383DD");
+  defines.push_back("__CHAR_BIT__=8");
+  defines.push_back("__DBL_DENORM_MIN__=4.9406564584124654e-324");
+  defines.push_back("__FLT_EVAL_METHOD__=0");
+  defines.push_back("__DBL_MIN_10_EXP__=(-307)");
+  defines.push_back("__FINITE_MATH_ONLY__=0");
+  defines.push_back("__DEC64_MAX_EXP__=384");
+  defines.push_back("__SHRT_MAX__=32767");
+  defines.push_back("__LDBL_MAX__=1.18973149535723176502e+4932L");
+  defines.push_back("__DEC32_EPSILON__=1E-6DF");
+  defines.push_back("__SCHAR_MAX__=127");
+  defines.push_back("__USER_LABEL_PREFIX__=_");
+  defines.push_back("__DEC64_MIN_EXP__=(-383)");
+  defines.push_back("__DBL_DIG__=15");
+  defines.push_back("__FLT_EPSILON__=1.19209290e-7F");
+  defines.push_back("__LDBL_MIN__=3.36210314311209350626e-4932L");
+  defines.push_back("__DEC32_MAX__=9.999999E96DF");
+  defines.push_back("__DECIMAL_DIG__=21");
+  defines.push_back("__LDBL_HAS_QUIET_NAN__=1");
+  defines.push_back("__DYNAMIC__=1");
+  defines.push_back("__GNUC__=4");
+  defines.push_back("__FLT_HAS_DENORM__=1");
+  defines.push_back("__DBL_MAX__=1.7976931348623157e+308");
+  defines.push_back("__DBL_HAS_INFINITY__=1");
+  defines.push_back("__DEC32_MIN_EXP__=(-95)");
+  defines.push_back("__LDBL_HAS_DENORM__=1");
+  defines.push_back("__DEC32_MIN__=1E-95DF");
+  defines.push_back("__DBL_MAX_EXP__=1024");
+  defines.push_back("__DEC128_EPSILON__=1E-33DL");
+  defines.push_back("__SSE2_MATH__=1");
+  defines.push_back("__GXX_ABI_VERSION=1002");
+  defines.push_back("__FLT_MIN_EXP__=(-125)");
+  defines.push_back("__DBL_MIN__=2.2250738585072014e-308");
+  defines.push_back("__DBL_HAS_QUIET_NAN__=1");
+  defines.push_back("__DEC128_MIN__=1E-6143DL");
+  defines.push_back("__REGISTER_PREFIX__=");
+  defines.push_back("__DBL_HAS_DENORM__=1");
+  defines.push_back("__DEC_EVAL_METHOD__=2");
+  // NOLINTNEXTLINE(whitespace/line_length)
+  defines.push_back("__DEC128_MAX__=9.999999999999999999999999999999999E6144DL");
+  defines.push_back("__FLT_MANT_DIG__=24");
+  defines.push_back("__DEC64_EPSILON__=1E-15DD");
+  defines.push_back("__DEC128_MIN_EXP__=(-6143)");
+  defines.push_back("__DEC32_SUBNORMAL_MIN__=0.000001E-95DF");
+  defines.push_back("__FLT_RADIX__=2");
+  defines.push_back("__LDBL_EPSILON__=1.08420217248550443401e-19L");
+  defines.push_back("__k8=1");
+  defines.push_back("__LDBL_DIG__=18");
+  defines.push_back("__FLT_HAS_QUIET_NAN__=1");
+  defines.push_back("__FLT_MAX_10_EXP__=38");
+  defines.push_back("__FLT_HAS_INFINITY__=1");
+  defines.push_back("__DEC64_MAX__=9.999999999999999E384DD");
+  defines.push_back("__DEC64_MANT_DIG__=16");
+  defines.push_back("__DEC32_MAX_EXP__=96");
   // NOLINTNEXTLINE(whitespace/line_length)
-  command+=" -D__DEC128_SUBNORMAL_MIN__=0.000000000000000000000000000000001E-6143DL";
-  command+=" -D__LDBL_MANT_DIG__=64";
-  command+=" -D__CONSTANT_CFSTRINGS__=1";
-  command+=" -D__DEC32_MANT_DIG__=7";
-  command+=" -D__k8__=1";
-  command+=" -D__pic__=2";
-  command+=" -D__FLT_DIG__=6";
-  command+=" -D__FLT_MAX_EXP__=128";
-  // command+=" -D__BLOCKS__=1";
-  command+=" -D__DBL_MANT_DIG__=53";
-  command+=" -D__DEC64_MIN__=1E-383DD";
-  command+=" -D__LDBL_MIN_EXP__=\"(-16381)\"";
-  command+=" -D__LDBL_MAX_EXP__=16384";
-  command+=" -D__LDBL_MAX_10_EXP__=4932";
-  command+=" -D__DBL_EPSILON__=2.2204460492503131e-16";
-  command+=" -D__GNUC_PATCHLEVEL__=1";
-  command+=" -D__LDBL_HAS_INFINITY__=1";
-  command+=" -D__INTMAX_MAX__=9223372036854775807L";
-  command+=" -D__FLT_DENORM_MIN__=1.40129846e-45F";
-  command+=" -D__PIC__=2";
-  command+=" -D__FLT_MAX__=3.40282347e+38F";
-  command+=" -D__FLT_MIN_10_EXP__=\"(-37)\"";
-  command+=" -D__DEC128_MAX_EXP__=6144";
-  command+=" -D__GNUC_MINOR__=2";
-  command+=" -D__DBL_MAX_10_EXP__=308";
-  command+=" -D__LDBL_DENORM_MIN__=3.64519953188247460253e-4951L";
-  command+=" -D__DEC128_MANT_DIG__=34";
-  command+=" -D__LDBL_MIN_10_EXP__=\"(-4931)\"";
+  defines.push_back("__DEC128_SUBNORMAL_MIN__=0.000000000000000000000000000000001E-6143DL");
+  defines.push_back("__LDBL_MANT_DIG__=64");
+  defines.push_back("__CONSTANT_CFSTRINGS__=1");
+  defines.push_back("__DEC32_MANT_DIG__=7");
+  defines.push_back("__k8__=1");
+  defines.push_back("__pic__=2");
+  defines.push_back("__FLT_DIG__=6");
+  defines.push_back("__FLT_MAX_EXP__=128");
+  // defines.push_back("__BLOCKS__=1");
+  defines.push_back("__DBL_MANT_DIG__=53");
+  defines.push_back("__DEC64_MIN__=1E-383DD");
+  defines.push_back("__LDBL_MIN_EXP__=(-16381)");
+  defines.push_back("__LDBL_MAX_EXP__=16384");
+  defines.push_back("__LDBL_MAX_10_EXP__=4932");
+  defines.push_back("__DBL_EPSILON__=2.2204460492503131e-16");
+  defines.push_back("__GNUC_PATCHLEVEL__=1");
+  defines.push_back("__LDBL_HAS_INFINITY__=1");
+  defines.push_back("__INTMAX_MAX__=9223372036854775807L");
+  defines.push_back("__FLT_DENORM_MIN__=1.40129846e-45F");
+  defines.push_back("__PIC__=2");
+  defines.push_back("__FLT_MAX__=3.40282347e+38F");
+  defines.push_back("__FLT_MIN_10_EXP__=(-37)");
+  defines.push_back("__DEC128_MAX_EXP__=6144");
+  defines.push_back("__GNUC_MINOR__=2");
+  defines.push_back("__DBL_MAX_10_EXP__=308");
+  defines.push_back("__LDBL_DENORM_MIN__=3.64519953188247460253e-4951L");
+  defines.push_back("__DEC128_MANT_DIG__=34");
+  defines.push_back("__LDBL_MIN_10_EXP__=(-4931)");
 
   if(preprocessor==configt::ansi_ct::preprocessort::CLANG)
   {
-    command+=" -D_Noreturn=\"__attribute__((__noreturn__))\"";
-    command+=" -D__llvm__";
-    command+=" -D__clang__";
+    defines.push_back("_Noreturn=__attribute__((__noreturn__))");
+    defines.push_back("__llvm__");
+    defines.push_back("__clang__");
   }
 
   if(config.ansi_c.int_width==16)
-    command+=GCC_DEFINES_16;
+    add_defines(gcc_defines_16, defines);
   else if(config.ansi_c.int_width==32)
   {
     if(config.ansi_c.pointer_width==64)
     {
       if(config.ansi_c.long_int_width==32)
-        command+=GCC_DEFINES_LLP64; // Windows, for instance
+        add_defines(gcc_defines_llp64, defines); // Windows, for instance
       else
-        command+=GCC_DEFINES_LP64;
+        add_defines(gcc_defines_lp64, defines);
     }
     else
-      command+=GCC_DEFINES_32;
+      add_defines(gcc_defines_32, defines);
   }
 
   // The width of wchar_t depends on the OS!
   {
-    command+=" -D__WCHAR_MAX__="+type_max(wchar_t_type());
+    defines.push_back("__WCHAR_MAX__="+type_max(wchar_t_type()));
 
     std::string sig=config.ansi_c.wchar_t_is_unsigned?"unsigned":"signed";
 
     if(config.ansi_c.wchar_t_width==config.ansi_c.short_int_width)
-      command+=" -D__WCHAR_TYPE__=\""+sig+" short int\"";
+      defines.push_back("__WCHAR_TYPE__="+sig+" short int");
     else if(config.ansi_c.wchar_t_width==config.ansi_c.int_width)
-      command+=" -D__WCHAR_TYPE__=\""+sig+" int\"";
+      defines.push_back("__WCHAR_TYPE__="+sig+" int");
     else if(config.ansi_c.wchar_t_width==config.ansi_c.long_int_width)
-      command+=" -D__WCHAR_TYPE__=\""+sig+" long int\"";
+      defines.push_back("__WCHAR_TYPE__="+sig+" long int");
     else if(config.ansi_c.wchar_t_width==config.ansi_c.char_width)
-      command+=" -D__WCHAR_TYPE__=\""+sig+" char\"";
+      defines.push_back("__WCHAR_TYPE__="+sig+" char");
     else
       assert(false);
   }
 
   if(config.ansi_c.char_is_unsigned)
-    command+=" -D __CHAR_UNSIGNED__"; // gcc
+    defines.push_back("__CHAR_UNSIGNED__"); // gcc
 
   switch(config.ansi_c.os)
   {
   case configt::ansi_ct::ost::OS_LINUX:
-    command+=" -Dlinux -D__linux -D__linux__ -D__gnu_linux__";
-    command+=" -Dunix -D__unix -D__unix__";
-    command+=" -D__USE_UNIX98";
+    defines.push_back("linux");
+    defines.push_back("__linux");
+    defines.push_back("__linux__");
+    defines.push_back("__gnu_linux__");
+    defines.push_back("unix");
+    defines.push_back("__unix");
+    defines.push_back("__unix__");
+    defines.push_back("__USE_UNIX98");
     break;
 
   case configt::ansi_ct::ost::OS_MACOS:
-    command+=" -D__APPLE__ -D__MACH__";
+    defines.push_back("__APPLE__");
+    defines.push_back("__MACH__");
     // needs to be __APPLE_CPP__ for C++
-    command+=" -D__APPLE_CC__";
+    defines.push_back("__APPLE_CC__");
     break;
 
   case configt::ansi_ct::ost::OS_WIN:
-    command+=" -D _WIN32";
+    defines.push_back("_WIN32");
 
     if(config.ansi_c.mode!=configt::ansi_ct::flavourt::VISUAL_STUDIO)
-      command+=" -D _M_IX86=Blend";
+      defines.push_back("_M_IX86=Blend");
 
     if(config.ansi_c.arch=="x86_64")
-      command+=" -D _WIN64"; // yes, both _WIN32 and _WIN64 get defined
+      defines.push_back("_WIN64"); // yes, both _WIN32 and _WIN64 get defined
 
     if(config.ansi_c.char_is_unsigned)
-      command+=" -D _CHAR_UNSIGNED"; // This is Visual Studio
+      defines.push_back("_CHAR_UNSIGNED"); // This is Visual Studio
     break;
 
   case configt::ansi_ct::ost::NO_OS:
-    command+=" -nostdinc"; // make sure we don't mess with the system library
     break;
 
   default:
@@ -814,17 +846,54 @@ bool c_preprocess_gcc_clang(
     break; // __STDC_VERSION__ is not defined
 
   case configt::ansi_ct::c_standardt::C99:
-    command += " -D __STDC_VERSION__=199901L";
+    defines.push_back("__STDC_VERSION__=199901L");
     break;
 
   case configt::ansi_ct::c_standardt::C11:
-    command += " -D __STDC_VERSION__=201112L";
+    defines.push_back("__STDC_VERSION__=201112L");
     break;
   }
 
-  command += " -D __STDC_IEC_559__=1";
-  command += " -D __STDC_IEC_559_COMPLEX__=1";
-  command += " -D __STDC_ISO_10646__=1";
+  defines.push_back("__STDC_IEC_559__=1");
+  defines.push_back("__STDC_IEC_559_COMPLEX__=1");
+  defines.push_back("__STDC_ISO_10646__=1");
+
+}
+
+/// ANSI-C preprocessing
+bool c_preprocess_gcc_clang(
+  const std::string &file,
+  std::ostream &outstream,
+  message_handlert &message_handler,
+  configt::ansi_ct::preprocessort preprocessor)
+{
+  // check extension
+  if(is_dot_i_file(file))
+    return c_preprocess_none(file, outstream, message_handler);
+
+  // preprocessing
+  messaget message(message_handler);
+
+  std::string stderr_file=get_temporary_file("tmp.stderr", "");
+
+  std::string command;
+
+  if(preprocessor==configt::ansi_ct::preprocessort::CLANG)
+    command="clang";
+  else
+    command="gcc";
+
+  command+=" -E -undef";
+
+  std::list<std::string> defines;
+  gcc_defines(preprocessor, defines);
+
+  for(const auto &define : defines)
+    command+=" "+shell_quote("-D"+define);
+
+  // make sure we don't mess with the system library
+  if(config.ansi_c.os==configt::ansi_ct::ost::NO_OS)
+    command+=" -nostdinc";
 
   for(const auto &define : config.ansi_c.defines)
     command+=" -D"+shell_quote(define);
@@ -921,6 +990,111 @@ bool c_preprocess_gcc_clang(
   return false;
 }
 
+/// ANSI-C preprocessing without an external preprocessor
+bool c_preprocess_builtin(
+  const std::string &file,
+  std::ostream &outstream,
+  message_handlert &message_handler)
+{
+  // check extension
+  if(is_dot_i_file(file))
+    return c_preprocess_none(file, outstream, message_handler);
+
+  // C++ needs __cplusplus and the C++ library headers, which the built-in
+  // preprocessor does not provide
+  if(is_cpp_file(file))
+    return
+      c_preprocess_gcc_clang(
+        file,
+        outstream,
+        message_handler,
+        configt::ansi_ct::preprocessort::GCC);
+
+  #ifdef _MSC_VER
+  std::ifstream infile(widen(file), std::ios::binary);
+  #else
+  std::ifstream infile(file, std::ios::binary);
+  #endif
+
+  if(!infile)
+  {
+    messaget message(message_handler);
+    message.error() << "failed to open `" << file << "'" << messaget::eom;
+    return true;
+  }
+
+  c_builtin_preprocessort preprocessor(
+    infile, outstream, message_handler, file);
+
+  gcc_defines(configt::ansi_ct::preprocessort::GCC, preprocessor.defines);
+
+  preprocessor.defines.insert(
+    preprocessor.defines.end(),
+    config.ansi_c.defines.begin(),
+    config.ansi_c.defines.end());
+  preprocessor.undefines=config.ansi_c.undefines;
+  preprocessor.include_paths=config.ansi_c.include_paths;
+  preprocessor.include_files=config.ansi_c.include_files;
+  preprocessor.char_is_unsigned=config.ansi_c.char_is_unsigned;
+
+  const bool nostdinc=
+    config.ansi_c.os==configt::ansi_ct::ost::NO_OS ||
+    std::find(
+      config.ansi_c.preprocessor_options.begin(),
+      config.ansi_c.preprocessor_options.end(),
+      "-nostdinc")!=config.ansi_c.preprocessor_options.end();
+
+  if(!nostdinc)
+  {
+    std::list<std::string> &paths=preprocessor.system_include_paths;
+
+    switch(config.ansi_c.os)
+    {
+    case configt::ansi_ct::ost::OS_LINUX:
+      paths.push_back("/usr/local/include");
+      if(config.ansi_c.arch=="x86_64")
+        paths.push_back("/usr/include/x86_64-linux-gnu");
+      else if(config.ansi_c.arch=="i386")
+        paths.push_back("/usr/include/i386-linux-gnu");
+      else if(config.ansi_c.arch=="arm64")
+        paths.push_back("/usr/include/aarch64-linux-gnu");
+      paths.push_back("/usr/include");
+      break;
+
+    case configt::ansi_ct::ost::OS_MACOS:
+      paths.push_back("/usr/local/include");
+      paths.push_back("/usr/include");
+      break;
+
+    case configt::ansi_ct::ost::OS_WIN:
+      {
+        // the paths the Visual Studio environment sets up
+        const char *include=getenv("INCLUDE");
+        std::string paths_string=include==nullptr?"":include;
+
+        std::size_t start=0;
+        while(start<paths_string.size())
+        {
+          std::size_t end=paths_string.find(';', start);
+          if(end==std::string::npos)
+            end=paths_string.size();
+          if(end>start)
+            paths.push_back(paths_string.substr(start, end-start));
+          start=end+1;
+        }
+      }
+      break;
+
+    case configt::ansi_ct::ost::NO_OS:
+      break;
+    }
+  }
+
+  preprocessor.preprocessor();
+
+  return preprocessor.error_found;
+}
+
 /// ANSI-C preprocessing
 bool c_preprocess_arm(
   const std::string &file,
@@ -959,12 +1133,17 @@ bool c_preprocess_arm(
   {
     command+=" -D__WORDSIZE="+std::to_string(config.ansi_c.pointer_width);
 
+    std::list<std::string> defines;
+
     if(config.ansi_c.int_width==16)
-      command+=GCC_DEFINES_16;
+      add_defines(gcc_defines_16, defines);
     else if(config.ansi_c.int_width==32)
-      command+=GCC_DEFINES_32;
+      add_defines(gcc_defines_32, defines);
     else if(config.ansi_c.int_width==64)
-      command+=GCC_DEFINES_LP64;
+      add_defines(gcc_defines_lp64, defines);
+
+    for(const auto &define : defines)
+      command+=" "+shell_quote("-D"+define);
   }
 
   // Standard Defines, ANSI9899 6.10.8
@@ -134,7 +134,7 @@ exprt c_sizeoft::sizeof_rec(const typet &type)
       }
       else
       {
-        exprt tmp=sizeof_rec(sub_type);
+        exprt tmp=sizeof_rec(comp.type());
 
         if(tmp.is_nil())
           return tmp;
@@ -188,7 +188,26 @@ exprt c_sizeoft::sizeof_rec(const typet &type)
   }
   else if(type.id()==ID_symbol)
   {
-    return sizeof_rec(ns.follow(type));
+    if(cache==nullptr)
+      return sizeof_rec(ns.follow(type));
+
+    const irep_idt &identifier=to_symbol_type(type).get_identifier();
+
+    cachet::const_iterator entry=cache->find(identifier);
+    if(entry!=cache->end())
+      return entry->second;
+
+    const typet &followed=ns.follow(type);
+    dest=sizeof_rec(followed);
+
+    // Only complete compounds have a fixed size. Cached sizes are
+    // simplified, as all users of the cache simplify their result.
+    if(dest.is_not_nil() &&
+       (followed.id()==ID_struct || followed.id()==ID_union))
+    {
+      simplify(dest, ns);
+      (*cache)[identifier]=dest;
+    }
   }
   else if(type.id()==ID_empty)
   {
@@ -287,7 +306,7 @@ exprt c_sizeoft::c_offsetof(
     }
     else
     {
-      exprt tmp=sizeof_rec(sub_type);
+      exprt tmp=sizeof_rec(comp.type());
 
       if(tmp.is_nil())
         return tmp;
@@ -300,9 +319,12 @@ exprt c_sizeoft::c_offsetof(
   return nil_exprt();
 }
 
-exprt c_sizeof(const typet &src, const namespacet &ns)
+exprt c_sizeof(
+  const typet &src,
+  const namespacet &ns,
+  c_sizeoft::cachet *cache)
 {
-  c_sizeoft c_sizeof_inst(ns);
+  c_sizeoft c_sizeof_inst(ns, cache);
   exprt tmp=c_sizeof_inst(src);
   simplify(tmp, ns);
   return tmp;
@@ -311,9 +333,10 @@ exprt c_sizeof(const typet &src, const namespacet &ns)
 exprt c_offsetof(
   const struct_typet &src,
   const irep_idt &component_name,
-  const namespacet &ns)
+  const namespacet &ns,
+  c_sizeoft::cachet *cache)
 {
-  c_sizeoft c_sizeof_inst(ns);
+  c_sizeoft c_sizeof_inst(ns, cache);
   exprt tmp=c_sizeof_inst.c_offsetof(src, component_name);
   simplify(tmp, ns);
   return tmp;
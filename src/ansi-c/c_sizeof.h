@@ -10,13 +10,19 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef CPROVER_ANSI_C_C_SIZEOF_H
 #define CPROVER_ANSI_C_C_SIZEOF_H
 
+#include <unordered_map>
+
 #include <util/namespace.h>
 #include <util/expr.h>
 
 class c_sizeoft
 {
 public:
-  explicit c_sizeoft(const namespacet &_ns):ns(_ns)
+  // the sizes of complete structs and unions, by tag
+  typedef std::unordered_map<irep_idt, exprt, irep_id_hash> cachet;
+
+  explicit c_sizeoft(const namespacet &_ns, cachet *_cache=nullptr):
+    ns(_ns), cache(_cache)
   {
   }
 
@@ -35,17 +41,20 @@ public:
 
 protected:
   const namespacet &ns;
+  cachet *cache;
 
   virtual exprt sizeof_rec(const typet &type);
 };
 
 exprt c_sizeof(
   const typet &src,
-  const namespacet &ns);
+  const namespacet &ns,
+  c_sizeoft::cachet *cache=nullptr);
 
 exprt c_offsetof(
   const struct_typet &src,
   const irep_idt &component_name,
-  const namespacet &ns);
+  const namespacet &ns,
+  c_sizeoft::cachet *cache=nullptr);
 
 #endif // CPROVER_ANSI_C_C_SIZEOF_H
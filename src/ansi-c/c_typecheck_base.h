@@ -12,6 +12,8 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef CPROVER_ANSI_C_C_TYPECHECK_BASE_H
 #define CPROVER_ANSI_C_C_TYPECHECK_BASE_H
 
+#include <unordered_set>
+
 #include <util/symbol_table.h>
 #include <util/typecheck.h>
 #include <util/namespace.h>
@@ -20,7 +22,9 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/std_types.h>
 
 #include "ansi_c_declaration.h"
+#include "c_sizeof.h"
 #include "designator.h"
+#include "padding.h"
 
 class c_typecheck_baset:
   public typecheckt,
@@ -38,7 +42,8 @@ public:
     mode(ID_C),
     break_is_allowed(false),
     continue_is_allowed(false),
-    case_is_allowed(false)
+    case_is_allowed(false),
+    type_cache_hits(0)
   {
   }
 
@@ -54,7 +59,8 @@ public:
     mode(ID_C),
     break_is_allowed(false),
     continue_is_allowed(false),
-    case_is_allowed(false)
+    case_is_allowed(false),
+    type_cache_hits(0)
   {
   }
 
@@ -205,6 +211,7 @@ protected:
 
   // types
   virtual void typecheck_type(typet &type);
+  void typecheck_type_uncached(typet &type);
   virtual void typecheck_compound_type(struct_union_typet &type);
   virtual void typecheck_compound_body(struct_union_typet &type);
   virtual void typecheck_c_enum_type(typet &type);
@@ -236,6 +243,32 @@ protected:
   // this cleans expressions in array types
   std::list<codet> clean_code;
 
+  // Checked types, by the type as given in the source, for this
+  // translation unit. The key ignores source locations.
+  struct type_cache_hasht
+  {
+    std::size_t operator()(const typet &) const;
+  };
+
+  struct type_cache_equalt
+  {
+    bool operator()(const typet &, const typet &) const;
+  };
+
+  typedef std::unordered_map<
+    typet, typet, type_cache_hasht, type_cache_equalt> type_cachet;
+  type_cachet type_cache;
+  std::size_t type_cache_hits;
+
+  static bool is_cacheable_type(const irept &);
+
+  // the sizes and layouts of complete compounds
+  c_sizeoft::cachet sizeof_cache;
+  padding_cachet padding_cache;
+
+  // compounds, by tag, that is_complete_type has found to be complete
+  mutable std::unordered_set<irep_idt, irep_id_hash> complete_tags;
+
   // environment
   void add_argc_argv(const symbolt &main_symbol);
 
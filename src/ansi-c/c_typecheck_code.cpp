@@ -385,7 +385,21 @@ bool c_typecheck_baset::is_complete_type(const typet &type) const
   else if(type.id()==ID_vector)
     return is_complete_type(type.subtype());
   else if(type.id()==ID_symbol)
-    return is_complete_type(follow(type));
+  {
+    // a compound cannot become incomplete again
+    const irep_idt &identifier=to_symbol_type(type).get_identifier();
+
+    if(complete_tags.find(identifier)!=complete_tags.end())
+      return true;
+
+    const typet &followed=follow(type);
+
+    if(!is_complete_type(followed))
+      return false;
+
+    if(followed.id()==ID_struct || followed.id()==ID_union)
+      complete_tags.insert(identifier);
+  }
 
   return true;
 }
@@ -556,7 +556,8 @@ void c_typecheck_baset::typecheck_expr_builtin_offsetof(exprt &expr)
 
           if(type.id()==ID_struct)
           {
-            exprt o=c_offsetof(to_struct_type(type), component_name, *this);
+            exprt o=c_offsetof(
+              to_struct_type(type), component_name, *this, &sizeof_cache);
 
             if(o.is_nil())
             {
@@ -596,8 +597,11 @@ void c_typecheck_baset::typecheck_expr_builtin_offsetof(exprt &expr)
               {
                 if(type.id()==ID_struct)
                 {
-                  exprt o=
-                    c_offsetof(to_struct_type(type), c_it->get_name(), *this);
+                  exprt o=c_offsetof(
+                    to_struct_type(type),
+                    c_it->get_name(),
+                    *this,
+                    &sizeof_cache);
 
                   if(o.is_nil())
                   {
@@ -649,7 +653,7 @@ void c_typecheck_baset::typecheck_expr_builtin_offsetof(exprt &expr)
       // still need to typecheck index
       typecheck_expr(index);
 
-      exprt sub_size=c_sizeof(type.subtype(), *this);
+      exprt sub_size=c_sizeof(type.subtype(), *this, &sizeof_cache);
       if(index.type()!=size_type())
         index.make_typecast(size_type());
       result=plus_exprt(result, mult_exprt(sub_size, index));
@@ -946,7 +950,7 @@ void c_typecheck_baset::typecheck_expr_sizeof(exprt &expr)
     throw 0;
   }
 
-  exprt new_expr=c_sizeof(type, *this);
+  exprt new_expr=c_sizeof(type, *this, &sizeof_cache);
 
   if(new_expr.is_nil())
   {
@@ -994,7 +998,7 @@ void c_typecheck_baset::typecheck_expr_alignof(exprt &expr)
   }
 
   // we only care about the type
-  mp_integer a=alignment(argument_type, *this);
+  mp_integer a=alignment(argument_type, *this, &padding_cache);
 
   exprt tmp=from_integer(a, size_type());
   tmp.add_source_location()=expr.source_location();
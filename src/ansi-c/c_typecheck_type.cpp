@@ -20,6 +20,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/arith_tools.h>
 #include <util/std_types.h>
 #include <util/pointer_offset_size.h>
+#include <util/irep_hash.h>
 
 #include "c_sizeof.h"
 #include "c_qualifiers.h"
@@ -27,8 +28,185 @@ Author: Daniel Kroening, kroening@kroening.com
 #include "padding.h"
 #include "type2name.h"
 #include "ansi_c_convert_type.h"
+#include "ansi_c_scope.h"
+
+static std::size_t hash_without_location(const irept &src)
+{
+  std::size_t result=hash_string(src.id());
+
+  forall_irep(it, src.get_sub())
+    result=hash_combine(result, hash_without_location(*it));
+
+  forall_named_irep(it, src.get_named_sub())
+  {
+    result=hash_combine(result, hash_string(it->first));
+    result=hash_combine(result, hash_without_location(it->second));
+  }
+
+  forall_named_irep(it, src.get_comments())
+    if(it->first!=ID_C_source_location)
+    {
+      result=hash_combine(result, hash_string(it->first));
+      result=hash_combine(result, hash_without_location(it->second));
+    }
+
+  return result;
+}
+
+static bool equal_without_location(const irept &a, const irept &b)
+{
+  if(a.id()!=b.id() ||
+     a.get_sub().size()!=b.get_sub().size() ||
+     a.get_named_sub().size()!=b.get_named_sub().size())
+    return false;
+
+  for(std::size_t i=0; i<a.get_sub().size(); i++)
+    if(!equal_without_location(a.get_sub()[i], b.get_sub()[i]))
+      return false;
+
+  irept::named_subt::const_iterator a_it=a.get_named_sub().begin();
+  irept::named_subt::const_iterator b_it=b.get_named_sub().begin();
+
+  for(; a_it!=a.get_named_sub().end(); a_it++, b_it++)
+    if(a_it->first!=b_it->first ||
+       !equal_without_location(a_it->second, b_it->second))
+      return false;
+
+  const irept::named_subt &a_comments=a.get_comments();
+  const irept::named_subt &b_comments=b.get_comments();
+
+  a_it=a_comments.begin();
+  b_it=b_comments.begin();
+
+  while(true)
+  {
+    if(a_it!=a_comments.end() && a_it->first==ID_C_source_location)
+      a_it++;
+    if(b_it!=b_comments.end() && b_it->first==ID_C_source_location)
+      b_it++;
+
+    if(a_it==a_comments.end() || b_it==b_comments.end())
+      return a_it==a_comments.end() && b_it==b_comments.end();
+
+    if(a_it->first!=b_it->first ||
+       !equal_without_location(a_it->second, b_it->second))
+      return false;
+
+    a_it++;
+    b_it++;
+  }
+}
+
+std::size_t c_typecheck_baset::type_cache_hasht::operator()(
+  const typet &type) const
+{
+  return hash_without_location(type);
+}
+
+bool c_typecheck_baset::type_cache_equalt::operator()(
+  const typet &a,
+  const typet &b) const
+{
+  return equal_without_location(a, b);
+}
+
+/// A type, as given in the source, can be cached when typechecking it
+/// yields the same wherever it occurs. This excludes compound and enum
+/// bodies, which introduce symbols, and any expression other than a
+/// constant, which may refer to variables or have side effects. Named
+/// parameters are excluded as well, as the parameters of a function
+/// definition would otherwise take the locations of its prototype.
+bool c_typecheck_baset::is_cacheable_type(const irept &src)
+{
+  const irep_idt &id=src.id();
+
+  if(id==ID_symbol)
+  {
+    // the names of typedefs and tags, which the parser has resolved
+    const ansi_c_id_classt id_class=
+      static_cast<ansi_c_id_classt>(src.get_int(ID_C_id_class));
+
+    if(id_class!=ansi_c_id_classt::ANSI_C_TYPEDEF &&
+       id_class!=ansi_c_id_classt::ANSI_C_TAG)
+      return false;
+  }
+  else if(id==ID_struct || id==ID_union)
+  {
+    if(src.find(ID_components).is_not_nil())
+      return false;
+  }
+  else if(id==ID_declarator)
+  {
+    if(!src.get(ID_name).empty())
+      return false;
+  }
+  else if(!src.get_sub().empty() ||
+          !src.get_named_sub().empty())
+  {
+    // anything but a plain specifier must be on this list
+    if(id!=ID_merged_type &&
+       id!=ID_pointer &&
+       id!=ID_array &&
+       id!=ID_vector &&
+       id!=ID_code &&
+       id!=ID_declaration &&
+       id!=ID_c_bit_field &&
+       id!=ID_gcc_attribute_mode &&
+       id!=ID_aligned &&
+       id!=ID_atomic_type_specifier &&
+       id!=ID_constant &&
+       id!=ID_signedbv &&
+       id!=ID_unsignedbv &&
+       id!=ID_floatbv &&
+       id!=ID_c_bool &&
+       !id.empty())
+      return false;
+  }
+
+  forall_irep(it, src.get_sub())
+    if(!is_cacheable_type(*it))
+      return false;
+
+  forall_named_irep(it, src.get_named_sub())
+    if(!is_cacheable_type(it->second))
+      return false;
+
+  forall_named_irep(it, src.get_comments())
+    if(it->first!=ID_C_source_location &&
+       !is_cacheable_type(it->second))
+      return false;
+
+  return true;
+}
 
 void c_typecheck_baset::typecheck_type(typet &type)
+{
+  if(!is_cacheable_type(type))
+  {
+    typecheck_type_uncached(type);
+    return;
+  }
+
+  type_cachet::const_iterator entry=type_cache.find(type);
+
+  if(entry!=type_cache.end())
+  {
+    // keep the location of this occurrence
+    source_locationt source_location=type.source_location();
+    type=entry->second;
+    if(source_location.is_not_nil())
+      type.add_source_location()=source_location;
+
+    type_cache_hits++;
+    return;
+  }
+
+  typet original=type;
+  typecheck_type_uncached(type);
+  type_cache.insert(std::make_pair(original, type));
+}
+
+void c_typecheck_baset::typecheck_type_uncached(typet &type)
 {
   // we first convert, and then check
   {
@@ -658,7 +836,7 @@ void c_typecheck_baset::typecheck_vector_type(vector_typet &type)
   }
 
   // the subtype must have constant size
-  exprt size_expr=c_sizeof(type.subtype(), *this);
+  exprt size_expr=c_sizeof(type.subtype(), *this, &sizeof_cache);
 
   simplify(size_expr, *this);
 
@@ -932,9 +1110,9 @@ void c_typecheck_baset::typecheck_compound_body(
   // as additional member for unions.
 
   if(type.id()==ID_struct)
-    add_padding(to_struct_type(type), *this);
+    add_padding(to_struct_type(type), *this, &padding_cache);
   else if(type.id()==ID_union)
-    add_padding(to_union_type(type), *this);
+    add_padding(to_union_type(type), *this, &padding_cache);
 
   // Now remove zero-width bit-fields, these are just
   // for adjusting alignment.
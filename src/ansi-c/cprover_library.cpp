@@ -22,18 +22,40 @@ struct cprover_library_entryt
 #include "cprover_library.inc"
 ; // NOLINT(whitespace/semicolon)
 
+std::string get_cprover_library_prologue()
+{
+  std::string prologue=
+    "#line 1 \"<builtin-library>\"\n"
+    "#undef inline\n";
+
+  if(config.ansi_c.string_abstraction)
+    prologue+="#define __CPROVER_STRING_ABSTRACTION\n";
+
+  return prologue;
+}
+
+std::string get_cprover_library_model(const irep_idt &function)
+{
+  std::string model;
+
+  for(cprover_library_entryt *e=cprover_library;
+      e->function!=nullptr;
+      e++)
+  {
+    if(function==e->function)
+      model+=std::string(e->model)+'\n';
+  }
+
+  return model;
+}
+
 std::string get_cprover_library_text(
   const std::set<irep_idt> &functions,
   const symbol_tablet &symbol_table)
 {
   std::ostringstream library_text;
 
-  library_text <<
-    "#line 1 \"<builtin-library>\"\n"
-    "#undef inline\n";
-
-  if(config.ansi_c.string_abstraction)
-    library_text << "#define __CPROVER_STRING_ABSTRACTION\n";
+  library_text << get_cprover_library_prologue();
 
   std::size_t count=0;
 
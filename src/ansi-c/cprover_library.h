@@ -15,6 +15,12 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/symbol_table.h>
 #include <util/message.h>
 
+std::string get_cprover_library_prologue();
+
+/// \return the model of the given library function, or the empty string if
+///   there is none
+std::string get_cprover_library_model(const irep_idt &function);
+
 std::string get_cprover_library_text(
   const std::set<irep_idt> &functions,
   const symbol_tablet &);
@@ -18,7 +18,10 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/simplify_expr.h>
 #include <util/arith_tools.h>
 
-mp_integer alignment(const typet &type, const namespacet &ns)
+mp_integer alignment(
+  const typet &type,
+  const namespacet &ns,
+  padding_cachet *cache)
 {
   // we need to consider a number of different cases:
   // - alignment specified in the source, which will be recorded in
@@ -53,7 +56,7 @@ mp_integer alignment(const typet &type, const namespacet &ns)
   mp_integer result;
 
   if(type.id()==ID_array)
-    result=alignment(type.subtype(), ns);
+    result=alignment(type.subtype(), ns, cache);
   else if(type.id()==ID_struct || type.id()==ID_union)
   {
     const struct_union_typet::componentst &components=
@@ -67,7 +70,7 @@ mp_integer alignment(const typet &type, const namespacet &ns)
         it=components.begin();
         it!=components.end();
         it++)
-      result=std::max(result, alignment(it->type(), ns));
+      result=std::max(result, alignment(it->type(), ns, cache));
   }
   else if(type.id()==ID_unsignedbv ||
           type.id()==ID_signedbv ||
@@ -79,20 +82,41 @@ mp_integer alignment(const typet &type, const namespacet &ns)
     result=width%8?width/8+1:width/8;
   }
   else if(type.id()==ID_c_enum)
-    result=alignment(type.subtype(), ns);
+    result=alignment(type.subtype(), ns, cache);
   else if(type.id()==ID_c_enum_tag)
-    result=alignment(ns.follow_tag(to_c_enum_tag_type(type)), ns);
+    result=alignment(ns.follow_tag(to_c_enum_tag_type(type)), ns, cache);
   else if(type.id()==ID_pointer)
   {
     std::size_t width=config.ansi_c.pointer_width;
     result=width%8?width/8+1:width/8;
   }
   else if(type.id()==ID_symbol)
-    result=alignment(ns.follow(type), ns);
+  {
+    if(cache==nullptr)
+      result=alignment(ns.follow(type), ns, cache);
+    else
+    {
+      const irep_idt &identifier=to_symbol_type(type).get_identifier();
+
+      padding_cachet::mapt::const_iterator entry=
+        cache->alignment.find(identifier);
+
+      if(entry!=cache->alignment.end())
+        result=entry->second;
+      else
+      {
+        const typet &followed=ns.follow(type);
+        result=alignment(followed, ns, cache);
+
+        if(followed.id()==ID_struct || followed.id()==ID_union)
+          cache->alignment[identifier]=result;
+      }
+    }
+  }
   else if(type.id()==ID_c_bit_field)
   {
     // we align these according to the 'underlying type'
-    result=alignment(type.subtype(), ns);
+    result=alignment(type.subtype(), ns, cache);
   }
   else
     result=1;
@@ -105,7 +129,71 @@ mp_integer alignment(const typet &type, const namespacet &ns)
   return result;
 }
 
-void add_padding(struct_typet &type, const namespacet &ns)
+/// Like pointer_offset_bits, but looks up the size of any complete
+/// struct or union in the cache.
+/// \return the size in bits, or -1 if the type has none
+static mp_integer type_bits(
+  const typet &type,
+  const namespacet &ns,
+  padding_cachet *cache)
+{
+  if(cache==nullptr)
+    return pointer_offset_bits(type, ns);
+
+  if(type.id()==ID_symbol)
+  {
+    const irep_idt &identifier=to_symbol_type(type).get_identifier();
+
+    padding_cachet::mapt::const_iterator entry=cache->bits.find(identifier);
+    if(entry!=cache->bits.end())
+      return entry->second;
+
+    const typet &followed=ns.follow(type);
+    mp_integer bits=type_bits(followed, ns, cache);
+
+    if(bits!=-1 &&
+       (followed.id()==ID_struct || followed.id()==ID_union))
+      cache->bits[identifier]=bits;
+
+    return bits;
+  }
+  else if(type.id()==ID_struct || type.id()==ID_union)
+  {
+    mp_integer result=0;
+
+    for(const auto &component : to_struct_union_type(type).components())
+    {
+      mp_integer sub_bits=type_bits(component.type(), ns, cache);
+
+      if(sub_bits==-1)
+        return -1;
+
+      if(type.id()==ID_struct)
+        result+=sub_bits;
+      else
+        result=std::max(result, sub_bits);
+    }
+
+    return result;
+  }
+  else if(type.id()==ID_array)
+  {
+    mp_integer sub_bits=type_bits(type.subtype(), ns, cache);
+    mp_integer size;
+
+    if(sub_bits==-1 || to_integer(to_array_type(type).size(), size))
+      return -1;
+
+    return sub_bits*size;
+  }
+  else
+    return pointer_offset_bits(type, ns);
+}
+
+void add_padding(
+  struct_typet &type,
+  const namespacet &ns,
+  padding_cachet *cache)
 {
   struct_typet::componentst &components=type.components();
 
@@ -190,7 +278,7 @@ void add_padding(struct_typet &type, const namespacet &ns)
 
     if(it_type.id()==ID_c_bit_field)
     {
-      a=alignment(to_c_bit_field_type(it_type).subtype(), ns);
+      a=alignment(to_c_bit_field_type(it_type).subtype(), ns, cache);
 
       // A zero-width bit-field causes alignment to the base-type.
       if(to_c_bit_field_type(it_type).get_width()==0)
@@ -212,7 +300,7 @@ void add_padding(struct_typet &type, const namespacet &ns)
       }
     }
     else
-      a=alignment(it_type, ns);
+      a=alignment(it_type, ns, cache);
 
     // check minimum alignment
     if(a<config.ansi_c.alignment && !packed)
@@ -245,10 +333,10 @@ void add_padding(struct_typet &type, const namespacet &ns)
       }
     }
 
-    mp_integer size=pointer_offset_size(it_type, ns);
+    mp_integer bits=type_bits(it_type, ns, cache);
 
-    if(size!=-1)
-      offset+=size;
+    if(bits!=-1)
+      offset+=bits/8+(((bits%8)==0)?0:1);
   }
 
   if(bit_field_bits!=0)
@@ -301,10 +389,13 @@ void add_padding(struct_typet &type, const namespacet &ns)
   }
 }
 
-void add_padding(union_typet &type, const namespacet &ns)
+void add_padding(
+  union_typet &type,
+  const namespacet &ns,
+  padding_cachet *cache)
 {
-  mp_integer max_alignment=alignment(type, ns)*8;
-  mp_integer size_bits=pointer_offset_bits(type, ns);
+  mp_integer max_alignment=alignment(type, ns, cache)*8;
+  mp_integer size_bits=type_bits(type, ns, cache);
 
   if(size_bits<0)
     throw "type of unknown size:\n"+type.pretty();
@@ -12,12 +12,34 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef CPROVER_ANSI_C_PADDING_H
 #define CPROVER_ANSI_C_PADDING_H
 
+#include <unordered_map>
+
 #include <util/std_types.h>
 #include <util/namespace.h>
 #include <util/mp_arith.h>
 
-mp_integer alignment(const typet &type, const namespacet &);
-void add_padding(struct_typet &type, const namespacet &);
-void add_padding(union_typet &type, const namespacet &);
+/// The alignments and sizes (in bits) of complete structs and unions,
+/// by tag. These do not change once the type has been laid out, and
+/// save walking nested compounds over and over again.
+struct padding_cachet
+{
+  typedef std::unordered_map<irep_idt, mp_integer, irep_id_hash> mapt;
+  mapt alignment, bits;
+};
+
+mp_integer alignment(
+  const typet &type,
+  const namespacet &,
+  padding_cachet *cache=nullptr);
+
+void add_padding(
+  struct_typet &type,
+  const namespacet &,
+  padding_cachet *cache=nullptr);
+
+void add_padding(
+  union_typet &type,
+  const namespacet &,
+  padding_cachet *cache=nullptr);
 
 #endif // CPROVER_ANSI_C_PADDING_H
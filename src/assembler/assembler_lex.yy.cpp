@@ -0,0 +1,229 @@
+/* generated by miniflex */
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#define yylex yyassemblerlex
+#define yytext yyassemblertext
+#define yyleng yyassemblerleng
+#define yyin yyassemblerin
+#define yyout yyassemblerout
+#define yywrap yyassemblerwrap
+#define yyrestart yyassemblerrestart
+#define yylineno yyassemblerlineno
+#define YY_NULL 0
+int yylex();
+int yywrap();
+extern char *yytext;
+extern int yyleng;
+extern FILE *yyin, *yyout;
+static void yy_flush_buffer_impl();
+#define YY_FLUSH_BUFFER yy_flush_buffer_impl()
+#define BEGIN yy_start_state=
+#define YY_START yy_start_state
+#define yyterminate() return YY_NULL
+static int yy_start_state=0;
+
+#ifdef _WIN32
+#define YY_NO_UNISTD_H
+static int isatty(int) { return 0; }
+#endif
+
+#define PARSER assembler_parser
+#define YYSTYPE unsigned
+#undef  ECHO
+#define ECHO
+
+#include "assembler_parser.h"
+
+#include <util/pragma_wsign_compare.def>
+#include <util/pragma_wnull_conversion.def>
+#include <util/pragma_wdeprecated_register.def>
+
+/*** macros for easier rule definition **********************************/
+void assemlber_scanner_init()
+{
+  YY_FLUSH_BUFFER;
+  BEGIN(0);
+}
+
+#ifndef YY_INPUT
+#define YY_INPUT(buf, result, max_size) (result=(int)fread((buf), 1, (max_size), yyin?yyin:stdin))
+#endif
+#ifndef YY_USER_ACTION
+#define YY_USER_ACTION
+#endif
+#ifndef ECHO
+#define ECHO fwrite(yytext, yyleng, 1, yyout?yyout:stdout)
+#endif
+#ifndef YY_BREAK
+#define YY_BREAK break;
+#endif
+#define INITIAL 0
+#define GRAMMAR 1
+#define LINE_COMMENT 2
+char *yytext=nullptr;
+int yyleng=0;
+FILE *yyin=nullptr, *yyout=nullptr;
+static std::vector<char> yy_buf;
+static std::size_t yy_pos=0, yy_len=0, yy_hold_pos=0;
+static bool yy_buf_valid=false, yy_hold_active=false;
+static char yy_hold=0;
+static std::vector<int> yy_state_stack;
+static void yy_flush_buffer_impl()
+{ yy_buf_valid=false; yy_hold_active=false; }
+static void yy_push_state(int s)
+{ yy_state_stack.push_back(yy_start_state); yy_start_state=s; }
+static void yy_pop_state()
+{ yy_start_state=yy_state_stack.back(); yy_state_stack.pop_back(); }
+static int yy_top_state() { return yy_state_stack.back(); }
+static bool yy_eof=false;
+static bool yy_more_input()
+{
+  if(yy_eof) return false;
+  yy_buf.erase(yy_buf.begin(), yy_buf.begin()+yy_pos);
+  yy_len-=yy_pos; yy_pos=0;
+  yy_buf.resize(yy_len);
+  char chunk[8192];
+  int result=0;
+  YY_INPUT(chunk, result, sizeof(chunk));
+  if(result<=0) yy_eof=true;
+  else yy_buf.insert(yy_buf.end(), chunk, chunk+result);
+  yy_len=yy_buf.size();
+  yy_buf.push_back(0);
+  return result>0;
+}
+static void yy_fill()
+{
+  yy_buf.clear(); yy_buf.push_back(0);
+  yy_pos=0; yy_len=0; yy_eof=false;
+  yy_buf_valid=true;
+  yy_more_input();
+}
+#define yyless(n) do { yy_buf[yy_hold_pos]=yy_hold; yy_pos=(yytext-yy_buf.data())+(n); yy_hold_pos=yy_pos; yy_hold=yy_buf[yy_pos]; yy_buf[yy_pos]=0; yyleng=(n); } while(0)
+static void yyunput_impl(int c)
+{
+  if(yy_hold_active) { yy_buf[yy_hold_pos]=yy_hold; yy_hold_active=false; }
+  if(yy_pos==0) { yy_buf.insert(yy_buf.begin(), (char)c); yy_len++; }
+  else yy_buf[--yy_pos]=(char)c;
+}
+#define unput(c) yyunput_impl(c)
+#define yymore() static_assert(false, "yymore unsupported")
+static const unsigned char yy_ec[256]={17,17,17,17,17,17,17,17,2,2,0,1,1,2,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,2,17,17,3,4,17,17,17,17,17,17,17,17,17,5,17,6,6,6,6,6,6,6,6,6,6,17,7,8,17,9,17,17,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,17,11,17,17,12,17,13,16,16,14,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,15,16,16,16,16,16,16,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17};
+static const short yy_nxt[]={34,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,18,8,9,7,10,11,12,13,6,5,14,15,16,17,17,17,17,12,4,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,-1,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,32,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,31,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,30,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,24,19,22,-1,-1,-1,20,-1,23,21,21,21,21,-1,-1,-1,-1,-1,24,19,22,-1,-1,-1,20,-1,23,21,26,21,21,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,24,19,22,-1,-1,-1,20,-1,23,21,21,21,21,-1,25,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,24,19,22,-1,-1,-1,20,-1,23,21,21,21,21,-1,-1,-1,-1,-1,24,19,22,-1,-1,-1,20,-1,23,21,21,21,21,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,24,19,22,-1,-1,-1,20,-1,23,21,21,21,21,-1,-1,-1,-1,-1,24,19,22,-1,-1,-1,20,-1,23,21,21,21,21,-1,-1,-1,-1,-1,24,19,22,-1,-1,-1,20,-1,23,21,21,21,21,-1,-1,-1,-1,-1,24,19,22,-1,-1,-1,20,-1,23,21,21,21,21,-1,-1,-1,-1,-1,24,19,22,-1,-1,-1,20,-1,23,21,21,21,21,-1,-1,-1,-1,-1,24,19,22,-1,-1,-1,20,-1,23,21,21,21,21,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,24,19,22,-1,-1,-1,20,-1,23,27,21,21,21,-1,-1,-1,-1,-1,24,19,22,-1,-1,-1,20,-1,23,21,21,28,21,-1,-1,-1,-1,-1,24,19,22,-1,-1,-1,20,-1,23,29,21,21,21,-1,-1,-1,-1,-1,24,19,22,-1,-1,-1,20,-1,23,21,21,21,21,-1,-1,-1,30,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1};
+static const unsigned char yy_jam[]={0,0,0,0,1,0,0,1,1,0,0,0,1,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1};
+static const short yy_accept[]={-1,8,3,3,2,12,12,1,4,6,9,9,12,5,9,12,9,9,4,9,9,9,9,9,9,4,9,9,9,7,6,11,10,0,0};
+static const int yy_start_dfa[]={0,1,2};
+int yylex()
+{
+  for(;;)
+  {
+    if(yy_hold_active) { yy_buf[yy_hold_pos]=yy_hold; yy_hold_active=false; }
+    if(!yy_buf_valid) yy_fill();
+    if(yy_pos>=yy_len && yy_more_input()) continue;
+    if(yy_pos>=yy_len)
+    {
+      yy_buf_valid=false;
+      yytext=yy_buf.data()+yy_len; yyleng=0;
+      switch(yy_start_state)
+      {
+      case 0:
+        { yyterminate(); /* done! */ }
+        return YY_NULL;
+      case 1:
+        { yyterminate(); /* done! */ }
+        return YY_NULL;
+      case 2:
+        { yyterminate(); /* done! */ }
+        return YY_NULL;
+      default: break;
+      }
+      if(yywrap()) return YY_NULL;
+      continue;
+    }
+    int yy_state=yy_start_dfa[yy_start_state];
+    std::size_t yy_p=yy_pos, yy_end=0;
+    int yy_rule=-1;
+    for(;;)
+    {
+      while(yy_p<yy_len)
+      {
+        yy_state=yy_nxt[yy_state*18+yy_ec[(unsigned char)yy_buf[yy_p]]];
+        if(yy_state<0) break;
+        yy_p++;
+        if(yy_accept[yy_state]>=0) { yy_rule=yy_accept[yy_state]; yy_end=yy_p; }
+        if(yy_jam[yy_state]) break;
+      }
+      if(yy_p<yy_len || yy_state<0 || yy_jam[yy_state]) break;
+      std::size_t yy_off=yy_pos;
+      if(!yy_more_input()) break;
+      yy_p-=yy_off; if(yy_end!=0) yy_end-=yy_off;
+    }
+    if(yy_rule<0) { yy_rule=13; yy_end=yy_pos+1; }
+    yytext=yy_buf.data()+yy_pos;
+    yyleng=(int)(yy_end-yy_pos);
+    yy_hold_pos=yy_end; yy_hold=yy_buf[yy_end]; yy_buf[yy_end]=0;
+    yy_hold_active=true;
+    yy_pos=yy_end;
+    YY_USER_ACTION
+    switch(yy_rule)
+    {
+    case 0:
+{ BEGIN(GRAMMAR);
+                  yyless(0); /* start again with this character */
+                }
+    break;
+    case 1:
+{ PARSER.new_instruction(); BEGIN(LINE_COMMENT); }
+    break;
+    case 2:
+{ BEGIN(GRAMMAR); }
+    break;
+    case 3:
+{ }
+    break;
+    case 4:
+{ PARSER.new_instruction(); }
+    break;
+    case 5:
+{ PARSER.new_instruction(); }
+    break;
+    case 6:
+{ }
+    break;
+    case 7:
+{ }
+    break;
+    case 8:
+{ /* ignore */ }
+    break;
+    case 9:
+{ irept identifier(ID_symbol);
+                  identifier.set(ID_identifier, yytext);
+                  PARSER.add_token(identifier);
+                }
+    break;
+    case 10:
+{ PARSER.add_token(irept(ID_shr)); }
+    break;
+    case 11:
+{ PARSER.add_token(irept(ID_shl)); }
+    break;
+    case 12:
+{ std::string s;
+                  s+=yytext[0];
+                  PARSER.add_token(irept(s));
+                }
+    break;
+    default:
+      ECHO;
+      break;
+    }
+  }
+}
+// suppress unused warnings
+static void yy_unused_helpers()
+{ (void)&yy_push_state; (void)&yy_pop_state; (void)&yy_top_state;
+  (void)&yyunput_impl; (void)&yy_unused_helpers; }
+
+int yywrap() { return 1; }
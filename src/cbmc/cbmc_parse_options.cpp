@@ -268,6 +268,14 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
     options.set_option("refine-arithmetic", true);
   }
 
+  if(cmdline.isset("string-refine"))
+    options.set_option("string-refine", true);
+
+  if(cmdline.isset("string-max-length"))
+    options.set_option(
+      "string-max-length",
+      cmdline.get_value("string-max-length"));
+
   if(cmdline.isset("max-node-refinement"))
     options.set_option(
       "max-node-refinement",
@@ -297,6 +305,9 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
   if(cmdline.isset("fpa"))
     options.set_option("fpa", true);
 
+  if(cmdline.isset("string-theory"))
+    options.set_option("string-theory", true);
+
 
   bool solver_set=false;
 
@@ -624,12 +635,12 @@ int cbmc_parse_optionst::get_goto_program(
       clear_parse();
     }
 
-    for(const auto &bin : binaries)
+    if(!binaries.empty())
     {
       status() << "Reading GOTO program from file " << eom;
 
-      if(read_object_and_link(
-        bin,
+      if(read_objects_and_link(
+        std::list<std::string>(binaries.begin(), binaries.end()),
         symbol_table,
         goto_functions,
         get_message_handler()))
@@ -649,7 +660,11 @@ int cbmc_parse_optionst::get_goto_program(
 
     status() << "Generating GOTO Program" << eom;
 
-    goto_convert(symbol_table, goto_functions, ui_message_handler);
+    unsigned jobs=1;
+    if(cmdline.isset("jobs"))
+      jobs=unsafe_string2unsigned(cmdline.get_value("jobs"));
+
+    goto_convert(symbol_table, goto_functions, ui_message_handler, jobs);
 
     if(process_goto_program(options, goto_functions))
       return 6;
@@ -779,9 +794,13 @@ bool cbmc_parse_optionst::process_goto_program(
       goto_functions,
       cmdline.isset("pointer-check"));
     // Java virtual functions -> explicit dispatch tables:
-    remove_virtual_functions(symbol_table, goto_functions);
+    remove_virtual_functions(
+      get_message_handler(),
+      symbol_table,
+      goto_functions,
+      cmdline.isset("rapid-type-analysis"));
     // remove catch and throw
-    remove_exceptions(symbol_table, goto_functions);
+    remove_exceptions(symbol_table, goto_functions, get_message_handler());
     // Similar removal of RTTI inspection:
     remove_instanceof(symbol_table, goto_functions);
 
@@ -962,6 +981,7 @@ void cbmc_parse_optionst::help()
     " -I path                      set include path (C/C++)\n"
     " -D macro                     define preprocessor macro (C/C++)\n"
     " --preprocess                 stop after preprocessing\n"
+    " --builtin-preprocessor       preprocess C without running gcc\n"
     " --16, --32, --64             set width of int\n"
     " --LP64, --ILP64, --LLP64,\n"
     "   --ILP32, --LP32            set width of int, long and pointers\n"
@@ -992,6 +1012,7 @@ void cbmc_parse_optionst::help()
     #endif
     " --no-arch                    don't set up an architecture\n"
     " --no-library                 disable built-in abstract C library\n"
+    " --cprover-library-cache dir  reuse library models precompiled in dir\n"
     " --round-to-nearest           rounding towards nearest even (default)\n"
     " --round-to-plus-inf          rounding towards plus infinity\n"
     " --round-to-minus-inf         rounding towards minus infinity\n"
@@ -1020,6 +1041,13 @@ void cbmc_parse_optionst::help()
     // NOLINTNEXTLINE(whitespace/line_length)
     " --java-cp-include-files      regexp or JSON list of files to load (with '@' prefix)\n"
     " --java-unwind-enum-static    try to unwind loops in static initialization of enums\n"
+    " --java-max-input-tree-depth N\n"
+    "                              create input objects with a function per\n"
+    "                              class, in trees at most N deep\n"
+    " --rapid-type-analysis        only dispatch virtual calls to classes that\n"
+    "                              may be instantiated\n"
+    " --java-class-cache dir       reuse converted classes and method summaries\n"
+    "                              stored in dir\n"
     "\n"
     "Semantic transformations:\n"
     " --nondet-static              add nondeterministic initialization of variables with static lifetime\n" // NOLINT(*)
@@ -1049,7 +1077,10 @@ void cbmc_parse_optionst::help()
     " --cvc4                       use CVC4\n"
     " --yices                      use Yices\n"
     " --z3                         use Z3\n"
+    " --string-theory              use the SMT2 theory of strings\n"
     " --refine                     use refinement procedure (experimental)\n"
+    " --string-refine              use string refinement (experimental)\n"
+    " --string-max-length n        assume strings are at most n characters long\n" // NOLINT(*)
     " --outfile filename           output formula to given file\n"
     " --arrays-uf-never            never turn arrays into uninterpreted functions\n" // NOLINT(*)
     " --arrays-uf-always           always turn arrays into uninterpreted functions\n" // NOLINT(*)
@@ -1060,5 +1091,8 @@ void cbmc_parse_optionst::help()
     " --xml-interface              bi-directional XML interface\n"
     " --json-ui                    use JSON-formatted output\n"
     " --verbosity #                verbosity level\n"
+    " --jobs n                     convert up to n functions concurrently,\n"
+    "                              and parse the classes of JAR files\n"
+    "                              using up to n processes\n"
     "\n";
 }
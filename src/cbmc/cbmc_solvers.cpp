@@ -19,6 +19,7 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <solvers/sat/satcheck.h>
 #include <solvers/refinement/bv_refinement.h>
+#include <solvers/refinement/string_refinement.h>
 #include <solvers/smt1/smt1_dec.h>
 #include <solvers/smt2/smt2_dec.h>
 #include <solvers/cvc/cvc_dec.h>
@@ -160,6 +161,25 @@ cbmc_solverst::solvert* cbmc_solverst::get_bv_refinement()
   return new solvert(bv_refinement, prop);
 }
 
+/// the string refinement adds to the bit-vector refinement the axioms of
+/// the string primitives, which it instantiates lazily
+cbmc_solverst::solvert* cbmc_solverst::get_string_refinement()
+{
+  propt *prop;
+  prop=new satcheck_no_simplifiert();
+  prop->set_message_handler(get_message_handler());
+
+  string_refinementt *string_refinement=
+    new string_refinementt(ns, *prop, MAX_NB_REFINEMENT);
+  string_refinement->set_ui(ui);
+
+  if(options.get_option("string-max-length")!="")
+    string_refinement->set_max_string_length(
+      options.get_unsigned_int_option("string-max-length"));
+
+  return new solvert(string_refinement, prop);
+}
+
 cbmc_solverst::solvert* cbmc_solverst::get_smt1(smt1_dect::solvert solver)
 {
   no_beautification();
@@ -235,6 +255,11 @@ cbmc_solverst::solvert* cbmc_solverst::get_smt2(smt2_dect::solvert solver)
 
   const std::string &filename=options.get_option("outfile");
 
+  // the theory of strings is not part of any of the quantifier-free
+  // logics that the solvers agree on
+  const std::string logic=
+    options.get_bool_option("string-theory")?"ALL":"QF_AUFBV";
+
   if(filename=="")
   {
     if(solver==smt2_dect::solvert::GENERIC)
@@ -248,12 +273,15 @@ cbmc_solverst::solvert* cbmc_solverst::get_smt2(smt2_dect::solvert solver)
         ns,
         "cbmc",
         "Generated by CBMC " CBMC_VERSION,
-        "QF_AUFBV",
+        logic,
         solver);
 
     if(options.get_bool_option("fpa"))
       smt2_dec->use_FPA_theory=true;
 
+    if(options.get_bool_option("string-theory"))
+      smt2_dec->use_string_theory=true;
+
     return new solvert(smt2_dec);
   }
   else if(filename=="-")
@@ -263,13 +291,16 @@ cbmc_solverst::solvert* cbmc_solverst::get_smt2(smt2_dect::solvert solver)
         ns,
         "cbmc",
         "Generated by CBMC " CBMC_VERSION,
-        "QF_AUFBV",
+        logic,
         solver,
         std::cout);
 
     if(options.get_bool_option("fpa"))
       smt2_conv->use_FPA_theory=true;
 
+    if(options.get_bool_option("string-theory"))
+      smt2_conv->use_string_theory=true;
+
     smt2_conv->set_message_handler(get_message_handler());
 
     return new solvert(smt2_conv);
@@ -293,13 +324,16 @@ cbmc_solverst::solvert* cbmc_solverst::get_smt2(smt2_dect::solvert solver)
         ns,
         "cbmc",
         "Generated by CBMC " CBMC_VERSION,
-        "QF_AUFBV",
+        logic,
         solver,
         *out);
 
     if(options.get_bool_option("fpa"))
       smt2_conv->use_FPA_theory=true;
 
+    if(options.get_bool_option("string-theory"))
+      smt2_conv->use_string_theory=true;
+
     smt2_conv->set_message_handler(get_message_handler());
 
     return new solvert(smt2_conv, out);
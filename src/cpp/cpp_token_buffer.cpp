@@ -76,7 +76,7 @@ extern char *yyansi_ctext;
 void cpp_token_buffert::read_token()
 {
   tokens.push_back(cpp_tokent());
-  token_vector.push_back(--tokens.end());
+  token_vector.push_back(&tokens.back());
 
   int kind;
 
@@ -85,7 +85,7 @@ void cpp_token_buffert::read_token()
   tokens.back().text=yyansi_ctext;
   if(ansi_c_parser.stack.size()==1)
   {
-    tokens.back().data=ansi_c_parser.stack.front();
+    tokens.back().data.swap(ansi_c_parser.stack.front());
     tokens.back().line_no=ansi_c_parser.get_line_no();
     tokens.back().filename=ansi_c_parser.get_file();
   }
@@ -125,5 +125,5 @@ void cpp_token_buffert::Insert(const cpp_tokent &token)
   tokens.push_back(token);
 
   token_vector.insert(token_vector.begin()+current_pos,
-                      --tokens.end());
+                      &tokens.back());
 }
@@ -12,6 +12,10 @@ Author: Daniel Kroening, kroening@cs.cmu.edu
 #ifndef CPROVER_CPP_CPP_TOKEN_BUFFER_H
 #define CPROVER_CPP_CPP_TOKEN_BUFFER_H
 
+#include <cassert>
+#include <deque>
+#include <vector>
+
 #include "cpp_token.h"
 
 class cpp_token_buffert
@@ -48,10 +52,12 @@ public:
   }
 
 protected:
-  typedef std::list<cpp_tokent> tokenst;
+  // a deque does not move its elements when growing at the end,
+  // and allocates them in blocks rather than one by one
+  typedef std::deque<cpp_tokent> tokenst;
   tokenst tokens;
 
-  std::vector<tokenst::iterator> token_vector;
+  std::vector<cpp_tokent *> token_vector;
 
   post current_pos;
 
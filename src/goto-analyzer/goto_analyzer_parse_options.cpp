@@ -297,6 +297,15 @@ int goto_analyzer_parse_optionst::doit()
     optionst options;
     options.set_option("json", cmdline.get_value("json"));
     options.set_option("xml", cmdline.get_value("xml"));
+    options.set_option("summary-cache", cmdline.get_value("summary-cache"));
+    options.set_option("no-widening", cmdline.isset("no-widening"));
+    options.set_option(
+      "no-widening-thresholds", cmdline.isset("no-widening-thresholds"));
+    options.set_option("widening-delay", cmdline.get_value("widening-delay"));
+    options.set_option(
+      "narrowing-rounds", cmdline.get_value("narrowing-rounds"));
+    options.set_option(
+      "iteration-budget", cmdline.get_value("iteration-budget"));
     bool result=
       static_analyzer(goto_model, options, get_message_handler());
     return result?10:0;
@@ -356,7 +365,7 @@ bool goto_analyzer_parse_optionst::process_goto_program(
     // Java virtual functions -> explicit dispatch tables:
     remove_virtual_functions(goto_model);
     // remove Java throw and catch
-    remove_exceptions(goto_model);
+    remove_exceptions(goto_model, get_message_handler());
     // remove rtti
     remove_instanceof(goto_model);
 
@@ -458,6 +467,17 @@ void goto_analyzer_parse_optionst::help()
     // NOLINTNEXTLINE(whitespace/line_length)
     " --json file_name             output results in JSON format to given file\n"
     " --xml file_name              output results in XML format to given file\n"
+    // NOLINTNEXTLINE(whitespace/line_length)
+    " --summary-cache file_name    reuse function summaries stored in given file\n"
+    " --no-widening                do not widen intervals at loop heads\n"
+    // NOLINTNEXTLINE(whitespace/line_length)
+    " --widening-delay n           number of loop iterations before widening (default: 3)\n"
+    // NOLINTNEXTLINE(whitespace/line_length)
+    " --no-widening-thresholds     widen to infinity instead of program constants\n"
+    // NOLINTNEXTLINE(whitespace/line_length)
+    " --narrowing-rounds n         number of narrowing rounds after widening (default: 2)\n"
+    // NOLINTNEXTLINE(whitespace/line_length)
+    " --iteration-budget n         widen to infinity after n updates of a loop head\n"
     "\n"
     "C/C++ frontend options:\n"
     " -I path                      set include path (C/C++)\n"
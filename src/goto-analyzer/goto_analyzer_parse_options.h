@@ -44,7 +44,9 @@ class optionst;
   "(json):(xml):" \
   "(unreachable-instructions)(unreachable-functions)" \
   "(reachable-functions)" \
-  "(intervals)(show-intervals)" \
+  "(intervals)(show-intervals)(summary-cache):" \
+  "(no-widening)(widening-delay):(no-widening-thresholds)" \
+  "(narrowing-rounds):(iteration-budget):" \
   "(non-null)(show-non-null)"
 
 class goto_analyzer_parse_optionst:
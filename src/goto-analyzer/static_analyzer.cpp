@@ -10,10 +10,12 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <fstream>
 
+#include <util/string2int.h>
 #include <util/threeval.h>
 #include <util/json.h>
 #include <util/xml.h>
 
+#include <analyses/ai_summaries.h>
 #include <analyses/interval_domain.h>
 
 class static_analyzert:public messaget
@@ -38,9 +40,10 @@ protected:
   const optionst &options;
 
   // analyses
-  ait<interval_domaint> interval_analysis;
+  interval_ait interval_analysis;
 
   void plain_text_report();
+  void output_statistics();
   void json_report(const std::string &);
   void xml_report(const std::string &);
 
@@ -49,9 +52,52 @@ protected:
 
 bool static_analyzert::operator()()
 {
+  const std::string summary_cache=options.get_option("summary-cache");
+  ai_summariest summaries("intervals");
+
+  if(!summary_cache.empty())
+  {
+    summaries.set_program(goto_functions);
+    if(summaries.load(summary_cache))
+      warning() << "ignoring invalid summary cache `"
+                << summary_cache << "'" << eom;
+    interval_analysis.set_summaries(summaries);
+  }
+
+  interval_analysis.widening=!options.get_bool_option("no-widening");
+
+  if(interval_analysis.widening)
+  {
+    interval_analysis.widening_thresholds=
+      !options.get_bool_option("no-widening-thresholds");
+
+    if(!options.get_option("widening-delay").empty())
+      interval_analysis.widening_delay=
+        options.get_unsigned_int_option("widening-delay");
+
+    if(!options.get_option("narrowing-rounds").empty())
+      interval_analysis.narrowing_rounds=
+        options.get_unsigned_int_option("narrowing-rounds");
+  }
+
+  if(!options.get_option("iteration-budget").empty())
+    interval_analysis.iteration_budget=
+      options.get_unsigned_int_option("iteration-budget");
+
   status() << "performing interval analysis" << eom;
   interval_analysis(goto_functions, ns);
 
+  output_statistics();
+
+  if(!summary_cache.empty())
+  {
+    statistics() << "function summaries: " << summaries.hits << " reused, "
+                 << summaries.misses << " computed" << eom;
+    if(summaries.save(summary_cache))
+      error() << "failed to write summary cache `"
+              << summary_cache << "'" << eom;
+  }
+
   if(!options.get_option("json").empty())
     json_report(options.get_option("json"));
   else if(!options.get_option("xml").empty())
@@ -62,6 +108,30 @@ bool static_analyzert::operator()()
   return false;
 }
 
+void static_analyzert::output_statistics()
+{
+  std::size_t total=0, max=0;
+  goto_programt::const_targett max_location;
+
+  for(const auto &count : interval_analysis.get_iteration_counts())
+  {
+    total+=count.second;
+    if(count.second>max)
+    {
+      max=count.second;
+      max_location=count.first;
+    }
+  }
+
+  statistics() << "interval analysis: " << total << " state updates, "
+               << interval_analysis.get_widenings() << " widenings" << eom;
+
+  if(max!=0)
+    statistics() << "most updated location: "
+                 << max_location->source_location
+                 << " (" << max << " updates)" << eom;
+}
+
 tvt static_analyzert::eval(goto_programt::const_targett t)
 {
   exprt guard=t->guard;
@@ -230,7 +300,7 @@ void show_intervals(
   const goto_modelt &goto_model,
   std::ostream &out)
 {
-  ait<interval_domaint> interval_analysis;
+  interval_ait interval_analysis;
   interval_analysis(goto_model);
   interval_analysis.output(goto_model, out);
 }
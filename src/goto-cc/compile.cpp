@@ -14,10 +14,12 @@ Date: June 2006
 #include "compile.h"
 
 #include <fstream>
+#include <iomanip>
 #include <sstream>
 #include <iostream>
 #include <cstdlib>
 #include <algorithm>
+#include <cerrno>
 
 #include <util/config.h>
 #include <util/tempdir.h>
@@ -28,10 +30,13 @@ Date: June 2006
 #include <util/irep_serialization.h>
 #include <util/suffix.h>
 #include <util/get_base_name.h>
+#include <util/invariant.h>
+#include <util/string_hash.h>
 
 #include <ansi-c/ansi_c_language.h>
 #include <ansi-c/ansi_c_entry_point.h>
 
+#include <goto-programs/cprover_library_cache.h>
 #include <goto-programs/goto_convert.h>
 #include <goto-programs/goto_convert_functions.h>
 #include <goto-programs/goto_inline.h>
@@ -58,6 +63,8 @@ Date: June 2006
     defined(__CYGWIN__) || \
     defined(__MACH__)
 #include <unistd.h>
+#include <sys/wait.h>
+#include <utime.h>
 #endif
 
 #ifdef _WIN32
@@ -346,15 +353,11 @@ bool compilet::link()
   convert_symbols(compiled_functions);
 
   // parse object files
-  while(!object_files.empty())
-  {
-    std::string file_name=object_files.front();
-    object_files.pop_front();
+  if(read_objects_and_link(object_files, symbol_table,
+                           compiled_functions, get_message_handler()))
+    return true;
 
-    if(read_object_and_link(file_name, symbol_table,
-                            compiled_functions, get_message_handler()))
-      return true;
-  }
+  object_files.clear();
 
   // produce entry point?
 
@@ -387,32 +390,39 @@ bool compilet::link()
 /// \return true on error, false otherwise
 bool compilet::compile()
 {
+  #ifndef _WIN32
+  if(jobs>1 && source_files.size()>1 && mode!=PREPROCESS_ONLY)
+  {
+    bool has_java=false;
+
+    for(const auto &file_name : source_files)
+      if(has_suffix(file_name, ".class") || has_suffix(file_name, ".jar"))
+        has_java=true;
+
+    // Java classes are loaded together
+    if(!has_java)
+      return compile_parallel();
+  }
+  #endif
+
   while(!source_files.empty())
   {
     std::string file_name=source_files.front();
     source_files.pop_front();
 
-    // Visual Studio always prints the name of the file it's doing
-    if(echo_file_name)
-      status() << file_name << eom;
-
-    bool r=parse_source(file_name); // don't break the program!
+    std::string fingerprint;
 
-    if(r)
+    if(mode==COMPILE_ONLY || mode==ASSEMBLE_ONLY)
     {
-      const std::string &debug_outfile=
-        cmdline.get_value("print-rejected-preprocessed-source");
-      if(!debug_outfile.empty())
-      {
-        std::ifstream in(file_name, std::ios::binary);
-        std::ofstream out(debug_outfile, std::ios::binary);
-        out << in.rdbuf();
-        warning() << "Failed sources in " << debug_outfile << eom;
-      }
+      fingerprint=input_fingerprint(file_name);
 
-      return true; // parser/typecheck error
+      if(is_up_to_date(object_file_name(file_name), fingerprint))
+        continue;
     }
 
+    if(compile_source(file_name))
+      return true;
+
     if(mode==COMPILE_ONLY || mode==ASSEMBLE_ONLY)
     {
       // output an object file for every source file
@@ -420,14 +430,11 @@ bool compilet::compile()
       // "compile" functions
       convert_symbols(compiled_functions);
 
-      std::string cfn;
-
-      if(output_file_object=="")
-        cfn=get_base_name(file_name, true)+"."+object_file_extension;
-      else
-        cfn=output_file_object;
-
-      if(write_object_file(cfn, symbol_table, compiled_functions))
+      if(write_object_file(
+          object_file_name(file_name),
+          symbol_table,
+          compiled_functions,
+          fingerprint))
         return true;
 
       symbol_table.clear(); // clean symbol table for next source file.
@@ -438,6 +445,258 @@ bool compilet::compile()
   return false;
 }
 
+/// parses and typechecks a single source file into the symbol table
+/// \return true on error, false otherwise
+bool compilet::compile_source(const std::string &file_name)
+{
+  // Visual Studio always prints the name of the file it's doing
+  if(echo_file_name)
+    status() << file_name << eom;
+
+  bool r=parse_source(file_name); // don't break the program!
+
+  if(r)
+  {
+    const std::string &debug_outfile=
+      cmdline.get_value("print-rejected-preprocessed-source");
+    if(!debug_outfile.empty())
+    {
+      std::ifstream in(file_name, std::ios::binary);
+      std::ofstream out(debug_outfile, std::ios::binary);
+      out << in.rdbuf();
+      warning() << "Failed sources in " << debug_outfile << eom;
+    }
+
+    return true; // parser/typecheck error
+  }
+
+  return false;
+}
+
+/// \return the name of the object file for the given source file
+std::string compilet::object_file_name(const std::string &file_name) const
+{
+  if(output_file_object=="")
+    return get_base_name(file_name, true)+"."+object_file_extension;
+  else
+    return output_file_object;
+}
+
+/// The fingerprint of a source file is written after the goto binary,
+/// where readers of goto binaries ignore it.
+static std::string fingerprint_trailer(const std::string &fingerprint)
+{
+  std::ostringstream trailer;
+  trailer << char(0x7f) << "FPR";
+  write_gb_string(trailer, fingerprint);
+  return trailer.str();
+}
+
+/// \return a hash of a preprocessed source file and of the options that
+///   affect its translation, or the empty string if the file has not been
+///   preprocessed, and thus the headers it includes are not known
+std::string compilet::input_fingerprint(const std::string &file_name) const
+{
+  if(!has_suffix(file_name, ".i") && !has_suffix(file_name, ".ii"))
+    return "";
+
+  std::ifstream in(file_name, std::ios::binary);
+
+  if(!in)
+    return "";
+
+  std::ostringstream text;
+  text << in.rdbuf();
+
+  std::ostringstream options;
+  options << CBMC_VERSION << '\n'
+          << cprover_library_cachet::config_key()
+          << config.ansi_c.string_abstraction << ' '
+          << mode << ' ' << override_language << ' '
+          << get_base_name(file_name, true) << '\n';
+
+  std::ostringstream result;
+  result << std::hex << std::setfill('0')
+         << std::setw(16) << hash_string(options.str())
+         << std::setw(16) << hash_string(text.str());
+
+  return result.str();
+}
+
+/// Checks whether an existing object file was compiled from a source file
+/// with the given fingerprint, as in an incremental build. If so, the
+/// object file is touched, so that make considers it newer than the
+/// source file.
+/// \return true if the object file can be kept
+bool compilet::is_up_to_date(
+  const std::string &object_file,
+  const std::string &fingerprint)
+{
+  if(fingerprint.empty())
+    return false;
+
+  std::ifstream in(object_file, std::ios::binary);
+
+  char header[4];
+
+  if(!in.read(header, sizeof(header)) ||
+     header[0]!=0x7f || header[1]!='G' || header[2]!='B' || header[3]!='F')
+    return false;
+
+  const std::string trailer=fingerprint_trailer(fingerprint);
+
+  in.seekg(0, std::ios::end);
+  const std::streamoff size=in.tellg();
+
+  if(size<static_cast<std::streamoff>(sizeof(header)+trailer.size()))
+    return false;
+
+  in.seekg(size-static_cast<std::streamoff>(trailer.size()));
+
+  std::string data(trailer.size(), 0);
+
+  if(!in.read(&data[0], data.size()) || data!=trailer)
+    return false;
+
+  in.close();
+
+  #ifndef _WIN32
+  utime(object_file.c_str(), nullptr);
+  #endif
+
+  statistics() << "Object `" << object_file << "' is up to date" << eom;
+
+  return true;
+}
+
+/// Compiles up to `jobs` source files at a time, each in a process of its
+/// own with a symbol table of its own. Unless an object file is to be
+/// written for every source file, the objects are stored in a temporary
+/// directory and linked in the order of the source files, just as
+/// objects given on the command line.
+/// \return true on error, false otherwise
+bool compilet::compile_parallel()
+{
+  #ifdef _WIN32
+  UNREACHABLE;
+  #else
+  const bool keep_objects=mode==COMPILE_ONLY || mode==ASSEMBLE_ONLY;
+
+  std::list<std::string> objects;
+
+  if(!keep_objects)
+  {
+    char td[]="goto-cc.XXXXXX";
+    std::string tstr=get_temporary_directory(td);
+
+    if(tstr=="")
+    {
+      error() << "Cannot create temporary directory" << eom;
+      return true;
+    }
+
+    tmp_dirs.push_back(tstr);
+  }
+
+  statistics() << "Compiling " << source_files.size()
+               << " source files using " << jobs << " jobs" << eom;
+
+  std::size_t running=0, count=0;
+  bool failed=false;
+
+  while(!source_files.empty() || running>0)
+  {
+    if(!failed && !source_files.empty() && running<jobs)
+    {
+      const std::string file_name=source_files.front();
+      source_files.pop_front();
+
+      std::string object, fingerprint;
+
+      if(keep_objects)
+      {
+        object=object_file_name(file_name);
+        fingerprint=input_fingerprint(file_name);
+
+        if(is_up_to_date(object, fingerprint))
+          continue;
+      }
+      else
+      {
+        object=concat_dir_file(
+          tmp_dirs.back(), std::to_string(count)+"."+object_file_extension);
+        objects.push_back(object);
+      }
+
+      count++;
+
+      // don't let the child repeat buffered output
+      std::cout << std::flush;
+      std::cerr << std::flush;
+
+      pid_t childpid=fork();
+
+      if(childpid==0)
+      {
+        // the child starts off with the empty symbol table of the parent,
+        // and converts its functions by itself
+        jobs=1;
+        bool r=compile_source(file_name);
+
+        if(!r)
+        {
+          convert_symbols(compiled_functions);
+          r=write_object_file(
+            object, symbol_table, compiled_functions, fingerprint);
+        }
+
+        std::cout << std::flush;
+        std::cerr << std::flush;
+
+        _exit(r?1:0);
+      }
+      else if(childpid<0)
+      {
+        error() << "failed to start a compilation job for `"
+                << file_name << "'" << eom;
+        failed=true;
+      }
+      else
+        running++;
+
+      continue;
+    }
+
+    if(running==0)
+      break;
+
+    int status;
+
+    if(waitpid(-1, &status, 0)==-1)
+    {
+      if(errno==EINTR)
+        continue; // try again
+
+      error() << "waiting for compilation job failed" << eom;
+      return true;
+    }
+
+    running--;
+
+    if(!WIFEXITED(status) || WEXITSTATUS(status)!=0)
+      failed=true;
+  }
+
+  if(failed)
+    return true;
+
+  // the objects are linked before those given on the command line
+  object_files.splice(object_files.begin(), objects);
+
+  return false;
+  #endif
+}
+
 /// parses a source file (low-level parsing)
 /// \return true on error, false otherwise
 bool compilet::parse(const std::string &file_name)
@@ -579,9 +838,11 @@ bool compilet::parse_stdin()
 bool compilet::write_object_file(
   const std::string &file_name,
   const symbol_tablet &lsymbol_table,
-  goto_functionst &functions)
+  goto_functionst &functions,
+  const std::string &fingerprint)
 {
-  return write_bin_object_file(file_name, lsymbol_table, functions);
+  return write_bin_object_file(
+    file_name, lsymbol_table, functions, fingerprint);
 }
 
 /// writes the goto functions in the function table to a binary format object
@@ -591,7 +852,8 @@ bool compilet::write_object_file(
 bool compilet::write_bin_object_file(
   const std::string &file_name,
   const symbol_tablet &lsymbol_table,
-  goto_functionst &functions)
+  goto_functionst &functions,
+  const std::string &fingerprint)
 {
   statistics() << "Writing binary format object `"
                << file_name << "'" << eom;
@@ -611,6 +873,9 @@ bool compilet::write_bin_object_file(
   if(write_goto_binary(outfile, lsymbol_table, functions))
     return true;
 
+  if(!fingerprint.empty())
+    outfile << fingerprint_trailer(fingerprint);
+
   unsigned cnt=function_body_count(functions);
 
   statistics() << "Functions: " << functions.function_map.size()
@@ -651,6 +916,7 @@ compilet::compilet(cmdlinet &_cmdline, ui_message_handlert &mh, bool Werror):
 {
   mode=COMPILE_LINK_EXECUTABLE;
   echo_file_name=false;
+  jobs=1;
   working_directory=get_current_working_directory();
 }
 
@@ -688,6 +954,7 @@ void compilet::add_compiler_specific_defines(configt &config) const
 void compilet::convert_symbols(goto_functionst &dest)
 {
   goto_convert_functionst converter(symbol_table, dest, get_message_handler());
+  converter.jobs=jobs;
 
   // the compilation may add symbols!
 
@@ -703,13 +970,15 @@ void compilet::convert_symbols(goto_functionst &dest)
     Forall_symbols(it, symbol_table.symbols)
       symbols.insert(it->first);
 
-    // the symbol table iterators aren't stable
+    std::list<irep_idt> to_convert;
+
     for(symbols_sett::const_iterator
         it=symbols.begin();
         it!=symbols.end();
         ++it)
     {
-      symbol_tablet::symbolst::iterator s_it=symbol_table.symbols.find(*it);
+      symbol_tablet::symbolst::const_iterator s_it=
+        symbol_table.symbols.find(*it);
       assert(s_it!=symbol_table.symbols.end());
 
       if(s_it->second.type.id()==ID_code &&
@@ -719,9 +988,14 @@ void compilet::convert_symbols(goto_functionst &dest)
           s_it->second.value.is_not_nil())
       {
         debug() << "Compiling " << s_it->first << eom;
-        converter.convert_function(s_it->first);
-        s_it->second.value=exprt("compiled");
+        to_convert.push_back(s_it->first);
       }
     }
+
+    converter.convert_functions(to_convert);
+
+    // the symbol table iterators aren't stable
+    for(const auto &id : to_convert)
+      symbol_table.symbols.find(id)->second.value=exprt("compiled");
   }
 }
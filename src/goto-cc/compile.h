@@ -29,6 +29,9 @@ public:
   std::string working_directory;
   std::string override_language;
 
+  // number of source files that are compiled concurrently
+  unsigned jobs;
+
   enum { PREPROCESS_ONLY, // gcc -E
          COMPILE_ONLY, // gcc -c
          ASSEMBLE_ONLY, // gcc -S
@@ -66,16 +69,26 @@ public:
   bool write_object_file(
     const std::string &,
     const symbol_tablet &,
-    goto_functionst &);
+    goto_functionst &,
+    const std::string &fingerprint="");
   bool write_bin_object_file(
     const std::string &,
     const symbol_tablet &,
-    goto_functionst &);
+    goto_functionst &,
+    const std::string &fingerprint="");
 
 protected:
   cmdlinet &cmdline;
   bool warning_is_fatal;
 
+  bool compile_source(const std::string &);
+  bool compile_parallel();
+  std::string object_file_name(const std::string &) const;
+  std::string input_fingerprint(const std::string &) const;
+  bool is_up_to_date(
+    const std::string &object_file,
+    const std::string &fingerprint);
+
   unsigned function_body_count(const goto_functionst &);
 
   void add_compiler_specific_defines(class configt &config) const;
@@ -29,6 +29,8 @@ const char *goto_cc_options_with_separated_argument[]=
   "--native-compiler",
   "--native-linker",
   "--print-rejected-preprocessed-source",
+  "--jobs",
+  "--header-cache",
   nullptr
 };
 
@@ -51,6 +53,7 @@ const char *goto_cc_options_without_argument[]=
   "--big-endian",
   "--no-arch",
   "--partial-inlining",
+  "--builtin-preprocessor",
   "-?",
   nullptr
 };
@@ -33,6 +33,8 @@ Author: CM Wintersteiger, 2006
 #include <util/get_base_name.h>
 #include <util/run.h>
 
+#include <ansi-c/c_preprocess.h>
+
 #include <cbmc/version.h>
 
 #include "compile.h"
@@ -496,6 +498,9 @@ int gcc_modet::doit()
                     cmdline.isset("Wextra") &&
                     !cmdline.isset("Wno-error"));
 
+  if(cmdline.isset("jobs"))
+    compiler.jobs=unsafe_string2unsigned(cmdline.get_value("jobs"));
+
   if(act_as_ld)
     compiler.mode=compilet::LINK_LIBRARY;
   else if(cmdline.isset('S'))
@@ -719,6 +724,22 @@ int gcc_modet::preprocess(
   const std::string &dest,
   bool act_as_bcc)
 {
+  // The built-in preprocessor saves running the native one for each
+  // file, but handles C only.
+  if(config.ansi_c.preprocessor==configt::ansi_ct::preprocessort::BUILTIN &&
+     (language=="c" || (language=="" && has_suffix(src, ".c"))))
+  {
+    std::ofstream out(dest);
+
+    if(!out)
+    {
+      error() << "failed to open `" << dest << "'" << eom;
+      return EX_SOFTWARE;
+    }
+
+    return c_preprocess(src, out, get_message_handler())?EX_SOFTWARE:EX_OK;
+  }
+
   // build new argv
   std::vector<std::string> new_argv;
 
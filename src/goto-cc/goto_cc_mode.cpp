@@ -64,6 +64,10 @@ void goto_cc_modet::help()
   " --native-assembler cmd      command to invoke as assembler (goto-as only)\n"
   " --print-rejected-preprocessed-source file\n"
   "                             copy failing (preprocessed) source to file\n"
+  " --jobs n                    compile up to n source files or functions\n"
+  "                             concurrently\n"
+  " --header-cache dir          reuse headers parsed by earlier runs in dir\n"
+  " --builtin-preprocessor      preprocess C without the native compiler\n"
   "\n";
 }
 
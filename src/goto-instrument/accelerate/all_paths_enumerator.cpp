@@ -138,7 +138,7 @@ void all_paths_enumeratort::extend_path(
   {
     guard=not_exprt(t->guard);
 
-    for(goto_programt::targetst::iterator it=t->targets.begin();
+    for(goto_programt::instructiont::targetst::iterator it=t->targets.begin();
         it != t->targets.end();
         ++it)
     {
@@ -90,7 +90,8 @@ void cone_of_influencet::get_succs(
     if(!rit->guard.is_false())
     {
       // Branch can be taken.
-      for(goto_programt::targetst::const_iterator t=rit->targets.begin();
+      for(goto_programt::instructiont::targetst::const_iterator
+            t=rit->targets.begin();
           t != rit->targets.end();
           ++t)
       {
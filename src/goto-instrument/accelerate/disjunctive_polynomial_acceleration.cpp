@@ -835,7 +835,8 @@ void disjunctive_polynomial_accelerationt::build_path(
       // appropriate guard.
       cond=not_exprt(t->guard);
 
-      for(goto_programt::targetst::iterator it=t->targets.begin();
+      for(goto_programt::instructiont::targetst::iterator
+            it=t->targets.begin();
           it!=t->targets.end();
           ++it)
       {
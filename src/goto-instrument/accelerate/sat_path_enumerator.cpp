@@ -187,7 +187,8 @@ void sat_path_enumeratort::build_path(
       // appropriate guard.
       cond=not_exprt(t->guard);
 
-      for(goto_programt::targetst::iterator it=t->targets.begin();
+      for(goto_programt::instructiont::targetst::iterator
+            it=t->targets.begin();
           it!=t->targets.end();
           ++it)
       {
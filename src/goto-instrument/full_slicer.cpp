@@ -158,11 +158,13 @@ void full_slicert::add_jumps(
 
     assert(e!=pd.cfg.entry_map.end());
 
-    const cfg_post_dominatorst::cfgt::nodet &n=
-      pd.cfg[e->second];
+    cfg_post_dominatorst::cfgt::entry_mapt::const_iterator e_lex=
+      pd.cfg.entry_map.find(lex_succ);
+
+    assert(e_lex!=pd.cfg.entry_map.end());
 
     // find the nearest post-dominator in slice
-    if(n.dominators.find(lex_succ)==n.dominators.end())
+    if(!pd.dominates_node(e_lex->second, e->second))
     {
       add_to_queue(queue, *it, lex_succ);
       jumps.erase(it);
@@ -170,36 +172,24 @@ void full_slicert::add_jumps(
     else
     {
       // check whether the nearest post-dominator is different from
-      // lex_succ
+      // lex_succ; walk up the post-dominator tree, which reaches
+      // lex_succ at the latest
       goto_programt::const_targett nearest=lex_succ;
-      std::size_t post_dom_size=0;
-      for(cfg_dominatorst::target_sett::const_iterator
-          d_it=n.dominators.begin();
-          d_it!=n.dominators.end();
-          ++d_it)
+      for(cfg_post_dominatorst::entryt d=e->second;
+          pd.has_immediate_dominator(d);
+          ) // no ++d
       {
+        d=pd.immediate_dominator(d);
+        const goto_programt::const_targett d_pc=pd.cfg[d].PC;
+
         cfgt::entry_mapt::const_iterator entry=
-          cfg.entry_map.find(*d_it);
+          cfg.entry_map.find(d_pc);
         assert(entry!=cfg.entry_map.end());
 
         if(cfg[entry->second].node_required)
         {
-          const irep_idt id2=goto_programt::get_function_id(*d_it);
-          assert(id==id2);
-
-          cfg_post_dominatorst::cfgt::entry_mapt::const_iterator e2=
-            pd.cfg.entry_map.find(*d_it);
-
-          assert(e2!=pd.cfg.entry_map.end());
-
-          const cfg_post_dominatorst::cfgt::nodet &n2=
-            pd.cfg[e2->second];
-
-          if(n2.dominators.size()>post_dom_size)
-          {
-            nearest=*d_it;
-            post_dom_size=n2.dominators.size();
-          }
+          nearest=d_pc;
+          break;
         }
       }
       if(nearest!=lex_succ)
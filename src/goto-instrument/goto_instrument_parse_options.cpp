@@ -19,6 +19,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/string2int.h>
 #include <util/unicode.h>
 #include <util/json.h>
+#include <util/time_stopping.h>
 
 #include <goto-programs/goto_convert_functions.h>
 #include <goto-programs/remove_function_pointers.h>
@@ -50,6 +51,8 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <analyses/natural_loops.h>
 #include <analyses/global_may_alias.h>
 #include <analyses/local_bitvector_analysis.h>
+#include <analyses/live_variables.h>
+#include <analyses/available_expressions.h>
 #include <analyses/custom_bitvector_analysis.h>
 #include <analyses/escape_analysis.h>
 #include <analyses/call_graph.h>
@@ -58,6 +61,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <analyses/reaching_definitions.h>
 #include <analyses/dependence_graph.h>
 #include <analyses/constant_propagator.h>
+#include <analyses/sparse_constant_propagator.h>
 #include <analyses/is_threaded.h>
 
 #include <cbmc/version.h>
@@ -314,6 +318,44 @@ int goto_instrument_parse_optionst::doit()
       return 0;
     }
 
+    if(cmdline.isset("show-live-variables"))
+    {
+      do_indirect_call_and_rtti_removal();
+
+      namespacet ns(symbol_table);
+
+      forall_goto_functions(it, goto_functions)
+      {
+        live_variablest live_variables(it->second);
+        std::cout << ">>>>\n";
+        std::cout << ">>>> " << it->first << '\n';
+        std::cout << ">>>>\n";
+        live_variables.output(std::cout, it->second, ns);
+        std::cout << '\n';
+      }
+
+      return 0;
+    }
+
+    if(cmdline.isset("show-available-expressions"))
+    {
+      do_indirect_call_and_rtti_removal();
+
+      namespacet ns(symbol_table);
+
+      forall_goto_functions(it, goto_functions)
+      {
+        available_expressionst available_expressions(it->second);
+        std::cout << ">>>>\n";
+        std::cout << ">>>> " << it->first << '\n';
+        std::cout << ">>>>\n";
+        available_expressions.output(std::cout, it->second, ns);
+        std::cout << '\n';
+      }
+
+      return 0;
+    }
+
     if(cmdline.isset("show-custom-bitvector-analysis"))
     {
       do_indirect_call_and_rtti_removal();
@@ -418,7 +460,7 @@ int goto_instrument_parse_optionst::doit()
 
       status() << "Interval Analysis" << eom;
       namespacet ns(symbol_table);
-      ait<interval_domaint> interval_analysis;
+      interval_ait interval_analysis;
       interval_analysis(goto_functions, ns);
 
       interval_analysis.output(ns, goto_functions, std::cout);
@@ -806,7 +848,7 @@ void goto_instrument_parse_optionst::do_indirect_call_and_rtti_removal(
   status() << "Virtual function removal" << eom;
   remove_virtual_functions(symbol_table, goto_functions);
   status() << "Catch and throw removal" << eom;
-  remove_exceptions(symbol_table, goto_functions);
+  remove_exceptions(symbol_table, goto_functions, get_message_handler());
   status() << "Java instanceof removal" << eom;
   remove_instanceof(symbol_table, goto_functions);
 }
@@ -1126,6 +1168,18 @@ void goto_instrument_parse_optionst::instrument_goto_program()
     remove_skip(goto_functions);
   }
 
+  if(cmdline.isset("sparse-constant-propagator"))
+  {
+    do_indirect_call_and_rtti_removal();
+
+    status() << "Propagating Constants (sparse)" << eom;
+
+    sparse_constant_propagatort sparse_constant_propagator(
+      goto_functions, ns);
+
+    remove_skip(goto_functions);
+  }
+
   // add generic checks, if needed
   goto_check(ns, options, goto_functions);
 
@@ -1428,10 +1482,16 @@ void goto_instrument_parse_optionst::instrument_goto_program()
     do_indirect_call_and_rtti_removal();
 
     status() << "Performing a full slice" << eom;
+    absolute_timet slice_start=current_time();
+
     if(cmdline.isset("property"))
       property_slicer(goto_functions, ns, cmdline.get_values("property"));
     else
       full_slicer(goto_functions, ns);
+
+    absolute_timet slice_stop=current_time();
+    statistics() << "Runtime full slicer: "
+                 << (slice_stop-slice_start) << "s" << eom;
   }
 
   // recalculate numbers, etc.
@@ -1473,6 +1533,8 @@ void goto_instrument_parse_optionst::help()
     " --list-undefined-functions   list functions without body\n"
     " --show-struct-alignment      show struct members that might be concurrently accessed\n" // NOLINT(*)
     " --show-natural-loops         show natural loop heads\n"
+    " --show-live-variables        show live local variables\n"
+    " --show-available-expressions show available expressions\n"
     // NOLINTNEXTLINE(whitespace/line_length)
     " --list-calls-args            list all function calls with their arguments\n"
     "\n"
@@ -1530,6 +1592,7 @@ void goto_instrument_parse_optionst::help()
     "\n"
     "Further transformations:\n"
     " --constant-propagator        propagate constants and simplify expressions\n" // NOLINT(*)
+    " --sparse-constant-propagator propagate constants of local variables along def-use chains\n" // NOLINT(*)
     " --inline                     perform full inlining\n"
     " --partial-inline             perform partial inlining\n"
     " --function-inline <function> transitively inline all calls <function> makes\n" // NOLINT(*)
@@ -1538,6 +1601,7 @@ void goto_instrument_parse_optionst::help()
     " --remove-function-pointers   replace function pointers by case statement over function calls\n" // NOLINT(*)
     HELP_REMOVE_CONST_FUNCTION_POINTERS
     " --add-library                add models of C library functions\n"
+    " --cprover-library-cache dir  reuse library models precompiled in dir\n"
     " --model-argc-argv <n>        model up to <n> command line arguments\n"
     // NOLINTNEXTLINE(whitespace/line_length)
     " --remove-function-body <f>   remove the implementation of function <f> (may be repeated)\n"
@@ -131,7 +131,7 @@ void havoc_loopst::havoc_loop(
     goto_programt::instructiont &instruction=**l_it;
     if(instruction.is_goto())
     {
-      for(goto_programt::targetst::iterator
+      for(goto_programt::instructiont::targetst::iterator
           t_it=instruction.targets.begin();
           t_it!=instruction.targets.end();
           t_it++)
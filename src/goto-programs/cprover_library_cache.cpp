@@ -0,0 +1,209 @@
+/*******************************************************************\
+
+Module: Precompiled CPROVER Library
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Precompiled CPROVER Library
+
+#include "cprover_library_cache.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include <util/config.h>
+#include <util/irep_serialization.h>
+#include <util/string_hash.h>
+
+#include <ansi-c/ansi_c_language.h>
+#include <ansi-c/cprover_library.h>
+
+#include <linking/linking.h>
+
+#include "read_bin_goto_object.h"
+#include "write_goto_binary.h"
+
+/// \return the parts of the configuration that affect the preprocessing
+///   and typechecking of the library
+std::string cprover_library_cachet::config_key()
+{
+  const configt::ansi_ct &ansi_c=config.ansi_c;
+
+  std::ostringstream key;
+
+  key << ansi_c.int_width << ' ' << ansi_c.long_int_width << ' '
+      << ansi_c.bool_width << ' ' << ansi_c.char_width << ' '
+      << ansi_c.short_int_width << ' ' << ansi_c.long_long_int_width << ' '
+      << ansi_c.pointer_width << ' ' << ansi_c.single_width << ' '
+      << ansi_c.double_width << ' ' << ansi_c.long_double_width << ' '
+      << ansi_c.wchar_t_width << ' '
+      << ansi_c.char_is_unsigned << ansi_c.wchar_t_is_unsigned
+      << ansi_c.use_fixed_for_float << ansi_c.for_has_scope
+      << ansi_c.single_precision_constant << ansi_c.NULL_is_zero << ' '
+      << static_cast<int>(ansi_c.c_standard) << ' '
+      << static_cast<int>(ansi_c.rounding_mode) << ' '
+      << ansi_c.alignment << ' ' << ansi_c.memory_operand_size << ' '
+      << static_cast<int>(ansi_c.endianness) << ' '
+      << static_cast<int>(ansi_c.os) << ' '
+      << ansi_c.arch << ' '
+      << static_cast<int>(ansi_c.mode) << ' '
+      << static_cast<int>(ansi_c.preprocessor) << '\n';
+
+  for(const auto &list : { &ansi_c.defines,
+                           &ansi_c.undefines,
+                           &ansi_c.preprocessor_options,
+                           &ansi_c.include_paths,
+                           &ansi_c.include_files })
+  {
+    for(const auto &s : *list)
+      key << s << '\n';
+    key << '\n';
+  }
+
+  return key.str();
+}
+
+std::string cprover_library_cachet::file_name(const std::string &key) const
+{
+  std::ostringstream result;
+
+  result << directory;
+#ifdef _WIN32
+  result << '\\';
+#else
+  result << '/';
+#endif
+  result << std::hex << std::setw(16) << std::setfill('0')
+         << hash_string(key) << ".gb";
+
+  return result.str();
+}
+
+/// The key is stored in front of the goto binary, and compared in full,
+/// as the file name is merely its hash.
+/// \return true if there is no valid entry
+bool cprover_library_cachet::read(
+  const std::string &file_name,
+  const std::string &key,
+  symbol_tablet &symbol_table)
+{
+  std::ifstream in(file_name, std::ios::binary);
+
+  if(!in)
+    return true;
+
+  const std::size_t key_size=irep_serializationt::read_gb_word(in);
+
+  if(!in || key_size!=key.size())
+    return true;
+
+  std::string stored_key(key_size, '\0');
+  in.read(&stored_key[0], key_size);
+
+  if(!in || stored_key!=key)
+    return true;
+
+  goto_functionst goto_functions;
+
+  return read_bin_goto_object(
+    in, file_name, symbol_table, goto_functions, get_message_handler());
+}
+
+/// Entries are written to a temporary file first, which protects
+/// concurrent readers from partially written entries.
+/// \return true on error
+bool cprover_library_cachet::write(
+  const std::string &file_name,
+  const std::string &key,
+  const symbol_tablet &symbol_table)
+{
+  const std::string tmp_name=file_name+".tmp";
+
+  {
+    std::ofstream out(tmp_name, std::ios::binary);
+
+    write_gb_word(out, key.size());
+    out.write(key.data(), key.size());
+
+    goto_functionst goto_functions;
+    if(!out ||
+       write_goto_binary(out, symbol_table, goto_functions) ||
+       !out)
+    {
+      warning() << "failed to write library cache entry "
+                << file_name << eom;
+      return true;
+    }
+  }
+
+  if(std::rename(tmp_name.c_str(), file_name.c_str())!=0)
+  {
+    std::remove(tmp_name.c_str());
+    warning() << "failed to write library cache entry "
+              << file_name << eom;
+    return true;
+  }
+
+  return false;
+}
+
+void cprover_library_cachet::add(
+  const std::set<irep_idt> &functions,
+  symbol_tablet &symbol_table)
+{
+  const std::string prologue=get_cprover_library_prologue();
+
+  for(const auto &id : functions)
+  {
+    symbol_tablet::symbolst::const_iterator old=
+      symbol_table.symbols.find(id);
+
+    if(old==symbol_table.symbols.end() ||
+       old->second.value.is_not_nil())
+      continue;
+
+    const std::string model=get_cprover_library_model(id);
+
+    if(model.empty())
+      continue;
+
+    const std::string text=prologue+model;
+    const std::string key=config_key()+text;
+    const std::string name=file_name(key);
+
+    symbol_tablet model_symbol_table;
+
+    if(read(name, key, model_symbol_table))
+    {
+      misses++;
+      model_symbol_table.clear();
+
+      std::istringstream in(text);
+
+      ansi_c_languaget ansi_c_language;
+      ansi_c_language.set_message_handler(get_message_handler());
+
+      if(ansi_c_language.parse(in, "") ||
+         ansi_c_language.typecheck(model_symbol_table, "<built-in-library>"))
+        continue;
+
+      write(name, key, model_symbol_table);
+    }
+    else
+      hits++;
+
+    if(linking(symbol_table, model_symbol_table, get_message_handler()))
+    {
+      error() << "failed to link library model of `" << id << "'" << eom;
+      throw 0;
+    }
+  }
+
+  debug() << "library cache: " << hits << " hits, "
+          << misses << " misses" << eom;
+}
@@ -0,0 +1,61 @@
+/*******************************************************************\
+
+Module: Precompiled CPROVER Library
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Precompiled CPROVER Library
+
+#ifndef CPROVER_GOTO_PROGRAMS_CPROVER_LIBRARY_CACHE_H
+#define CPROVER_GOTO_PROGRAMS_CPROVER_LIBRARY_CACHE_H
+
+#include <set>
+#include <string>
+
+#include <util/message.h>
+#include <util/symbol_table.h>
+
+/// Stores the typechecked models of the CPROVER library in a directory,
+/// one goto binary per library function and configuration, so that they
+/// are parsed and typechecked only once. An entry is found by a hash of
+/// the model and of the configuration that affects its typechecking,
+/// and is only used if the model and configuration it records match.
+/// Each model is typechecked separately, and only the models of the
+/// functions that are needed are linked in.
+class cprover_library_cachet:public messaget
+{
+public:
+  explicit cprover_library_cachet(const std::string &_directory):
+    directory(_directory),
+    hits(0),
+    misses(0)
+  {
+  }
+
+  /// adds the models of those of the given functions that are declared,
+  /// but have no body yet
+  void add(const std::set<irep_idt> &functions, symbol_tablet &);
+
+  static std::string config_key();
+
+protected:
+  const std::string directory;
+
+  std::size_t hits, misses;
+
+  std::string file_name(const std::string &key) const;
+
+  bool read(
+    const std::string &file_name,
+    const std::string &key,
+    symbol_tablet &);
+  bool write(
+    const std::string &file_name,
+    const std::string &key,
+    const symbol_tablet &);
+};
+
+#endif // CPROVER_GOTO_PROGRAMS_CPROVER_LIBRARY_CACHE_H
@@ -11,7 +11,6 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "goto_convert_class.h"
 
-#include <util/fresh_symbol.h>
 #include <util/simplify_expr.h>
 #include <util/std_expr.h>
 #include <util/rename.h>
@@ -26,13 +25,7 @@ symbol_exprt goto_convertt::make_compound_literal(
   const source_locationt source_location=expr.find_source_location();
 
   symbolt &new_symbol=
-    get_fresh_aux_symbol(
-      expr.type(),
-      tmp_symbol_prefix,
-      "literal",
-      source_location,
-      irep_idt(),
-      symbol_table);
+    new_aux_symbol(expr.type(), "literal", source_location);
   new_symbol.is_static_lifetime=source_location.get_function().empty();
   new_symbol.value=expr;
 
@@ -15,7 +15,6 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <util/cprover_prefix.h>
 #include <util/expr_util.h>
-#include <util/fresh_symbol.h>
 #include <util/prefix.h>
 #include <util/std_expr.h>
 #include <util/symbol_table.h>
@@ -362,7 +361,7 @@ void goto_convertt::convert_label(
   dest.destructive_append(tmp);
 
   targets.labels.insert({label, {target, targets.destructor_stack}});
-  target->labels.push_front(label);
+  target->labels.insert(target->labels.begin(), label);
 }
 
 void goto_convertt::convert_gcc_local_label(
@@ -2116,13 +2115,7 @@ symbolt &goto_convertt::new_tmp_symbol(
   const source_locationt &source_location)
 {
   symbolt &new_symbol=
-    get_fresh_aux_symbol(
-      type,
-      tmp_symbol_prefix,
-      "tmp_"+suffix,
-      source_location,
-      irep_idt(),
-      symbol_table);
+    new_aux_symbol(type, "tmp_"+suffix, source_location);
 
   code_declt decl;
   decl.symbol()=new_symbol.symbol_expr();
@@ -2132,6 +2125,31 @@ symbolt &goto_convertt::new_tmp_symbol(
   return new_symbol;
 }
 
+/// Adds an auxiliary symbol named tmp_symbol_prefix::basename_prefix$n.
+/// The symbols are numbered for each function separately, which makes
+/// their names independent of the order the functions are converted in.
+symbolt &goto_convertt::new_aux_symbol(
+  const typet &type,
+  const std::string &basename_prefix,
+  const source_locationt &source_location)
+{
+  auxiliary_symbolt new_symbol;
+  symbolt *symbol_ptr;
+
+  do
+  {
+    new_symbol.base_name=
+      basename_prefix+"$"+std::to_string(++aux_symbol_counter);
+    new_symbol.name=
+      tmp_symbol_prefix+"::"+id2string(new_symbol.base_name);
+    new_symbol.type=type;
+    new_symbol.location=source_location;
+  }
+  while(symbol_table.move(new_symbol, symbol_ptr));
+
+  return *symbol_ptr;
+}
+
 void goto_convertt::make_temp_symbol(
   exprt &expr,
   const std::string &suffix,
@@ -35,6 +35,7 @@ public:
     symbol_table(_symbol_table),
     ns(_symbol_table),
     temporary_counter(0),
+    aux_symbol_counter(0),
     tmp_symbol_prefix("goto_convertt")
   {
   }
@@ -47,6 +48,7 @@ protected:
   symbol_tablet &symbol_table;
   namespacet ns;
   unsigned temporary_counter;
+  unsigned aux_symbol_counter;
   std::string tmp_symbol_prefix;
 
   void goto_convert_rec(const codet &code, goto_programt &dest);
@@ -63,6 +65,11 @@ protected:
     goto_programt &dest,
     const source_locationt &);
 
+  symbolt &new_aux_symbol(
+    const typet &type,
+    const std::string &basename_prefix,
+    const source_locationt &);
+
   symbol_exprt make_compound_literal(
     const exprt &expr,
     goto_programt &dest);
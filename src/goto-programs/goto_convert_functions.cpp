@@ -10,20 +10,33 @@ Date: June 2003
 
 #include "goto_convert_functions.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cerrno>
+#include <iostream>
 
 #include <util/base_type.h>
+#include <util/invariant.h>
 #include <util/std_code.h>
 #include <util/symbol_table.h>
 #include <util/prefix.h>
+#include <util/tempfile.h>
 
 #include "goto_inline.h"
+#include "read_goto_binary.h"
+#include "write_goto_binary.h"
+
+#ifndef _WIN32
+#include <unistd.h>
+#include <sys/wait.h>
+#endif
 
 goto_convert_functionst::goto_convert_functionst(
   symbol_tablet &_symbol_table,
   goto_functionst &_functions,
   message_handlert &_message_handler):
   goto_convertt(_symbol_table, _message_handler),
+  jobs(1),
   functions(_functions)
 {
 }
@@ -51,10 +64,7 @@ void goto_convert_functionst::goto_convert()
       symbol_list.push_back(it->first);
   }
 
-  for(const auto &id : symbol_list)
-  {
-    convert_function(id);
-  }
+  convert_functions(symbol_list);
 
   functions.compute_location_numbers();
 
@@ -70,6 +80,209 @@ void goto_convert_functionst::goto_convert()
   #endif
 }
 
+/// Converts the given functions. With more than one job, the functions
+/// are shared out among processes, as ireps must not be shared among
+/// threads. Each process returns the functions it has converted and the
+/// symbols it has added or changed in a goto binary, which are read back
+/// in the order of the processes. The functions and symbols are the same
+/// as those obtained by converting the functions one by one.
+void goto_convert_functionst::convert_functions(
+  const std::list<irep_idt> &identifiers)
+{
+  #ifndef _WIN32
+  if(jobs>1 && identifiers.size()>1)
+  {
+    convert_functions_parallel(identifiers);
+    return;
+  }
+  #endif
+
+  for(const auto &id : identifiers)
+    convert_function(id);
+}
+
+void goto_convert_functionst::convert_functions_parallel(
+  const std::list<irep_idt> &identifiers)
+{
+  #ifdef _WIN32
+  UNREACHABLE;
+  #else
+  std::vector<irep_idt> pending;
+  pending.reserve(identifiers.size());
+
+  for(const auto &id : identifiers)
+  {
+    goto_functionst::goto_functiont &f=functions.function_map[id];
+    f.type=to_code_type(ns.lookup(id).type);
+
+    if(!f.body_available())
+      pending.push_back(id);
+  }
+
+  const std::size_t workers=std::min<std::size_t>(jobs, pending.size());
+
+  if(workers<2)
+  {
+    for(const auto &id : pending)
+      convert_function(id);
+    return;
+  }
+
+  // the children compare against this to find the symbols they changed
+  const symbol_tablet::symbolst original_symbols=symbol_table.symbols;
+
+  statistics() << "Converting " << pending.size()
+               << " functions using " << workers << " jobs" << eom;
+
+  std::vector<temporary_filet> results;
+  results.reserve(workers);
+  std::vector<pid_t> children;
+  bool failed=false;
+
+  // don't let the children repeat buffered output
+  std::cout << std::flush;
+  std::cerr << std::flush;
+
+  for(std::size_t i=0; i<workers; i++)
+  {
+    results.emplace_back("goto_convert_", ".gb");
+
+    pid_t childpid=fork();
+
+    if(childpid==0)
+    {
+      bool r=convert_share(
+        pending, i, workers, original_symbols, results.back()());
+
+      std::cout << std::flush;
+      std::cerr << std::flush;
+
+      _exit(r?1:0);
+    }
+    else if(childpid<0)
+    {
+      error() << "failed to start a conversion job" << eom;
+      failed=true;
+      break;
+    }
+
+    children.push_back(childpid);
+  }
+
+  for(const auto childpid : children)
+  {
+    int status;
+
+    while(waitpid(childpid, &status, 0)==-1)
+    {
+      if(errno!=EINTR)
+      {
+        error() << "waiting for conversion job failed" << eom;
+        throw 0;
+      }
+    }
+
+    if(!WIFEXITED(status) || WEXITSTATUS(status)!=0)
+      failed=true;
+  }
+
+  if(failed)
+  {
+    error() << "conversion of function bodies failed" << eom;
+    throw 0;
+  }
+
+  for(const auto &result : results)
+    merge_share(result());
+  #endif
+}
+
+/// Reads the functions and symbols that a process returned. Symbols that
+/// the process changed replace those in the symbol table.
+void goto_convert_functionst::merge_share(const std::string &file_name)
+{
+  symbol_tablet share_symbols;
+
+  if(read_goto_binary(
+       file_name, share_symbols, functions, get_message_handler()))
+    throw 0;
+
+  forall_symbols(it, share_symbols.symbols)
+  {
+    symbol_tablet::symbolst::iterator s_it=
+      symbol_table.symbols.find(it->first);
+
+    if(s_it==symbol_table.symbols.end())
+      symbol_table.add(it->second);
+    else
+      s_it->second=it->second;
+  }
+}
+
+/// Converts every `step`-th function of `identifiers`, beginning with
+/// the one at `first`, and writes them to `file_name` together with the
+/// symbols that are not in `original_symbols` or differ from those there.
+/// Runs in a process of its own.
+/// \return true on error, false otherwise
+bool goto_convert_functionst::convert_share(
+  const std::vector<irep_idt> &identifiers,
+  std::size_t first,
+  std::size_t step,
+  const symbol_tablet::symbolst &original_symbols,
+  const std::string &file_name)
+{
+  const unsigned errors_before=
+    get_message_handler().get_message_count(M_ERROR);
+
+  try
+  {
+    for(std::size_t i=first; i<identifiers.size(); i+=step)
+      convert_function(identifiers[i]);
+  }
+
+  catch(int)
+  {
+    return true;
+  }
+
+  catch(const char *e)
+  {
+    error() << e << eom;
+    return true;
+  }
+
+  catch(const std::string &e)
+  {
+    error() << e << eom;
+    return true;
+  }
+
+  if(get_message_handler().get_message_count(M_ERROR)!=errors_before)
+    return true;
+
+  symbol_tablet new_symbols;
+
+  forall_symbols(it, symbol_table.symbols)
+  {
+    symbol_tablet::symbolst::const_iterator o_it=
+      original_symbols.find(it->first);
+
+    // unchanged symbols share their ireps, and compare quickly
+    if(o_it==original_symbols.end() ||
+       o_it->second.to_irep()!=it->second.to_irep())
+      new_symbols.add(it->second);
+  }
+
+  goto_functionst converted;
+
+  for(std::size_t i=first; i<identifiers.size(); i+=step)
+    converted.function_map[identifiers[i]].swap(
+      functions.function_map[identifiers[i]]);
+
+  return write_goto_binary(
+    file_name, new_symbols, converted, get_message_handler());
+}
+
 bool goto_convert_functionst::hide(const goto_programt &goto_program)
 {
   forall_goto_program_instructions(i_it, goto_program)
@@ -143,6 +356,7 @@ void goto_convert_functionst::convert_function(const irep_idt &identifier)
   // make tmp variables local to function
   tmp_symbol_prefix=id2string(symbol.name)+"::$tmp::";
   temporary_counter=0;
+  aux_symbol_counter=0;
 
   f.type=to_code_type(symbol.type);
   if(f.body_available())
@@ -243,13 +457,15 @@ void goto_convert(
 void goto_convert(
   symbol_tablet &symbol_table,
   goto_functionst &functions,
-  message_handlert &message_handler)
+  message_handlert &message_handler,
+  unsigned jobs)
 {
   const unsigned errors_before=
     message_handler.get_message_count(messaget::M_ERROR);
 
   goto_convert_functionst goto_convert_functions(
     symbol_table, functions, message_handler);
+  goto_convert_functions.jobs=jobs;
 
   try
   {
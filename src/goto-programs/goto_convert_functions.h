@@ -14,14 +14,18 @@ Date: June 2003
 #ifndef CPROVER_GOTO_PROGRAMS_GOTO_CONVERT_FUNCTIONS_H
 #define CPROVER_GOTO_PROGRAMS_GOTO_CONVERT_FUNCTIONS_H
 
+#include <list>
+#include <vector>
+
 #include "goto_model.h"
 #include "goto_convert_class.h"
 
-// convert it all!
+// convert it all, using up to 'jobs' processes
 void goto_convert(
   symbol_tablet &symbol_table,
   goto_functionst &functions,
-  message_handlert &);
+  message_handlert &,
+  unsigned jobs=1);
 
 // confusing, will go away
 void goto_convert(
@@ -46,6 +50,7 @@ class goto_convert_functionst:public goto_convertt
 public:
   void goto_convert();
   void convert_function(const irep_idt &identifier);
+  void convert_functions(const std::list<irep_idt> &identifiers);
 
   goto_convert_functionst(
     symbol_tablet &_symbol_table,
@@ -54,9 +59,21 @@ public:
 
   virtual ~goto_convert_functionst();
 
+  // the number of processes that convert_functions may use
+  unsigned jobs;
+
 protected:
   goto_functionst &functions;
 
+  void convert_functions_parallel(const std::list<irep_idt> &identifiers);
+  bool convert_share(
+    const std::vector<irep_idt> &identifiers,
+    std::size_t first,
+    std::size_t step,
+    const symbol_tablet::symbolst &original_symbols,
+    const std::string &file_name);
+  void merge_share(const std::string &file_name);
+
   static bool hide(const goto_programt &);
 
   //
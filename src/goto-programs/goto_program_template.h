@@ -12,6 +12,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef CPROVER_GOTO_PROGRAMS_GOTO_PROGRAM_TEMPLATE_H
 #define CPROVER_GOTO_PROGRAMS_GOTO_PROGRAM_TEMPLATE_H
 
+#include <algorithm>
 #include <cassert>
 #include <iosfwd>
 #include <set>
@@ -20,6 +21,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <string>
 
 #include <util/namespace.h>
+#include <util/small_vector.h>
 #include <util/symbol_table.h>
 #include <util/source_location.h>
 #include <util/std_expr.h>
@@ -164,12 +166,12 @@ public:
     /// The function this instruction belongs to
     irep_idt function;
 
-    /// The location of the instruction in the source file
-    source_locationt source_location;
-
     /// What kind of instruction?
     goto_program_instruction_typet type;
 
+    /// The location of the instruction in the source file
+    source_locationt source_location;
+
     /// Guard for gotos, assume, assert
     guardT guard;
 
@@ -177,10 +179,11 @@ public:
     /// The target for gotos and for start_thread nodes
     typedef typename std::list<instructiont>::iterator targett;
     typedef typename std::list<instructiont>::const_iterator const_targett;
-    typedef std::list<targett> targetst;
-    typedef std::list<const_targett> const_targetst;
+    typedef small_vectort<targett> targetst;
+    typedef small_vectort<const_targett> const_targetst;
 
-    /// The list of successor instructions
+    /// The list of successor instructions; there is at most one in
+    /// all but a few cases, which needs no storage beyond the instruction
     targetst targets;
 
     /// Returns the first (and only) successor for the usual case of a single
@@ -200,11 +203,19 @@ public:
     }
 
     /// Goto target labels
-    typedef std::list<irep_idt> labelst;
+    typedef small_vectort<irep_idt> labelst;
     labelst labels;
 
-    // will go away
-    std::set<targett> incoming_edges;
+    // will go away; ordered as by order_const_target
+    small_vectort<targett> incoming_edges;
+
+    /// The guard of instructions without one; all of them share it,
+    /// instead of holding a copy of true each
+    static const guardT &true_guard()
+    {
+      static const guardT guard=true_exprt();
+      return guard;
+    }
 
     /// Is this node a branch target?
     bool is_target() const
@@ -215,7 +226,7 @@ public:
     {
       type=_type;
       targets.clear();
-      guard=true_exprt();
+      guard=true_guard();
       code.make_nil();
     }
 
@@ -278,9 +289,9 @@ public:
     }
 
     explicit instructiont(goto_program_instruction_typet _type):
-      source_location(static_cast<const source_locationt &>(get_nil_irep())),
       type(_type),
-      guard(true_exprt()),
+      source_location(static_cast<const source_locationt &>(get_nil_irep())),
+      guard(true_guard()),
       location_number(0),
       loop_number(0),
       target_number(nil_target)
@@ -770,10 +781,22 @@ void goto_program_templatet<codeT, guardT>::compute_incoming_edges()
   {
     for(const auto &s : get_successors(it))
     {
-      if(s!=instructions.end())
-        s->incoming_edges.insert(it);
+      // a branch to the next instruction yields the same edge twice,
+      // which is always the most recent one
+      if(s!=instructions.end() &&
+         (s->incoming_edges.empty() || s->incoming_edges.back()!=it))
+        s->incoming_edges.push_back(it);
     }
   }
+
+  // order by address, as a set of targets would be
+  for(auto &i : instructions)
+  {
+    std::sort(
+      i.incoming_edges.begin(),
+      i.incoming_edges.end(),
+      [](const targett &a, const targett &b) { return &*a<&*b; });
+  }
 }
 
 template <class codeT, class guardT>
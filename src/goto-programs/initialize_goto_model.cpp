@@ -123,11 +123,15 @@ bool initialize_goto_model(
       }
     }
 
-    for(const auto &file : binaries)
+    if(!binaries.empty())
     {
       msg.status() << "Reading GOTO program from file" << messaget::eom;
 
-      if(read_object_and_link(file, goto_model, message_handler))
+      if(read_objects_and_link(
+          std::list<std::string>(binaries.begin(), binaries.end()),
+          goto_model.symbol_table,
+          goto_model.goto_functions,
+          message_handler))
         return true;
     }
 
@@ -16,6 +16,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <ansi-c/cprover_library.h>
 
 #include "compute_called_functions.h"
+#include "cprover_library_cache.h"
 #include "goto_convert_functions.h"
 
 void link_to_library(
@@ -43,6 +44,14 @@ void link_to_library(
 
   std::set<irep_idt> added_functions;
 
+  // the precompiled library, if any
+  const bool use_library_cache=
+    !config.ansi_c.library_cache.empty() &&
+    config.ansi_c.lib!=configt::ansi_ct::libt::LIB_NONE;
+
+  cprover_library_cachet library_cache(config.ansi_c.library_cache);
+  library_cache.set_message_handler(message_handler);
+
   while(true)
   {
     std::set<irep_idt> called_functions;
@@ -74,7 +83,10 @@ void link_to_library(
     if(missing_functions.empty())
       break;
 
-    add_cprover_library(missing_functions, symbol_table, message_handler);
+    if(use_library_cache)
+      library_cache.add(missing_functions, symbol_table);
+    else
+      add_cprover_library(missing_functions, symbol_table, message_handler);
 
     // convert to CFG
     for(const auto &id : missing_functions)
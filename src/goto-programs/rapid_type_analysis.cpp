@@ -0,0 +1,175 @@
+/*******************************************************************\
+
+Module: Rapid Type Analysis
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Rapid Type Analysis
+
+#include "rapid_type_analysis.h"
+
+#include <util/std_expr.h>
+
+rapid_type_analysist::rapid_type_analysist(
+  const symbol_tablet &_symbol_table,
+  const goto_functionst &goto_functions,
+  const class_hierarchyt &_class_hierarchy):
+  ns(_symbol_table),
+  class_hierarchy(_class_hierarchy)
+{
+  // objects that are not allocated on the heap
+  forall_symbols(s_it, _symbol_table.symbols)
+    if(!s_it->second.is_type && s_it->second.type.id()!=ID_code)
+      add_classes(s_it->second.type);
+
+  goto_functionst::function_mapt::const_iterator entry=
+    goto_functions.function_map.find(goto_functionst::entry_point());
+
+  if(entry!=goto_functions.function_map.end() &&
+     entry->second.body_available())
+    add_function(entry->first);
+  else
+  {
+    // no entry point, everything is reachable
+    forall_goto_functions(f_it, goto_functions)
+      add_function(f_it->first);
+  }
+
+  while(!worklist.empty())
+  {
+    while(!worklist.empty())
+    {
+      const irep_idt function=worklist.back();
+      worklist.pop_back();
+
+      goto_functionst::function_mapt::const_iterator f_it=
+        goto_functions.function_map.find(function);
+
+      if(f_it==goto_functions.function_map.end())
+        continue;
+
+      forall_goto_program_instructions(i_it, f_it->second.body)
+      {
+        add_expr(i_it->code);
+        add_expr(i_it->guard);
+      }
+    }
+
+    // the set of instantiated classes only grows, so it is sufficient
+    // to dispatch all virtual calls again
+    for(const auto &function : virtual_callees)
+      add_virtual_targets(function);
+  }
+}
+
+void rapid_type_analysist::add_function(const irep_idt &function)
+{
+  if(reachable_functions.insert(function).second)
+    worklist.push_back(function);
+}
+
+/// notes the classes of the objects that a variable or an allocation
+/// of the given type contains, which are not behind pointers
+void rapid_type_analysist::add_classes(const typet &type)
+{
+  if(type.id()==ID_symbol)
+  {
+    const irep_idt &identifier=to_symbol_type(type).get_identifier();
+
+    const symbolt *symbol;
+    if(ns.lookup(identifier, symbol) || !symbol->is_type)
+      return;
+
+    if(symbol->type.id()==ID_struct)
+    {
+      if(instantiated_classes.insert(identifier).second)
+        add_classes(symbol->type);
+    }
+    else
+      add_classes(symbol->type);
+  }
+  else if(type.id()==ID_struct || type.id()==ID_union)
+  {
+    for(const auto &component : to_struct_union_type(type).components())
+      add_classes(component.type());
+  }
+  else if(type.id()==ID_array || type.id()==ID_vector)
+    add_classes(type.subtype());
+}
+
+void rapid_type_analysist::add_expr(const exprt &expr)
+{
+  if(expr.id()==ID_symbol)
+  {
+    // direct calls, and functions whose address is taken
+    if(expr.type().id()==ID_code)
+      add_function(to_symbol_expr(expr).get_identifier());
+  }
+  else if(expr.id()==ID_virtual_function)
+    virtual_callees.push_back(expr);
+  else if(expr.id()==ID_side_effect)
+  {
+    const irep_idt &statement=to_side_effect_expr(expr).get_statement();
+
+    if((statement==ID_malloc ||
+        statement==ID_cpp_new ||
+        statement==ID_cpp_new_array ||
+        statement==ID_java_new ||
+        statement==ID_java_new_array) &&
+       expr.type().id()==ID_pointer)
+      add_classes(expr.type().subtype());
+  }
+
+  forall_operands(it, expr)
+    add_expr(*it);
+}
+
+irep_idt rapid_type_analysist::resolve(
+  const irep_idt &class_id,
+  const irep_idt &component_name) const
+{
+  irep_idt c=class_id;
+
+  while(!c.empty())
+  {
+    const irep_idt identifier=id2string(c)+"."+id2string(component_name);
+
+    const symbolt *symbol;
+    if(!ns.lookup(identifier, symbol))
+      return identifier;
+
+    class_hierarchyt::class_mapt::const_iterator c_it=
+      class_hierarchy.class_map.find(c);
+
+    if(c_it==class_hierarchy.class_map.end() ||
+       c_it->second.parents.empty())
+      break;
+
+    c=c_it->second.parents.front();
+  }
+
+  return irep_idt();
+}
+
+void rapid_type_analysist::add_virtual_targets(const exprt &function)
+{
+  const irep_idt &class_id=function.get(ID_C_class);
+  const irep_idt &component_name=function.get(ID_component_name);
+
+  class_hierarchyt::idst classes=
+    class_hierarchy.get_children_trans(class_id);
+  classes.push_back(class_id);
+
+  for(const auto &c : classes)
+  {
+    if(!is_instantiated(c))
+      continue;
+
+    const irep_idt target=resolve(c, component_name);
+    if(!target.empty())
+      add_function(target);
+  }
+}
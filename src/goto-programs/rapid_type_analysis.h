@@ -0,0 +1,67 @@
+/*******************************************************************\
+
+Module: Rapid Type Analysis
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Rapid Type Analysis
+
+#ifndef CPROVER_GOTO_PROGRAMS_RAPID_TYPE_ANALYSIS_H
+#define CPROVER_GOTO_PROGRAMS_RAPID_TYPE_ANALYSIS_H
+
+#include <set>
+
+#include "class_hierarchy.h"
+#include "goto_functions.h"
+
+/// Determines the classes that may be instantiated, together with the
+/// functions that are reachable from the entry point when virtual calls
+/// are only dispatched to instantiated classes (Bacon/Sweeney).
+/// Objects are created by allocations in reachable functions and by
+/// variables of class type, including those with static lifetime.
+class rapid_type_analysist
+{
+public:
+  rapid_type_analysist(
+    const symbol_tablet &_symbol_table,
+    const goto_functionst &goto_functions,
+    const class_hierarchyt &_class_hierarchy);
+
+  bool is_instantiated(const irep_idt &class_id) const
+  {
+    return instantiated_classes.find(class_id)!=
+           instantiated_classes.end();
+  }
+
+  bool is_reachable(const irep_idt &function) const
+  {
+    return reachable_functions.find(function)!=
+           reachable_functions.end();
+  }
+
+  /// the target of calling component_name on an object of class class_id,
+  /// or the empty string if there is none
+  irep_idt resolve(
+    const irep_idt &class_id,
+    const irep_idt &component_name) const;
+
+  std::set<irep_idt> instantiated_classes;
+  std::set<irep_idt> reachable_functions;
+
+protected:
+  const namespacet ns;
+  const class_hierarchyt &class_hierarchy;
+
+  std::vector<irep_idt> worklist;
+  std::vector<exprt> virtual_callees;
+
+  void add_function(const irep_idt &);
+  void add_classes(const typet &);
+  void add_expr(const exprt &);
+  void add_virtual_targets(const exprt &function);
+};
+
+#endif // CPROVER_GOTO_PROGRAMS_RAPID_TYPE_ANALYSIS_H
@@ -28,6 +28,7 @@ Author:
 #include <util/tempfile.h>
 #include <util/rename_symbol.h>
 #include <util/base_type.h>
+#include <util/time_stopping.h>
 
 #include <langapi/language_ui.h>
 
@@ -233,8 +234,7 @@ static bool link_functions(
   const symbol_tablet &src_symbol_table,
   goto_functionst &src_functions,
   const rename_symbolt &rename_symbol,
-  const std::unordered_set<irep_idt, irep_id_hash> &weak_symbols,
-  const replace_symbolt &object_type_updates)
+  const std::unordered_set<irep_idt, irep_id_hash> &weak_symbols)
 {
   namespacet ns(dest_symbol_table);
   namespacet src_ns(src_symbol_table);
@@ -299,6 +299,16 @@ static bool link_functions(
     }
   }
 
+  return false;
+}
+
+/// applies the macros and the changes to the types of objects, which may
+/// affect any function, to all functions
+static void update_functions(
+  const symbol_tablet &dest_symbol_table,
+  goto_functionst &dest_functions,
+  const replace_symbolt &object_type_updates)
+{
   // apply macros
   rename_symbolt macro_application;
 
@@ -335,8 +345,6 @@ static bool link_functions(
         object_type_updates(iit->guard);
       }
   }
-
-  return false;
 }
 
 /// reads an object file
@@ -379,10 +387,11 @@ bool read_object_and_link(
       temp_model.symbol_table,
       temp_model.goto_functions,
       linking.rename_symbol,
-      weak_symbols,
-      linking.object_type_updates))
+      weak_symbols))
     return true;
 
+  update_functions(symbol_table, functions, linking.object_type_updates);
+
   return false;
 }
 
@@ -400,3 +409,100 @@ bool read_object_and_link(
     goto_model.goto_functions,
     message_handler);
 }
+
+/// Reads and links a number of object files. Unlike linking them one by
+/// one, this does not scan all functions linked so far for each file: the
+/// macros and the changes to the types of objects are applied once, after
+/// the last file. Reports the time spent in each phase.
+/// \return true on error, false otherwise
+bool read_objects_and_link(
+  const std::list<std::string> &file_names,
+  symbol_tablet &symbol_table,
+  goto_functionst &functions,
+  message_handlert &message_handler)
+{
+  messaget message(message_handler);
+
+  typedef std::unordered_set<irep_idt, irep_id_hash> id_sett;
+  id_sett weak_symbols;
+  forall_symbols(it, symbol_table.symbols)
+    if(it->second.is_weak)
+      weak_symbols.insert(it->first);
+
+  replace_symbolt object_type_updates;
+
+  time_periodt read_time, symbol_time, function_time;
+
+  for(const auto &file_name : file_names)
+  {
+    message.statistics() << "Reading: " << file_name << messaget::eom;
+
+    absolute_timet read_start=current_time();
+
+    // we read into a temporary model
+    goto_modelt temp_model;
+
+    if(read_goto_binary(
+        file_name,
+        temp_model,
+        message_handler))
+      return true;
+
+    absolute_timet symbol_start=current_time();
+    read_time+=symbol_start-read_start;
+
+    linkingt linking(symbol_table,
+                     temp_model.symbol_table,
+                     message_handler);
+
+    if(linking.typecheck_main())
+      return true;
+
+    absolute_timet function_start=current_time();
+    symbol_time+=function_start-symbol_start;
+
+    if(link_functions(
+        symbol_table,
+        functions,
+        temp_model.symbol_table,
+        temp_model.goto_functions,
+        linking.rename_symbol,
+        weak_symbols))
+      return true;
+
+    // later updates of the same object supersede earlier ones
+    for(const auto &update : linking.object_type_updates.expr_map)
+      object_type_updates.expr_map[update.first]=update.second;
+
+    // the symbols of this file may have changed weakness
+    forall_symbols(it, temp_model.symbol_table.symbols)
+    {
+      const irep_idt &final_id=it->second.name;
+
+      symbol_tablet::symbolst::const_iterator d_it=
+        symbol_table.symbols.find(final_id);
+
+      if(d_it!=symbol_table.symbols.end() && d_it->second.is_weak)
+        weak_symbols.insert(final_id);
+      else
+        weak_symbols.erase(final_id);
+    }
+
+    function_time+=current_time()-function_start;
+  }
+
+  absolute_timet update_start=current_time();
+
+  update_functions(symbol_table, functions, object_type_updates);
+
+  time_periodt update_time=current_time()-update_start;
+
+  message.statistics() << "Linked " << file_names.size() << " objects: "
+                       << read_time << "s reading, "
+                       << symbol_time << "s merging symbols, "
+                       << function_time << "s merging functions, "
+                       << update_time << "s updating functions"
+                       << messaget::eom;
+
+  return false;
+}
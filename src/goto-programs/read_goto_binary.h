@@ -12,6 +12,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef CPROVER_GOTO_PROGRAMS_READ_GOTO_BINARY_H
 #define CPROVER_GOTO_PROGRAMS_READ_GOTO_BINARY_H
 
+#include <list>
 #include <string>
 
 class symbol_tablet;
@@ -43,4 +44,10 @@ bool read_object_and_link(
   goto_modelt &,
   message_handlert &);
 
+bool read_objects_and_link(
+  const std::list<std::string> &file_names,
+  symbol_tablet &,
+  goto_functionst &,
+  message_handlert &);
+
 #endif // CPROVER_GOTO_PROGRAMS_READ_GOTO_BINARY_H
@@ -13,25 +13,27 @@ Date:   December 2016
 
 #include "remove_exceptions.h"
 
-#ifdef DEBUG
-#include <iostream>
-#endif
-
 #include <stack>
 #include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <util/c_types.h>
+#include <util/message.h>
 #include <util/std_expr.h>
 #include <util/symbol_table.h>
 
-class remove_exceptionst
+class remove_exceptionst:public messaget
 {
   typedef std::vector<std::pair<
     irep_idt, goto_programt::targett>> catch_handlerst;
   typedef std::vector<catch_handlerst> stack_catcht;
 
 public:
-  explicit remove_exceptionst(symbol_tablet &_symbol_table):
+  remove_exceptionst(
+    symbol_tablet &_symbol_table,
+    message_handlert &_message_handler):
+    messaget(_message_handler),
     symbol_table(_symbol_table)
   {
   }
@@ -42,6 +44,11 @@ public:
 protected:
   symbol_tablet &symbol_table;
 
+  // the functions that may escape exceptions
+  std::unordered_set<irep_idt, irep_id_hash> may_throw;
+
+  void compute_may_throw(const goto_functionst &);
+
   void add_exceptional_returns(
     const goto_functionst::function_mapt::iterator &);
 
@@ -65,6 +72,57 @@ protected:
     const goto_functionst::function_mapt::iterator &);
 };
 
+/// determines the functions that may escape exceptions, which are those that
+/// contain a throw or call a function that may escape exceptions. Calls to
+/// all other functions need no exceptional return checks.
+void remove_exceptionst::compute_may_throw(
+  const goto_functionst &goto_functions)
+{
+  typedef std::unordered_map<irep_idt, std::vector<irep_idt>, irep_id_hash>
+    callerst;
+  callerst callers;
+  std::vector<irep_idt> worklist;
+
+  forall_goto_functions(f_it, goto_functions)
+  {
+    bool throws=false;
+
+    forall_goto_program_instructions(instr_it, f_it->second.body)
+    {
+      if(instr_it->is_throw())
+        throws=true;
+      else if(instr_it->is_function_call())
+      {
+        const exprt &function=
+          to_code_function_call(instr_it->code).function();
+
+        if(function.id()==ID_symbol)
+          callers[to_symbol_expr(function).get_identifier()].push_back(
+            f_it->first);
+        else
+          throws=true;
+      }
+    }
+
+    if(throws && may_throw.insert(f_it->first).second)
+      worklist.push_back(f_it->first);
+  }
+
+  while(!worklist.empty())
+  {
+    const irep_idt function=worklist.back();
+    worklist.pop_back();
+
+    callerst::const_iterator c_it=callers.find(function);
+    if(c_it==callers.end())
+      continue;
+
+    for(const auto &caller : c_it->second)
+      if(may_throw.insert(caller).second)
+        worklist.push_back(caller);
+  }
+}
+
 /// adds exceptional return variables for every function that may escape
 /// exceptions
 void remove_exceptionst::add_exceptional_returns(
@@ -83,17 +141,23 @@ void remove_exceptionst::add_exceptional_returns(
   if(goto_program.empty())
     return;
 
-  // We generate an exceptional return value for any function that has
-  // a throw or a function call. This can be improved by only considering
-  // function calls that may escape exceptions. However, this will
-  // require multiple passes.
-  bool add_exceptional_var=false;
-  forall_goto_program_instructions(instr_it, goto_program)
-    if(instr_it->is_throw() || instr_it->is_function_call())
-    {
-      add_exceptional_var=true;
-      break;
-    }
+  // We generate an exceptional return value for any function that may
+  // escape exceptions. The variable may exist already, e.g., for the
+  // entry point, which records it as an output; it is then initialised
+  // whenever the function has a throw or a function call.
+  bool add_exceptional_var=
+    may_throw.find(function_id)!=may_throw.end();
+
+  if(!add_exceptional_var &&
+     symbol_table.has_symbol(id2string(function_id)+EXC_SUFFIX))
+  {
+    forall_goto_program_instructions(instr_it, goto_program)
+      if(instr_it->is_throw() || instr_it->is_function_call())
+      {
+        add_exceptional_var=true;
+        break;
+      }
+  }
 
   if(add_exceptional_var)
   {
@@ -274,7 +338,10 @@ void remove_exceptionst::instrument_function_call(
   const irep_idt &callee_id=
     to_symbol_expr(function_call.function()).get_identifier();
 
-  if(symbol_table.has_symbol(id2string(callee_id)+EXC_SUFFIX))
+  // the entry point records the exceptional return of the method it
+  // calls even if that cannot escape exceptions
+  if(may_throw.find(callee_id)!=may_throw.end() &&
+     symbol_table.has_symbol(id2string(callee_id)+EXC_SUFFIX))
   {
     // we may have an escaping exception
     const symbolt &callee_exc_symbol=
@@ -381,15 +448,7 @@ void remove_exceptionst::instrument_exceptions(
         }
         // pop from the stack if possible
         if(!stack_catch.empty())
-        {
           stack_catch.pop_back();
-        }
-        else
-        {
-#ifdef DEBUG
-          std::cout << "Remove exceptions: empty stack\n";
-#endif
-        }
       }
       else // push
       {
@@ -435,6 +494,12 @@ void remove_exceptionst::instrument_exceptions(
 
 void remove_exceptionst::operator()(goto_functionst &goto_functions)
 {
+  compute_may_throw(goto_functions);
+
+  statistics() << "Remove exceptions: " << may_throw.size() << " of "
+               << goto_functions.function_map.size()
+               << " functions may escape exceptions" << eom;
+
   Forall_goto_functions(it, goto_functions)
     add_exceptional_returns(it);
   Forall_goto_functions(it, goto_functions)
@@ -444,15 +509,19 @@ void remove_exceptionst::operator()(goto_functionst &goto_functions)
 /// removes throws/CATCH-POP/CATCH-PUSH
 void remove_exceptions(
   symbol_tablet &symbol_table,
-  goto_functionst &goto_functions)
+  goto_functionst &goto_functions,
+  message_handlert &message_handler)
 {
-  remove_exceptionst remove_exceptions(symbol_table);
+  remove_exceptionst remove_exceptions(symbol_table, message_handler);
   remove_exceptions(goto_functions);
 }
 
 /// removes throws/CATCH-POP/CATCH-PUSH
-void remove_exceptions(goto_modelt &goto_model)
+void remove_exceptions(
+  goto_modelt &goto_model,
+  message_handlert &message_handler)
 {
-  remove_exceptionst remove_exceptions(goto_model.symbol_table);
+  remove_exceptionst remove_exceptions(
+    goto_model.symbol_table, message_handler);
   remove_exceptions(goto_model.goto_functions);
 }
@@ -14,6 +14,8 @@ Date:   December 2016
 #ifndef CPROVER_GOTO_PROGRAMS_REMOVE_EXCEPTIONS_H
 #define CPROVER_GOTO_PROGRAMS_REMOVE_EXCEPTIONS_H
 
+#include <util/message.h>
+
 #include <goto-programs/goto_model.h>
 
 #define EXC_SUFFIX "#exception_value"
@@ -21,7 +23,11 @@ Date:   December 2016
 // Removes 'throw x' and CATCH-PUSH/CATCH-POP
 // and adds the required instrumentation (GOTOs and assignments)
 
-void remove_exceptions(symbol_tablet &, goto_functionst &);
-void remove_exceptions(goto_modelt &);
+void remove_exceptions(
+  symbol_tablet &,
+  goto_functionst &,
+  message_handlert &);
+
+void remove_exceptions(goto_modelt &, message_handlert &);
 
 #endif
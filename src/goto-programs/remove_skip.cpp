@@ -92,7 +92,7 @@ void remove_skip(goto_programt &goto_program)
       goto_programt::targett old_target=it;
 
       // for collecting labels
-      std::list<irep_idt> labels;
+      goto_programt::instructiont::labelst labels;
 
       while(is_skip(it))
       {
@@ -102,14 +102,21 @@ void remove_skip(goto_programt &goto_program)
           break;
 
         // save labels
-        labels.splice(labels.end(), it->labels);
+        for(const auto &l : it->labels)
+          labels.push_back(l);
+        it->labels.clear();
         it++;
       }
 
       goto_programt::targett new_target=it;
 
-      // save labels
-      it->labels.splice(it->labels.begin(), labels);
+      // save labels, which go before those of the new target
+      if(!labels.empty())
+      {
+        for(const auto &l : it->labels)
+          labels.push_back(l);
+        it->labels.swap(labels);
+      }
 
       if(new_target!=old_target)
       {
@@ -12,12 +12,15 @@ Author: Daniel Kroening, kroening@kroening.com
 #include "remove_virtual_functions.h"
 #include "class_hierarchy.h"
 #include "class_identifier.h"
+#include "rapid_type_analysis.h"
+
+#include <memory>
 
 #include <util/c_types.h>
 #include <util/prefix.h>
 #include <util/type_eq.h>
 
-class remove_virtual_functionst
+class remove_virtual_functionst:public messaget
 {
 public:
   remove_virtual_functionst(
@@ -28,11 +31,24 @@ public:
 
   bool remove_virtual_functions(goto_programt &goto_program);
 
+  // only dispatch to classes that may be instantiated
+  void enable_rapid_type_analysis(const goto_functionst &goto_functions)
+  {
+    rta=std::unique_ptr<rapid_type_analysist>(
+      new rapid_type_analysist(symbol_table, goto_functions, class_hierarchy));
+  }
+
 protected:
   const namespacet ns;
   const symbol_tablet &symbol_table;
 
   class_hierarchyt class_hierarchy;
+  std::unique_ptr<rapid_type_analysist> rta;
+
+  // statistics
+  std::size_t number_of_calls;
+  std::size_t number_of_targets;
+  std::size_t number_of_targets_pruned;
 
   void remove_virtual_function(
     goto_programt &goto_program,
@@ -52,6 +68,7 @@ protected:
 
   typedef std::vector<functiont> functionst;
   void get_functions(const exprt &, functionst &);
+  void prune_functions(functionst &) const;
   void get_child_functions_rec(
     const irep_idt &,
     const symbol_exprt &,
@@ -67,7 +84,10 @@ remove_virtual_functionst::remove_virtual_functionst(
   const symbol_tablet &_symbol_table,
   const goto_functionst &goto_functions):
   ns(_symbol_table),
-  symbol_table(_symbol_table)
+  symbol_table(_symbol_table),
+  number_of_calls(0),
+  number_of_targets(0),
+  number_of_targets_pruned(0)
 {
   class_hierarchy(symbol_table);
 }
@@ -88,6 +108,15 @@ void remove_virtual_functionst::remove_virtual_function(
   functionst functions;
   get_functions(function, functions);
 
+  number_of_calls++;
+  number_of_targets+=functions.size();
+
+  if(rta)
+  {
+    prune_functions(functions);
+    number_of_targets_pruned+=functions.size();
+  }
+
   if(functions.empty())
   {
     target->make_skip();
@@ -302,6 +331,35 @@ void remove_virtual_functionst::get_functions(
     functions.push_back(root_function);
 }
 
+/// Removes the cases for classes that are never instantiated. The last
+/// case is kept, as it is the fall-through case of the dispatch. If all
+/// remaining cases call the same function, only the last one is kept.
+void remove_virtual_functionst::prune_functions(functionst &functions) const
+{
+  if(functions.empty())
+    return;
+
+  const functiont last=functions.back();
+  functions.pop_back();
+
+  functionst result;
+  bool same_function=true;
+
+  for(const auto &function : functions)
+    if(rta->is_instantiated(function.class_id))
+    {
+      result.push_back(function);
+      if(function.symbol_expr!=last.symbol_expr)
+        same_function=false;
+    }
+
+  if(same_function)
+    result.clear();
+
+  result.push_back(last);
+  functions.swap(result);
+}
+
 exprt remove_virtual_functionst::get_method(
   const irep_idt &class_id,
   const irep_idt &component_name) const
@@ -359,6 +417,13 @@ void remove_virtual_functionst::operator()(goto_functionst &functions)
 
   if(did_something)
     functions.compute_location_numbers();
+
+  if(rta)
+    statistics() << "Virtual function calls: " << number_of_calls
+                 << ", dispatch targets: " << number_of_targets_pruned
+                 << " (" << number_of_targets
+                 << " without rapid type analysis), instantiated classes: "
+                 << rta->instantiated_classes.size() << eom;
 }
 
 void remove_virtual_functions(
@@ -371,6 +436,23 @@ void remove_virtual_functions(
   rvf(goto_functions);
 }
 
+void remove_virtual_functions(
+  message_handlert &message_handler,
+  const symbol_tablet &symbol_table,
+  goto_functionst &goto_functions,
+  bool rapid_type_analysis)
+{
+  remove_virtual_functionst
+    rvf(symbol_table, goto_functions);
+
+  rvf.set_message_handler(message_handler);
+
+  if(rapid_type_analysis)
+    rvf.enable_rapid_type_analysis(goto_functions);
+
+  rvf(goto_functions);
+}
+
 void remove_virtual_functions(goto_modelt &goto_model)
 {
   remove_virtual_functions(
@@ -14,6 +14,8 @@ Date: April 2016
 #ifndef CPROVER_GOTO_PROGRAMS_REMOVE_VIRTUAL_FUNCTIONS_H
 #define CPROVER_GOTO_PROGRAMS_REMOVE_VIRTUAL_FUNCTIONS_H
 
+#include <util/message.h>
+
 #include "goto_model.h"
 
 // remove virtual function calls
@@ -25,4 +27,12 @@ void remove_virtual_functions(
   const symbol_tablet &symbol_table,
   goto_functionst &goto_functions);
 
+// with rapid_type_analysis set, calls are only dispatched
+// to classes that may be instantiated
+void remove_virtual_functions(
+  message_handlert &,
+  const symbol_tablet &symbol_table,
+  goto_functionst &goto_functions,
+  bool rapid_type_analysis);
+
 #endif // CPROVER_GOTO_PROGRAMS_REMOVE_VIRTUAL_FUNCTIONS_H
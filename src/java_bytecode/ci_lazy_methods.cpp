@@ -19,6 +19,8 @@ Author: Chris Smowton, chris.smowton@diffblue.com
 ///   table.
 void ci_lazy_methodst::add_needed_method(const irep_idt &method_symbol_name)
 {
+  if(summary)
+    summary->needed_methods.push_back(method_symbol_name);
   needed_methods.push_back(method_symbol_name);
 }
 
@@ -30,6 +32,8 @@ void ci_lazy_methodst::add_needed_method(const irep_idt &method_symbol_name)
 /// \return Returns true if `class_symbol_name` is new (not seen before).
 bool ci_lazy_methodst::add_needed_class(const irep_idt &class_symbol_name)
 {
+  if(summary)
+    summary->needed_classes.push_back(class_symbol_name);
   if(!needed_classes.insert(class_symbol_name).second)
     return false;
   const irep_idt clinit_name(id2string(class_symbol_name)+".<clinit>:()V");
@@ -12,20 +12,36 @@ Author: Chris Smowton, chris.smowton@diffblue.com
 #ifndef CPROVER_JAVA_BYTECODE_CI_LAZY_METHODS_H
 #define CPROVER_JAVA_BYTECODE_CI_LAZY_METHODS_H
 
+#include <map>
 #include <vector>
 #include <set>
 #include <util/symbol_table.h>
 
+/// What elaborating a method adds to the needed methods and classes,
+/// which allows finding the reachable methods without converting them.
+struct ci_lazy_method_summaryt
+{
+  std::vector<irep_idt> needed_methods;
+  std::vector<irep_idt> needed_classes;
+  // the `function` operands of the virtual calls in the method
+  std::vector<exprt> virtual_callees;
+};
+
+typedef std::map<irep_idt, ci_lazy_method_summaryt>
+  ci_lazy_method_summariest;
+
 class ci_lazy_methodst
 {
 public:
   ci_lazy_methodst(
     std::vector<irep_idt> &_needed_methods,
     std::set<irep_idt> &_needed_classes,
-    symbol_tablet &_symbol_table):
+    symbol_tablet &_symbol_table,
+    ci_lazy_method_summaryt *_summary=nullptr):
   needed_methods(_needed_methods),
   needed_classes(_needed_classes),
-  symbol_table(_symbol_table)
+  symbol_table(_symbol_table),
+  summary(_summary)
   {}
 
   void add_needed_method(const irep_idt &);
@@ -44,6 +60,8 @@ private:
   // repeatedly exploring a class hierarchy.
   std::set<irep_idt> &needed_classes;
   symbol_tablet &symbol_table;
+  // if given, records what is added
+  ci_lazy_method_summaryt *summary;
 };
 
 #endif
@@ -10,20 +10,86 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <cstring>
 #include <cassert>
+#include <fstream>
+#include <sstream>
 #include <unordered_set>
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include <json/json_parser.h>
 #include <util/suffix.h>
 
+/// Makes the contents of the given file available in `mapped_data`,
+/// using mmap where available, and reading the file otherwise.
+/// \return true on error
+bool jar_filet::map_file(const std::string &filename)
+{
+#ifndef _WIN32
+  int fd=::open(filename.c_str(), O_RDONLY);
+  if(fd!=-1)
+  {
+    struct stat file_stat;
+    void *data=MAP_FAILED;
+
+    if(fstat(fd, &file_stat)==0 && file_stat.st_size>0)
+      data=mmap(
+        nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    ::close(fd);
+
+    if(data!=MAP_FAILED)
+    {
+      mapped_data=static_cast<const char *>(data);
+      mapped_size=file_stat.st_size;
+      return false;
+    }
+  }
+#endif
+
+  std::ifstream in(filename, std::ios::binary);
+  if(!in)
+    return true;
+
+  std::ostringstream contents;
+  contents << in.rdbuf();
+  file_contents=contents.str();
+
+  mapped_data=file_contents.data();
+  mapped_size=file_contents.size();
+
+  return false;
+}
+
+void jar_filet::unmap_file()
+{
+#ifndef _WIN32
+  if(mapped_data!=nullptr && mapped_data!=file_contents.data())
+    munmap(const_cast<char *>(mapped_data), mapped_size);
+#endif
+
+  file_contents.clear();
+  mapped_data=nullptr;
+  mapped_size=0;
+}
+
 void jar_filet::open(
   java_class_loader_limitt &class_loader_limit,
   const std::string &filename)
 {
-  if(!mz_ok)
+  if(!mz_ok && !map_file(filename))
   {
     memset(&zip, 0, sizeof(zip));
-    mz_bool mz_open=mz_zip_reader_init_file(&zip, filename.c_str(), 0);
+    mz_bool mz_open=
+      mz_zip_reader_init_mem(&zip, mapped_data, mapped_size, 0);
     mz_ok=mz_open==MZ_TRUE;
+
+    if(!mz_ok)
+      unmap_file();
   }
 
   if(mz_ok)
@@ -31,14 +97,19 @@ void jar_filet::open(
     std::size_t number_of_files=
       mz_zip_reader_get_num_files(&zip);
 
+    filtered_jar.reserve(number_of_files);
+
+    // reused for all entries
+    std::vector<char> filename_char;
+
     for(std::size_t i=0; i<number_of_files; i++)
     {
       mz_uint filename_length=mz_zip_reader_get_filename(&zip, i, nullptr, 0);
-      char *filename_char=new char[filename_length+1];
-      mz_uint filename_len=
-        mz_zip_reader_get_filename(&zip, i, filename_char, filename_length);
+      filename_char.resize(filename_length+1);
+      mz_uint filename_len=mz_zip_reader_get_filename(
+        &zip, i, filename_char.data(), filename_length);
       assert(filename_length==filename_len);
-      std::string file_name(filename_char);
+      std::string file_name(filename_char.data());
 
       // non-class files are loaded in any case
       bool add_file=!has_suffix(file_name, ".class");
@@ -51,7 +122,6 @@ void jar_filet::open(
                    << " from " << filename << eom;
         filtered_jar[file_name]=i;
       }
-      delete[] filename_char;
     }
   }
 }
@@ -63,14 +133,18 @@ jar_filet::~jar_filet()
     mz_zip_reader_end(&zip);
     mz_ok=false;
   }
+
+  unmap_file();
 }
 
-std::string jar_filet::get_entry(const irep_idt &name)
+bool jar_filet::get_entry(
+  const irep_idt &name,
+  std::string &buffer,
+  const char *&data,
+  std::size_t &size)
 {
   if(!mz_ok)
-    return std::string("");
-
-  std::string dest;
+    return true;
 
   auto entry=filtered_jar.find(name);
   assert(entry!=filtered_jar.end());
@@ -80,18 +154,64 @@ std::string jar_filet::get_entry(const irep_idt &name)
   memset(&file_stat, 0, sizeof(file_stat));
   mz_bool stat_ok=mz_zip_reader_file_stat(&zip, real_index, &file_stat);
   if(stat_ok!=MZ_TRUE)
-    return std::string();
-  std::vector<char> buffer;
-  size_t bufsize=file_stat.m_uncomp_size;
-  buffer.resize(bufsize);
+    return true;
+
+  size=file_stat.m_uncomp_size;
+
+  // Stored entries are used in place. The data follows the local
+  // header, which has a fixed part of 30 bytes, and then the file
+  // name and the extra field, whose lengths are at offset 26 and 28.
+  const std::size_t local_header_size=30;
+  const std::size_t ofs=file_stat.m_local_header_ofs;
+
+  if(file_stat.m_method==0 &&
+     !file_stat.m_is_encrypted &&
+     file_stat.m_comp_size==file_stat.m_uncomp_size &&
+     ofs+local_header_size<=mapped_size)
+  {
+    const unsigned char *header=
+      reinterpret_cast<const unsigned char *>(mapped_data+ofs);
+
+    const std::size_t data_ofs=
+      ofs+local_header_size+
+      (header[26] | (header[27]<<8))+
+      (header[28] | (header[29]<<8));
+
+    if(header[0]=='P' && header[1]=='K' &&
+       header[2]==3 && header[3]==4 &&
+       data_ofs+size<=mapped_size)
+    {
+      data=mapped_data+data_ofs;
+      return false;
+    }
+  }
+
+  // decompress into the buffer
+  buffer.resize(size);
+  data=buffer.data();
+
+  if(size==0)
+    return false;
+
   mz_bool read_ok=
-    mz_zip_reader_extract_to_mem(&zip, real_index, buffer.data(), bufsize, 0);
-  if(read_ok!=MZ_TRUE)
+    mz_zip_reader_extract_to_mem(&zip, real_index, &buffer[0], size, 0);
+
+  return read_ok!=MZ_TRUE;
+}
+
+std::string jar_filet::get_entry(const irep_idt &name)
+{
+  std::string buffer;
+  const char *data;
+  std::size_t size;
+
+  if(get_entry(name, buffer, data, size))
     return std::string();
 
-  dest.insert(dest.end(), buffer.begin(), buffer.end());
+  if(data==buffer.data())
+    return buffer;
 
-  return dest;
+  return std::string(data, size);
 }
 
 jar_filet::manifestt jar_filet::get_manifest()
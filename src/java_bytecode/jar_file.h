@@ -19,7 +19,11 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <vector>
 #include <map>
 #include <regex>
+#include <unordered_map>
+#include <streambuf>
+
 #include <util/message.h>
+#include <util/irep.h>
 
 #include "java_class_loader_limit.h"
 
@@ -27,11 +31,17 @@ class jar_filet:public messaget
 {
 public:
   jar_filet():
-    mz_ok(false)
+    mz_ok(false),
+    mapped_data(nullptr),
+    mapped_size(0)
     // `zip` will be initialized by open()
   {
   }
 
+  // the mapped file and the zip reader state must not be shared
+  jar_filet(const jar_filet &)=delete;
+  jar_filet &operator=(const jar_filet &)=delete;
+
   ~jar_filet();
 
   void open(java_class_loader_limitt &, const std::string &);
@@ -40,17 +50,48 @@ public:
   explicit operator bool() const { return mz_ok; }
 
   // map internal index to real index in jar central directory
-  typedef std::map<irep_idt, size_t> filtered_jart;
+  typedef std::unordered_map<irep_idt, size_t, irep_id_hash> filtered_jart;
   filtered_jart filtered_jar;
 
   std::string get_entry(const irep_idt &);
 
+  /// Provides the uncompressed contents of an entry. Entries that are
+  /// stored without compression are not copied, i.e., `data` then points
+  /// into the mapped JAR file; others are inflated into `buffer`, which
+  /// can be reused for further entries.
+  /// \return true on error
+  bool get_entry(
+    const irep_idt &,
+    std::string &buffer,
+    const char *&data,
+    std::size_t &size);
+
   typedef std::map<std::string, std::string> manifestt;
   manifestt get_manifest();
 
 protected:
   mz_zip_archive zip;
   bool mz_ok;
+
+  // the contents of the JAR file, mapped into memory where possible
+  const char *mapped_data;
+  std::size_t mapped_size;
+  std::string file_contents;
+
+  bool map_file(const std::string &);
+  void unmap_file();
+};
+
+/// An input stream buffer over a block of memory, which allows parsing
+/// entries of a JAR file without copying them.
+class jar_entry_streambuft:public std::streambuf
+{
+public:
+  jar_entry_streambuft(const char *data, std::size_t size)
+  {
+    char *begin=const_cast<char *>(data);
+    setg(begin, begin, begin+size);
+  }
 };
 
 class jar_poolt:public messaget
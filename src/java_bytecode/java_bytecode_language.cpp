@@ -8,6 +8,7 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "java_bytecode_language.h"
 
+#include <sstream>
 #include <string>
 
 #include <util/symbol_table.h>
@@ -15,6 +16,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/config.h>
 #include <util/cmdline.h>
 #include <util/string2int.h>
+#include <util/time_stopping.h>
 #include <json/json_parser.h>
 
 #include <goto-programs/class_hierarchy.h>
@@ -26,6 +28,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include "java_entry_point.h"
 #include "java_bytecode_parser.h"
 #include "java_class_loader.h"
+#include "java_class_cache.h"
 
 #include "expr2java.h"
 
@@ -39,8 +42,13 @@ void java_bytecode_languaget::get_language_options(const cmdlinet &cmd)
   if(cmd.isset("java-max-input-array-length"))
     max_nondet_array_length=
       std::stoi(cmd.get_value("java-max-input-array-length"));
+  if(cmd.isset("java-max-input-tree-depth"))
+    max_nondet_tree_depth=
+      std::stoi(cmd.get_value("java-max-input-tree-depth"));
   if(cmd.isset("java-max-vla-length"))
     max_user_array_length=std::stoi(cmd.get_value("java-max-vla-length"));
+  if(cmd.isset("jobs"))
+    java_class_loader.jobs=unsafe_string2unsigned(cmd.get_value("jobs"));
   if(cmd.isset("lazy-methods-context-sensitive"))
     lazy_methods_mode=LAZY_METHODS_MODE_CONTEXT_SENSITIVE;
   else if(cmd.isset("lazy-methods"))
@@ -77,6 +85,42 @@ void java_bytecode_languaget::get_language_options(const cmdlinet &cmd)
   }
   else
     java_cp_include_files=".*";
+
+  // the context-sensitive mode converts methods on demand, which
+  // needs the parse trees
+  if(cmd.isset("java-class-cache") &&
+     lazy_methods_mode!=LAZY_METHODS_MODE_CONTEXT_SENSITIVE)
+    class_cache_dir=cmd.get_value("java-class-cache");
+}
+
+/// \par parameters: `path`: the input file
+/// `entry_point`: whether to include the entry function, which only affects
+///   which of the converted methods are kept
+/// \return a string that contains everything that affects the result of
+///   converting the classes loaded for the given input file
+std::string java_bytecode_languaget::class_cache_key(
+  const std::string &path,
+  bool entry_point) const
+{
+  std::ostringstream key;
+
+  key << path << '\n'
+      << config.java.main_class << '\n';
+
+  if(entry_point)
+    key << config.main << '\n';
+  else
+    key << "call graph\n";
+
+  key << java_cp_include_files << '\n'
+      << lazy_methods_mode << '\n'
+      << string_refinement_enabled << '\n'
+      << max_user_array_length << '\n';
+
+  for(const auto &cp : config.java.classpath)
+    key << cp << '\n';
+
+  return key.str();
 }
 
 std::set<std::string> java_bytecode_languaget::extensions() const
@@ -106,6 +150,20 @@ bool java_bytecode_languaget::parse(
   java_class_loader.set_message_handler(get_message_handler());
   java_class_loader.set_java_cp_include_files(java_cp_include_files);
 
+  class_cache_path=path;
+
+  if(use_class_cache())
+  {
+    java_class_cachet class_cache(
+      class_cache_dir, class_cache_key(path, true));
+    class_cache.set_message_handler(get_message_handler());
+    class_cache_hit=
+      !class_cache.read(class_cache_symbol_table, main_jar_classes);
+
+    if(class_cache_hit)
+      status() << "Using cached classes from " << class_cache_dir << eom;
+  }
+
   // look at extension
   if(has_suffix(path, ".class"))
   {
@@ -133,6 +191,10 @@ bool java_bytecode_languaget::parse(
     // Do we have one now?
     if(main_class.empty())
     {
+      // the list of classes is part of the cache entry
+      if(class_cache_hit)
+        return false;
+
       status() << "JAR file without entry point: loading class files" << eom;
       java_class_loader.load_entire_jar(class_loader_limit, path);
       for(const auto &kv : java_class_loader.jar_map.at(path).entries)
@@ -147,7 +209,8 @@ bool java_bytecode_languaget::parse(
   if(!main_class.empty())
   {
     status() << "Java main class: " << main_class << eom;
-    java_class_loader(main_class);
+    if(!class_cache_hit)
+      java_class_loader(main_class);
   }
 
   return false;
@@ -183,8 +246,8 @@ static irep_idt get_virtual_method_target(
 
 /// Find possible callees, excluding types that are not known to be
 /// instantiated.
-/// \par parameters: `c`: function call whose potential target functions should
-///   be determined.
+/// \par parameters: `called_function`: the virtual function of a call whose
+///   potential target functions should be determined.
 /// `needed_classes`: set of classes that can be instantiated. Any potential
 ///   callee not in this set will be ignored.
 /// `symbol_table`: global symtab
@@ -193,13 +256,12 @@ static irep_idt get_virtual_method_target(
 ///   `needed_classes` into account (virtual function overrides defined on
 ///   classes that are not 'needed' are ignored)
 static void get_virtual_method_targets(
-  const code_function_callt &c,
+  const exprt &called_function,
   const std::set<irep_idt> &needed_classes,
   std::vector<irep_idt> &needed_methods,
   symbol_tablet &symbol_table,
   const class_hierarchyt &class_hierarchy)
 {
-  const auto &called_function=c.function();
   assert(called_function.id()==ID_virtual_function);
 
   const auto &call_class=called_function.get(ID_C_class);
@@ -259,7 +321,7 @@ static void get_virtual_method_targets(
     symbolt symbol;
     symbol.name=stubname;
     symbol.base_name=call_basename;
-    symbol.type=c.function().type();
+    symbol.type=called_function.type();
     symbol.value.make_nil();
     symbol.mode=ID_java;
     symbol_table.add(symbol);
@@ -268,18 +330,18 @@ static void get_virtual_method_targets(
 
 /// See output
 /// \par parameters: `e`: expression tree to search
-/// \return Populates `result` with pointers to each function call within e that
-///   calls a virtual function.
+/// \return Populates `result` with the function of each function call within e
+///   that calls a virtual function.
 static void gather_virtual_callsites(
   const exprt &e,
-  std::vector<const code_function_callt *> &result)
+  std::vector<exprt> &result)
 {
   if(e.id()!=ID_code)
     return;
   const codet &c=to_code(e);
   if(c.get_statement()==ID_function_call &&
      to_code_function_call(c).function().id()==ID_virtual_function)
-    result.push_back(&to_code_function_call(c));
+    result.push_back(to_code_function_call(c).function());
   else
     forall_operands(it, e)
       gather_virtual_callsites(*it, result);
@@ -389,6 +451,14 @@ bool java_bytecode_languaget::typecheck(
   symbol_tablet &symbol_table,
   const std::string &module)
 {
+  if(class_cache_hit)
+  {
+    forall_symbols(s_it, class_cache_symbol_table.symbols)
+      symbol_table.add(s_it->second);
+    class_cache_symbol_table.clear();
+    return false;
+  }
+
   if(string_refinement_enabled)
     character_preprocess.initialize_conversion_table();
 
@@ -429,6 +499,38 @@ bool java_bytecode_languaget::typecheck(
        symbol_table, get_message_handler(), string_refinement_enabled))
     return true;
 
+  if(!class_cache_dir.empty())
+  {
+    // the input file and the JAR files are dependencies
+    std::set<std::string> files_read=java_class_loader.class_files_read;
+    files_read.insert(class_cache_path);
+    for(const auto &jar : java_class_loader.jar_map)
+      files_read.insert(id2string(jar.first));
+
+    if(use_class_cache())
+    {
+      java_class_cachet class_cache(
+        class_cache_dir, class_cache_key(class_cache_path, true));
+      class_cache.set_message_handler(get_message_handler());
+      class_cache.write(
+        files_read,
+        java_class_loader.class_files_missing,
+        symbol_table,
+        main_jar_classes);
+    }
+
+    if(method_summaries_changed)
+    {
+      java_class_cachet call_graph_cache(
+        class_cache_dir, class_cache_key(class_cache_path, false));
+      call_graph_cache.set_message_handler(get_message_handler());
+      call_graph_cache.write(
+        files_read,
+        java_class_loader.class_files_missing,
+        method_summaries);
+    }
+  }
+
   return false;
 }
 
@@ -452,6 +554,17 @@ bool java_bytecode_languaget::do_ci_lazy_method_conversion(
   class_hierarchyt ch;
   ch(symbol_table);
 
+  // summaries of the methods elaborated by earlier runs
+  if(!class_cache_dir.empty())
+  {
+    java_class_cachet call_graph_cache(
+      class_cache_dir, class_cache_key(class_cache_path, false));
+    call_graph_cache.set_message_handler(get_message_handler());
+    if(!call_graph_cache.read(method_summaries))
+      status() << "Using " << method_summaries.size()
+               << " cached method summaries" << eom;
+  }
+
   std::vector<irep_idt> method_worklist1;
   std::vector<irep_idt> method_worklist2;
 
@@ -501,7 +614,14 @@ bool java_bytecode_languaget::do_ci_lazy_method_conversion(
   }
 
   std::set<irep_idt> methods_already_populated;
-  std::vector<const code_function_callt *> virtual_callsites;
+  std::vector<exprt> virtual_callsites;
+
+  // Methods that have a summary from an earlier run are not converted
+  // until the reachable methods are known, and the summary is used
+  // in place of the converted body.
+  std::vector<irep_idt> methods_to_convert;
+  std::size_t methods_converted=0;
+  absolute_timet convert_start=current_time();
 
   bool any_new_methods;
   do
@@ -520,13 +640,39 @@ bool java_bytecode_languaget::do_ci_lazy_method_conversion(
           debug() << "Skip " << mname << eom;
           continue;
         }
+
+        any_new_methods=true;
+
+        auto s_it=method_summaries.find(mname);
+        if(s_it!=method_summaries.end())
+        {
+          const ci_lazy_method_summaryt &summary=s_it->second;
+          ci_lazy_methodst lazy_methods(
+            method_worklist2,
+            needed_classes,
+            symbol_table);
+          for(const auto &m : summary.needed_methods)
+            lazy_methods.add_needed_method(m);
+          for(const auto &c : summary.needed_classes)
+            lazy_methods.add_needed_class(c);
+          virtual_callsites.insert(
+            virtual_callsites.end(),
+            summary.virtual_callees.begin(),
+            summary.virtual_callees.end());
+          methods_to_convert.push_back(mname);
+          continue;
+        }
+
         debug() << "CI lazy methods: elaborate " << mname << eom;
         const auto &parsed_method=findit->second;
+        ci_lazy_method_summaryt &summary=method_summaries[mname];
+        method_summaries_changed=true;
         // Note this wraps *references* to method_worklist2, needed_classes:
         ci_lazy_methodst lazy_methods(
           method_worklist2,
           needed_classes,
-          symbol_table);
+          symbol_table,
+          &summary);
         java_bytecode_convert_method(
           *parsed_method.first,
           *parsed_method.second,
@@ -535,10 +681,14 @@ bool java_bytecode_languaget::do_ci_lazy_method_conversion(
           max_user_array_length,
           safe_pointer<ci_lazy_methodst>::create_non_null(&lazy_methods),
           character_preprocess);
+        methods_converted++;
         gather_virtual_callsites(
           symbol_table.lookup(mname).value,
-          virtual_callsites);
-        any_new_methods=true;
+          summary.virtual_callees);
+        virtual_callsites.insert(
+          virtual_callsites.end(),
+          summary.virtual_callees.begin(),
+          summary.virtual_callees.end());
       }
       method_worklist1.clear();
     }
@@ -555,7 +705,7 @@ bool java_bytecode_languaget::do_ci_lazy_method_conversion(
     {
       // This will also create a stub if a virtual callsite has no targets.
       get_virtual_method_targets(
-        *callsite,
+        callsite,
         needed_classes,
         method_worklist2,
         symbol_table,
@@ -564,6 +714,28 @@ bool java_bytecode_languaget::do_ci_lazy_method_conversion(
   }
   while(any_new_methods);
 
+  for(const auto &mname : methods_to_convert)
+  {
+    debug() << "CI lazy methods: elaborate " << mname
+            << " (reachable by summary)" << eom;
+    const auto &parsed_method=lazy_methods.at(mname);
+    java_bytecode_convert_method(
+      *parsed_method.first,
+      *parsed_method.second,
+      symbol_table,
+      get_message_handler(),
+      max_user_array_length,
+      safe_pointer<ci_lazy_methodst>::create_null(),
+      character_preprocess);
+  }
+
+  absolute_timet convert_stop=current_time();
+  statistics() << "CI lazy methods: converted "
+               << methods_converted+methods_to_convert.size()
+               << " methods (" << methods_to_convert.size()
+               << " found reachable by summary) in "
+               << (convert_stop-convert_start) << "s" << eom;
+
   // Remove symbols for methods that were declared but never used:
   symbol_tablet keep_symbols;
 
@@ -647,7 +819,8 @@ bool java_bytecode_languaget::final(symbol_tablet &symbol_table)
       main_class,
       get_message_handler(),
       assume_inputs_non_null,
-      max_nondet_array_length));
+      max_nondet_array_length,
+      max_nondet_tree_depth));
 }
 
 void java_bytecode_languaget::show_parse(std::ostream &out)
@@ -12,9 +12,11 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <util/language.h>
 #include <util/cmdline.h>
+#include <util/symbol_table.h>
 
 #include "java_class_loader.h"
 #include "character_refine_preprocess.h"
+#include "ci_lazy_methods.h"
 
 #define MAX_NONDET_ARRAY_LENGTH_DEFAULT 5
 
@@ -61,9 +63,12 @@ public:
   java_bytecode_languaget():
     assume_inputs_non_null(false),
     max_nondet_array_length(MAX_NONDET_ARRAY_LENGTH_DEFAULT),
+    max_nondet_tree_depth(0),
     max_user_array_length(0),
     lazy_methods_mode(lazy_methods_modet::LAZY_METHODS_MODE_EAGER),
-    string_refinement_enabled(false)
+    string_refinement_enabled(false),
+    class_cache_hit(false),
+    method_summaries_changed(false)
     {}
 
   bool from_expr(
@@ -96,18 +101,39 @@ public:
 
 protected:
   bool do_ci_lazy_method_conversion(symbol_tablet &, lazy_methodst &);
+  std::string class_cache_key(
+    const std::string &path,
+    bool entry_point) const;
 
   irep_idt main_class;
   std::vector<irep_idt> main_jar_classes;
   java_class_loadert java_class_loader;
   bool assume_inputs_non_null;      // assume inputs variables to be non-null
   size_t max_nondet_array_length;   // maximal length for non-det array creation
+  size_t max_nondet_tree_depth;     // maximal depth of non-det object trees
   size_t max_user_array_length;     // max size for user code created arrays
   lazy_methodst lazy_methods;
   lazy_methods_modet lazy_methods_mode;
   bool string_refinement_enabled;
   character_refine_preprocesst character_preprocess;
   std::string java_cp_include_files;
+
+  // on-disk cache of the converted classes
+  std::string class_cache_dir;
+  std::string class_cache_path;
+  bool class_cache_hit;
+  symbol_tablet class_cache_symbol_table;
+  ci_lazy_method_summariest method_summaries;
+  bool method_summaries_changed;
+
+  // The lazy modes keep the parse trees for converting methods later
+  // (convert_lazy_method), which a cached symbol table cannot provide.
+  // Only their method summaries are cached.
+  bool use_class_cache() const
+  {
+    return !class_cache_dir.empty() &&
+           lazy_methods_mode==LAZY_METHODS_MODE_EAGER;
+  }
 };
 
 languaget *new_java_bytecode_language();
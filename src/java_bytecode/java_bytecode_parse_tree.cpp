@@ -8,10 +8,12 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "java_bytecode_parse_tree.h"
 
+#include <istream>
 #include <ostream>
 
 #include <util/symbol_table.h>
 #include <util/namespace.h>
+#include <util/irep_serialization.h>
 
 #include <langapi/language_util.h>
 
@@ -213,3 +215,293 @@ void java_bytecode_parse_treet::fieldt::output(std::ostream &out) const
 
   out << '\n';
 }
+
+static void write_annotations(
+  std::ostream &out,
+  irep_serializationt &irepconverter,
+  const java_bytecode_parse_treet::annotationst &annotations)
+{
+  write_gb_word(out, annotations.size());
+
+  for(const auto &annotation : annotations)
+  {
+    irepconverter.reference_convert(annotation.type, out);
+    write_gb_word(out, annotation.element_value_pairs.size());
+
+    for(const auto &pair : annotation.element_value_pairs)
+    {
+      irepconverter.write_string_ref(out, pair.element_name);
+      irepconverter.reference_convert(pair.value, out);
+    }
+  }
+}
+
+static void read_annotations(
+  std::istream &in,
+  irep_serializationt &irepconverter,
+  java_bytecode_parse_treet::annotationst &annotations)
+{
+  annotations.resize(irepconverter.read_gb_word(in));
+
+  for(auto &annotation : annotations)
+  {
+    irepconverter.reference_convert(in, annotation.type);
+    annotation.element_value_pairs.resize(irepconverter.read_gb_word(in));
+
+    for(auto &pair : annotation.element_value_pairs)
+    {
+      pair.element_name=irepconverter.read_string_ref(in);
+      irepconverter.reference_convert(in, pair.value);
+    }
+  }
+}
+
+static void write_member(
+  std::ostream &out,
+  irep_serializationt &irepconverter,
+  const java_bytecode_parse_treet::membert &member)
+{
+  write_gb_string(out, member.signature);
+  irepconverter.write_string_ref(out, member.name);
+  write_gb_word(out, member.is_public);
+  write_gb_word(out, member.is_protected);
+  write_gb_word(out, member.is_private);
+  write_gb_word(out, member.is_static);
+  write_gb_word(out, member.is_final);
+  write_annotations(out, irepconverter, member.annotations);
+}
+
+static void read_member(
+  std::istream &in,
+  irep_serializationt &irepconverter,
+  java_bytecode_parse_treet::membert &member)
+{
+  member.signature=id2string(irepconverter.read_gb_string(in));
+  member.name=irepconverter.read_string_ref(in);
+  member.is_public=irepconverter.read_gb_word(in)!=0;
+  member.is_protected=irepconverter.read_gb_word(in)!=0;
+  member.is_private=irepconverter.read_gb_word(in)!=0;
+  member.is_static=irepconverter.read_gb_word(in)!=0;
+  member.is_final=irepconverter.read_gb_word(in)!=0;
+  read_annotations(in, irepconverter, member.annotations);
+}
+
+static void write_verification_types(
+  std::ostream &out,
+  const std::vector<
+    java_bytecode_parse_treet::methodt::verification_type_infot> &types)
+{
+  write_gb_word(out, types.size());
+
+  for(const auto &t : types)
+  {
+    write_gb_word(out, t.type);
+    write_gb_word(out, t.tag);
+    write_gb_word(out, t.cpool_index);
+    write_gb_word(out, t.offset);
+  }
+}
+
+static void read_verification_types(
+  std::istream &in,
+  std::vector<
+    java_bytecode_parse_treet::methodt::verification_type_infot> &types)
+{
+  typedef java_bytecode_parse_treet::methodt::verification_type_infot
+    verification_type_infot;
+
+  types.resize(irep_serializationt::read_gb_word(in));
+
+  for(auto &t : types)
+  {
+    t.type=static_cast<verification_type_infot::verification_type_info_type>(
+      irep_serializationt::read_gb_word(in));
+    t.tag=static_cast<u1>(irep_serializationt::read_gb_word(in));
+    t.cpool_index=static_cast<u2>(irep_serializationt::read_gb_word(in));
+    t.offset=static_cast<u2>(irep_serializationt::read_gb_word(in));
+  }
+}
+
+static void write_method(
+  std::ostream &out,
+  irep_serializationt &irepconverter,
+  const java_bytecode_parse_treet::methodt &method)
+{
+  write_member(out, irepconverter, method);
+  irepconverter.write_string_ref(out, method.base_name);
+  write_gb_word(out, method.is_native);
+  write_gb_word(out, method.is_abstract);
+  write_gb_word(out, method.is_synchronized);
+  irepconverter.reference_convert(method.source_location, out);
+
+  write_gb_word(out, method.instructions.size());
+  for(const auto &instruction : method.instructions)
+  {
+    irepconverter.reference_convert(instruction.source_location, out);
+    write_gb_word(out, instruction.address);
+    irepconverter.write_string_ref(out, instruction.statement);
+    write_gb_word(out, instruction.args.size());
+    for(const auto &arg : instruction.args)
+      irepconverter.reference_convert(arg, out);
+  }
+
+  write_gb_word(out, method.exception_table.size());
+  for(const auto &entry : method.exception_table)
+  {
+    write_gb_word(out, entry.start_pc);
+    write_gb_word(out, entry.end_pc);
+    write_gb_word(out, entry.handler_pc);
+    irepconverter.reference_convert(entry.catch_type, out);
+  }
+
+  write_gb_word(out, method.local_variable_table.size());
+  for(const auto &v : method.local_variable_table)
+  {
+    irepconverter.write_string_ref(out, v.name);
+    write_gb_string(out, v.signature);
+    write_gb_word(out, v.index);
+    write_gb_word(out, v.start_pc);
+    write_gb_word(out, v.length);
+  }
+
+  write_gb_word(out, method.stack_map_table.size());
+  for(const auto &entry : method.stack_map_table)
+  {
+    write_gb_word(out, entry.type);
+    write_gb_word(out, entry.offset_delta);
+    write_gb_word(out, entry.chops);
+    write_gb_word(out, entry.appends);
+    write_verification_types(out, entry.locals);
+    write_verification_types(out, entry.stack);
+  }
+}
+
+static void read_method(
+  std::istream &in,
+  irep_serializationt &irepconverter,
+  java_bytecode_parse_treet::methodt &method)
+{
+  typedef java_bytecode_parse_treet::methodt::stack_map_table_entryt
+    stack_map_table_entryt;
+
+  read_member(in, irepconverter, method);
+  method.base_name=irepconverter.read_string_ref(in);
+  method.is_native=irepconverter.read_gb_word(in)!=0;
+  method.is_abstract=irepconverter.read_gb_word(in)!=0;
+  method.is_synchronized=irepconverter.read_gb_word(in)!=0;
+  irepconverter.reference_convert(in, method.source_location);
+
+  method.instructions.resize(irepconverter.read_gb_word(in));
+  for(auto &instruction : method.instructions)
+  {
+    irepconverter.reference_convert(in, instruction.source_location);
+    instruction.address=
+      static_cast<unsigned>(irepconverter.read_gb_word(in));
+    instruction.statement=irepconverter.read_string_ref(in);
+    instruction.args.resize(irepconverter.read_gb_word(in));
+    for(auto &arg : instruction.args)
+      irepconverter.reference_convert(in, arg);
+  }
+
+  method.exception_table.resize(irepconverter.read_gb_word(in));
+  for(auto &entry : method.exception_table)
+  {
+    entry.start_pc=irepconverter.read_gb_word(in);
+    entry.end_pc=irepconverter.read_gb_word(in);
+    entry.handler_pc=irepconverter.read_gb_word(in);
+    irepconverter.reference_convert(in, entry.catch_type);
+  }
+
+  method.local_variable_table.resize(irepconverter.read_gb_word(in));
+  for(auto &v : method.local_variable_table)
+  {
+    v.name=irepconverter.read_string_ref(in);
+    v.signature=id2string(irepconverter.read_gb_string(in));
+    v.index=irepconverter.read_gb_word(in);
+    v.start_pc=irepconverter.read_gb_word(in);
+    v.length=irepconverter.read_gb_word(in);
+  }
+
+  method.stack_map_table.resize(irepconverter.read_gb_word(in));
+  for(auto &entry : method.stack_map_table)
+  {
+    entry.type=static_cast<stack_map_table_entryt::stack_frame_type>(
+      irepconverter.read_gb_word(in));
+    entry.offset_delta=irepconverter.read_gb_word(in);
+    entry.chops=irepconverter.read_gb_word(in);
+    entry.appends=irepconverter.read_gb_word(in);
+    read_verification_types(in, entry.locals);
+    read_verification_types(in, entry.stack);
+  }
+}
+
+/// Writes the parse tree in the binary format of goto binaries, which
+/// lets a parse tree be passed from one process to another
+void java_bytecode_parse_treet::write(
+  std::ostream &out,
+  irep_serializationt &irepconverter) const
+{
+  irepconverter.write_string_ref(out, parsed_class.name);
+  irepconverter.write_string_ref(out, parsed_class.extends);
+  write_gb_word(out, parsed_class.is_abstract);
+  write_gb_word(out, parsed_class.is_enum);
+  write_gb_word(out, parsed_class.enum_elements);
+
+  write_gb_word(out, parsed_class.implements.size());
+  for(const auto &i : parsed_class.implements)
+    irepconverter.write_string_ref(out, i);
+
+  write_gb_word(out, parsed_class.fields.size());
+  for(const auto &field : parsed_class.fields)
+  {
+    write_member(out, irepconverter, field);
+    write_gb_word(out, field.is_enum);
+  }
+
+  write_gb_word(out, parsed_class.methods.size());
+  for(const auto &method : parsed_class.methods)
+    write_method(out, irepconverter, method);
+
+  write_annotations(out, irepconverter, parsed_class.annotations);
+
+  write_gb_word(out, class_refs.size());
+  for(const auto &c : class_refs)
+    irepconverter.write_string_ref(out, c);
+
+  write_gb_word(out, loading_successful);
+}
+
+/// Reads a parse tree written by write()
+/// \return true on error
+bool java_bytecode_parse_treet::read(
+  std::istream &in,
+  irep_serializationt &irepconverter)
+{
+  parsed_class.name=irepconverter.read_string_ref(in);
+  parsed_class.extends=irepconverter.read_string_ref(in);
+  parsed_class.is_abstract=irepconverter.read_gb_word(in)!=0;
+  parsed_class.is_enum=irepconverter.read_gb_word(in)!=0;
+  parsed_class.enum_elements=irepconverter.read_gb_word(in);
+
+  for(std::size_t n=irepconverter.read_gb_word(in); n>0 && in; n--)
+    parsed_class.implements.push_back(irepconverter.read_string_ref(in));
+
+  for(std::size_t n=irepconverter.read_gb_word(in); n>0 && in; n--)
+  {
+    fieldt &field=parsed_class.add_field();
+    read_member(in, irepconverter, field);
+    field.is_enum=irepconverter.read_gb_word(in)!=0;
+  }
+
+  for(std::size_t n=irepconverter.read_gb_word(in); n>0 && in; n--)
+    read_method(in, irepconverter, parsed_class.add_method());
+
+  read_annotations(in, irepconverter, parsed_class.annotations);
+
+  for(std::size_t n=irepconverter.read_gb_word(in); n>0 && in; n--)
+    class_refs.insert(irepconverter.read_string_ref(in));
+
+  loading_successful=irepconverter.read_gb_word(in)!=0;
+
+  return !in;
+}
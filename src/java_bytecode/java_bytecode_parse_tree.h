@@ -10,6 +10,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef CPROVER_JAVA_BYTECODE_JAVA_BYTECODE_PARSE_TREE_H
 #define CPROVER_JAVA_BYTECODE_JAVA_BYTECODE_PARSE_TREE_H
 
+#include <iosfwd>
 #include <set>
 
 #include <util/std_code.h>
@@ -17,6 +18,8 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "bytecode_info.h"
 
+class irep_serializationt;
+
 class java_bytecode_parse_treet
 {
 public:
@@ -208,6 +211,9 @@ public:
 
   void output(std::ostream &out) const;
 
+  void write(std::ostream &, irep_serializationt &) const;
+  bool read(std::istream &, irep_serializationt &);
+
   typedef std::set<irep_idt> class_refst;
   class_refst class_refs;
 
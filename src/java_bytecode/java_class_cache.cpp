@@ -0,0 +1,346 @@
+/*******************************************************************\
+
+Module: Cache for Converted Java Classes
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Cache for Converted Java Classes
+
+#include "java_class_cache.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include <util/string_hash.h>
+
+#include <goto-programs/read_bin_goto_object.h>
+#include <goto-programs/write_goto_binary.h>
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#endif
+
+std::string java_class_cachet::file_name(const std::string &suffix) const
+{
+  std::ostringstream result;
+
+  result << directory;
+#ifdef _WIN32
+  result << '\\';
+#else
+  result << '/';
+#endif
+  result << std::hex << std::setw(16) << std::setfill('0')
+         << hash_string(key) << suffix;
+
+  return result.str();
+}
+
+/// sets whether the file exists, its size and its modification time,
+/// which is zero if unknown
+void java_class_cachet::stat_dependency(dependencyt &dependency)
+{
+  dependency.exists=false;
+  dependency.size=0;
+  dependency.mtime=0;
+
+#ifdef _WIN32
+  std::ifstream in(dependency.file_name, std::ios::binary|std::ios::ate);
+  if(!in)
+    return;
+
+  dependency.exists=true;
+  dependency.size=in.tellg();
+#else
+  struct stat buf;
+  if(stat(dependency.file_name.c_str(), &buf)!=0)
+    return;
+
+  dependency.exists=true;
+  dependency.size=buf.st_size;
+  dependency.mtime=buf.st_mtime;
+#endif
+}
+
+std::size_t java_class_cachet::hash_file(const std::string &file_name)
+{
+  std::ifstream in(file_name, std::ios::binary);
+  std::ostringstream data;
+  data << in.rdbuf();
+  return hash_string(data.str());
+}
+
+java_class_cachet::dependencyt java_class_cachet::get_dependency(
+  const std::string &file_name)
+{
+  dependencyt dependency;
+  dependency.file_name=file_name;
+  stat_dependency(dependency);
+  dependency.hash=dependency.exists?hash_file(file_name):0;
+
+  return dependency;
+}
+
+/// reads the key and the dependencies of an entry
+/// \return true if the entry is not valid
+bool java_class_cachet::read_header(
+  std::istream &in,
+  const std::string &name,
+  irep_serializationt &irepconverter)
+{
+  if(id2string(irepconverter.read_gb_string(in))!="JAVA-CLASS-CACHE-2" ||
+     id2string(irepconverter.read_gb_string(in))!=key)
+    return true;
+
+  std::size_t count=irepconverter.read_gb_word(in);
+
+  for(std::size_t i=0; i<count && in; i++)
+  {
+    dependencyt recorded;
+    recorded.file_name=id2string(irepconverter.read_gb_string(in));
+    recorded.exists=irepconverter.read_gb_word(in)!=0;
+    recorded.size=irepconverter.read_gb_word(in);
+    recorded.mtime=irepconverter.read_gb_word(in);
+    recorded.hash=irepconverter.read_gb_word(in);
+
+    dependencyt current;
+    current.file_name=recorded.file_name;
+    stat_dependency(current);
+
+    // the contents are only hashed if the time stamp has changed
+    if(current.exists!=recorded.exists ||
+       current.size!=recorded.size ||
+       (current.exists &&
+        (current.mtime!=recorded.mtime || current.mtime==0) &&
+        hash_file(current.file_name)!=recorded.hash))
+    {
+      debug() << "class cache entry " << name << " is out of date: "
+              << recorded.file_name << " has changed" << eom;
+      return true;
+    }
+  }
+
+  return !in;
+}
+
+void java_class_cachet::write_header(
+  std::ostream &out,
+  const std::set<std::string> &files_read,
+  const std::set<std::string> &files_missing)
+{
+  write_gb_string(out, "JAVA-CLASS-CACHE-2");
+  write_gb_string(out, key);
+
+  write_gb_word(out, files_read.size()+files_missing.size());
+
+  for(const auto &f : files_read)
+  {
+    const dependencyt dependency=get_dependency(f);
+    write_gb_string(out, dependency.file_name);
+    write_gb_word(out, dependency.exists);
+    write_gb_word(out, dependency.size);
+    write_gb_word(out, dependency.mtime);
+    write_gb_word(out, dependency.hash);
+  }
+
+  for(const auto &f : files_missing)
+  {
+    write_gb_string(out, f);
+    write_gb_word(out, 0);
+    write_gb_word(out, 0);
+    write_gb_word(out, 0);
+    write_gb_word(out, 0);
+  }
+}
+
+/// Entries are written to a temporary file first, which protects
+/// concurrent readers from partially written entries.
+/// \return true on error
+bool java_class_cachet::commit(
+  const std::string &tmp_name,
+  const std::string &name)
+{
+  if(std::rename(tmp_name.c_str(), name.c_str())!=0)
+  {
+    std::remove(tmp_name.c_str());
+    warning() << "failed to write class cache entry " << name << eom;
+    return true;
+  }
+
+  return false;
+}
+
+bool java_class_cachet::read(
+  symbol_tablet &symbol_table,
+  std::vector<irep_idt> &main_jar_classes)
+{
+  const std::string name=file_name(".jcc");
+  std::ifstream in(name, std::ios::binary);
+
+  if(!in)
+    return true;
+
+  irep_serializationt::ireps_containert ic;
+  irep_serializationt irepconverter(ic);
+
+  if(read_header(in, name, irepconverter))
+    return true;
+
+  std::vector<irep_idt> classes(irepconverter.read_gb_word(in));
+  for(auto &c : classes)
+    c=irepconverter.read_gb_string(in);
+
+  if(!in)
+    return true;
+
+  symbol_tablet cached_symbol_table;
+  goto_functionst goto_functions;
+
+  if(read_bin_goto_object(
+       in, name, cached_symbol_table, goto_functions, get_message_handler()))
+    return true;
+
+  forall_symbols(s_it, cached_symbol_table.symbols)
+    symbol_table.add(s_it->second);
+
+  main_jar_classes.swap(classes);
+
+  return false;
+}
+
+bool java_class_cachet::write(
+  const std::set<std::string> &files_read,
+  const std::set<std::string> &files_missing,
+  const symbol_tablet &symbol_table,
+  const std::vector<irep_idt> &main_jar_classes)
+{
+  const std::string name=file_name(".jcc");
+  const std::string tmp_name=name+".tmp";
+
+  {
+    std::ofstream out(tmp_name, std::ios::binary);
+
+    if(!out)
+    {
+      warning() << "failed to write class cache entry " << name << eom;
+      return true;
+    }
+
+    write_header(out, files_read, files_missing);
+
+    write_gb_word(out, main_jar_classes.size());
+    for(const auto &c : main_jar_classes)
+      write_gb_string(out, id2string(c));
+
+    goto_functionst goto_functions;
+    if(write_goto_binary(out, symbol_table, goto_functions) || !out)
+    {
+      warning() << "failed to write class cache entry " << name << eom;
+      return true;
+    }
+  }
+
+  return commit(tmp_name, name);
+}
+
+bool java_class_cachet::read(ci_lazy_method_summariest &summaries)
+{
+  const std::string name=file_name(".jcg");
+  std::ifstream in(name, std::ios::binary);
+
+  if(!in)
+    return true;
+
+  irep_serializationt::ireps_containert ic;
+  irep_serializationt irepconverter(ic);
+
+  if(read_header(in, name, irepconverter))
+    return true;
+
+  ci_lazy_method_summariest result;
+
+  std::size_t count=irepconverter.read_gb_word(in);
+
+  for(std::size_t i=0; i<count && in; i++)
+  {
+    ci_lazy_method_summaryt &summary=
+      result[irepconverter.read_string_ref(in)];
+
+    summary.needed_methods.resize(irepconverter.read_gb_word(in));
+    for(auto &m : summary.needed_methods)
+      m=irepconverter.read_string_ref(in);
+
+    summary.needed_classes.resize(irepconverter.read_gb_word(in));
+    for(auto &c : summary.needed_classes)
+      c=irepconverter.read_string_ref(in);
+
+    summary.virtual_callees.resize(irepconverter.read_gb_word(in));
+    for(auto &callee : summary.virtual_callees)
+      irepconverter.reference_convert(in, callee);
+  }
+
+  if(!in)
+    return true;
+
+  summaries.swap(result);
+
+  return false;
+}
+
+bool java_class_cachet::write(
+  const std::set<std::string> &files_read,
+  const std::set<std::string> &files_missing,
+  const ci_lazy_method_summariest &summaries)
+{
+  const std::string name=file_name(".jcg");
+  const std::string tmp_name=name+".tmp";
+
+  {
+    std::ofstream out(tmp_name, std::ios::binary);
+
+    if(!out)
+    {
+      warning() << "failed to write class cache entry " << name << eom;
+      return true;
+    }
+
+    write_header(out, files_read, files_missing);
+
+    irep_serializationt::ireps_containert ic;
+    irep_serializationt irepconverter(ic);
+
+    write_gb_word(out, summaries.size());
+
+    for(const auto &entry : summaries)
+    {
+      const ci_lazy_method_summaryt &summary=entry.second;
+
+      irepconverter.write_string_ref(out, entry.first);
+
+      write_gb_word(out, summary.needed_methods.size());
+      for(const auto &m : summary.needed_methods)
+        irepconverter.write_string_ref(out, m);
+
+      write_gb_word(out, summary.needed_classes.size());
+      for(const auto &c : summary.needed_classes)
+        irepconverter.write_string_ref(out, c);
+
+      write_gb_word(out, summary.virtual_callees.size());
+      for(const auto &callee : summary.virtual_callees)
+        irepconverter.reference_convert(callee, out);
+    }
+
+    if(!out)
+    {
+      warning() << "failed to write class cache entry " << name << eom;
+      return true;
+    }
+  }
+
+  return commit(tmp_name, name);
+}
@@ -0,0 +1,101 @@
+/*******************************************************************\
+
+Module: Cache for Converted Java Classes
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Cache for Converted Java Classes
+
+#ifndef CPROVER_JAVA_BYTECODE_JAVA_CLASS_CACHE_H
+#define CPROVER_JAVA_BYTECODE_JAVA_CLASS_CACHE_H
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include <util/message.h>
+#include <util/symbol_table.h>
+#include <util/irep_serialization.h>
+
+#include "ci_lazy_methods.h"
+
+/// Stores the symbol table obtained by converting the classes of a Java
+/// program in a directory, so that later runs on the same inputs can skip
+/// loading, parsing and converting the classes. An entry is found by a
+/// hash of the options that affect the conversion, and is only used if
+/// all files that were read to create it are unchanged. A file whose size
+/// and modification time are as recorded is taken to be unchanged;
+/// otherwise, a hash of its contents is compared. The same mechanism stores the
+/// summaries used by --lazy-methods to find the reachable methods.
+class java_class_cachet:public messaget
+{
+public:
+  /// \param _directory: the cache directory, which must exist
+  /// \param _key: all options that affect the conversion
+  java_class_cachet(
+    const std::string &_directory,
+    const std::string &_key):
+    directory(_directory),
+    key(_key)
+  {
+  }
+
+  /// a file that was read, or looked for and not found
+  struct dependencyt
+  {
+    std::string file_name;
+    bool exists;
+    std::size_t size;
+    std::size_t mtime;
+    std::size_t hash;
+  };
+
+  /// \return true if there is no valid entry
+  bool read(
+    symbol_tablet &symbol_table,
+    std::vector<irep_idt> &main_jar_classes);
+
+  /// \return true on error
+  bool write(
+    const std::set<std::string> &files_read,
+    const std::set<std::string> &files_missing,
+    const symbol_tablet &symbol_table,
+    const std::vector<irep_idt> &main_jar_classes);
+
+  /// Reads the summaries of the methods elaborated by --lazy-methods
+  /// \return true if there is no valid entry
+  bool read(ci_lazy_method_summariest &summaries);
+
+  /// \return true on error
+  bool write(
+    const std::set<std::string> &files_read,
+    const std::set<std::string> &files_missing,
+    const ci_lazy_method_summariest &summaries);
+
+protected:
+  const std::string directory;
+  const std::string key;
+
+  std::string file_name(const std::string &suffix) const;
+
+  static dependencyt get_dependency(const std::string &file_name);
+  static void stat_dependency(dependencyt &);
+  static std::size_t hash_file(const std::string &file_name);
+
+  bool read_header(
+    std::istream &,
+    const std::string &file_name,
+    irep_serializationt &);
+
+  void write_header(
+    std::ostream &,
+    const std::set<std::string> &files_read,
+    const std::set<std::string> &files_missing);
+
+  bool commit(const std::string &tmp_name, const std::string &file_name);
+};
+
+#endif // CPROVER_JAVA_BYTECODE_JAVA_CLASS_CACHE_H
@@ -8,6 +8,9 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "java_class_loader.h"
 
+#include <algorithm>
+#include <cerrno>
+#include <iostream>
 #include <stack>
 #include <map>
 #include <fstream>
@@ -15,12 +18,32 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/suffix.h>
 #include <util/prefix.h>
 #include <util/config.h>
+#include <util/invariant.h>
+#include <util/irep_serialization.h>
+#include <util/tempfile.h>
+#include <util/time_stopping.h>
 
 #include "java_bytecode_parser.h"
 #include "jar_file.h"
 
+#ifndef _WIN32
+#include <unistd.h>
+#include <sys/wait.h>
+#endif
+
 java_bytecode_parse_treet &java_class_loadert::operator()(
   const irep_idt &class_name)
+{
+  java_class_loader_limitt class_loader_limit(
+    get_message_handler(), java_cp_include_files);
+
+  return load_class(class_loader_limit, class_name);
+}
+
+/// Loads the given class and, transitively, all classes it refers to
+java_bytecode_parse_treet &java_class_loadert::load_class(
+  java_class_loader_limitt &class_loader_limit,
+  const irep_idt &class_name)
 {
   std::stack<irep_idt> queue;
 
@@ -33,9 +56,6 @@ java_bytecode_parse_treet &java_class_loadert::operator()(
   queue.push("java.lang.Class");
   queue.push(class_name);
 
-  java_class_loader_limitt class_loader_limit(
-    get_message_handler(), java_cp_include_files);
-
   while(!queue.empty())
   {
     irep_idt c=queue.top();
@@ -68,6 +88,31 @@ void java_class_loadert::set_java_cp_include_files(
   jar_pool.set_message_handler(get_message_handler());
 }
 
+/// parses a class file in a JAR file, without copying it if it is stored
+/// uncompressed
+void java_class_loadert::parse_jar_entry(
+  jar_filet &jar_file,
+  const std::string &class_file_name,
+  java_bytecode_parse_treet &parse_tree)
+{
+  const char *data;
+  std::size_t size;
+
+  if(jar_file.get_entry(class_file_name, jar_entry_buffer, data, size))
+  {
+    error() << "failed to read `" << class_file_name << "' from JAR" << eom;
+    return;
+  }
+
+  jar_entry_streambuft streambuf(data, size);
+  std::istream istream(&streambuf);
+
+  java_bytecode_parse(
+    istream,
+    parse_tree,
+    get_message_handler());
+}
+
 java_bytecode_parse_treet &java_class_loadert::get_parse_tree(
   java_class_loader_limitt &class_loader_limit,
   const irep_idt &class_name)
@@ -88,15 +133,18 @@ java_bytecode_parse_treet &java_class_loadert::get_parse_tree(
       debug() << "Getting class `" << class_name << "' from JAR "
               << jf << eom;
 
-      std::string data=jar_pool(class_loader_limit, jf)
-        .get_entry(jm_it->second.class_file_name);
-
-      std::istringstream istream(data);
+      class_mapt::iterator p_it=parsed_classes.find(class_name);
 
-      java_bytecode_parse(
-        istream,
-        parse_tree,
-        get_message_handler());
+      if(p_it!=parsed_classes.end())
+      {
+        parse_tree.swap(p_it->second);
+        parsed_classes.erase(p_it);
+      }
+      else
+        parse_jar_entry(
+          jar_pool(class_loader_limit, jf),
+          jm_it->second.class_file_name,
+          parse_tree);
 
       return parse_tree;
     }
@@ -119,15 +167,10 @@ java_bytecode_parse_treet &java_class_loadert::get_parse_tree(
         debug() << "Getting class `" << class_name << "' from JAR "
                 << cp << eom;
 
-        std::string data=jar_pool(class_loader_limit, cp)
-          .get_entry(jm_it->second.class_file_name);
-
-        std::istringstream istream(data);
-
-        java_bytecode_parse(
-          istream,
-          parse_tree,
-          get_message_handler());
+        parse_jar_entry(
+          jar_pool(class_loader_limit, cp),
+          jm_it->second.class_file_name,
+          parse_tree);
 
         return parse_tree;
       }
@@ -143,14 +186,20 @@ java_bytecode_parse_treet &java_class_loadert::get_parse_tree(
         #endif
 
       // full class path starts with './'
-      if(class_loader_limit.load_class_file(full_path.substr(2)) &&
-         std::ifstream(full_path))
+      if(class_loader_limit.load_class_file(full_path.substr(2)))
       {
-        if(!java_bytecode_parse(
-             full_path,
-             parse_tree,
-             get_message_handler()))
-          return parse_tree;
+        if(!std::ifstream(full_path))
+          class_files_missing.insert(full_path);
+        else
+        {
+          class_files_read.insert(full_path);
+
+          if(!java_bytecode_parse(
+               full_path,
+               parse_tree,
+               get_message_handler()))
+            return parse_tree;
+        }
       }
     }
   }
@@ -165,16 +214,188 @@ void java_class_loadert::load_entire_jar(
   java_class_loader_limitt &class_loader_limit,
   const std::string &file)
 {
+  absolute_timet load_start=current_time();
+
   read_jar_file(class_loader_limit, file);
 
   const auto &jm=jar_map[file];
 
   jar_files.push_front(file);
 
+  #ifndef _WIN32
+  if(jobs>1)
+    parse_jar_parallel(class_loader_limit, file);
+  #endif
+
+  // The limit is shared by all classes, which avoids compiling the
+  // regular expression (or reading the JSON file) once per class.
   for(const auto &e : jm.entries)
-    operator()(e.first);
+    load_class(class_loader_limit, e.first);
 
   jar_files.pop_front();
+  parsed_classes.clear();
+
+  absolute_timet load_stop=current_time();
+  statistics() << "Loaded " << jm.entries.size() << " classes from JAR "
+               << file << " in " << (load_stop-load_start) << "s" << eom;
+}
+
+/// Parses the classes in the given JAR file that have not been loaded
+/// yet using up to `jobs` processes, as ireps must not be shared among
+/// threads. Each process returns its parse trees in a temporary file,
+/// and these are read back in the order of the processes into
+/// parsed_classes. load_class then takes them from there and loads the
+/// classes they refer to as usual. Classes that fail to be passed back
+/// are left to the sequential loader.
+void java_class_loadert::parse_jar_parallel(
+  java_class_loader_limitt &class_loader_limit,
+  const std::string &file)
+{
+  #ifdef _WIN32
+  UNREACHABLE;
+  #else
+  jar_filet &jar_file=jar_pool(class_loader_limit, file);
+
+  if(!jar_file)
+    return;
+
+  const jar_map_entryt::entriest &entries=jar_map[file].entries;
+  std::vector<irep_idt> pending;
+
+  for(const auto &e : entries)
+    if(class_map.find(e.first)==class_map.end())
+      pending.push_back(e.first);
+
+  const std::size_t workers=std::min<std::size_t>(jobs, pending.size());
+
+  if(workers<2)
+    return;
+
+  statistics() << "Parsing " << pending.size() << " classes using "
+               << workers << " jobs" << eom;
+
+  std::vector<temporary_filet> results;
+  results.reserve(workers);
+  std::vector<pid_t> children;
+
+  // don't let the children repeat buffered output
+  std::cout << std::flush;
+  std::cerr << std::flush;
+
+  for(std::size_t i=0; i<workers; i++)
+  {
+    results.emplace_back("java_class_loader_", ".bin");
+
+    pid_t childpid=fork();
+
+    if(childpid==0)
+    {
+      bool r=parse_jar_share(
+        jar_file, entries, pending, i, workers, results.back()());
+
+      std::cout << std::flush;
+      std::cerr << std::flush;
+
+      _exit(r?1:0);
+    }
+    else if(childpid<0)
+    {
+      warning() << "failed to start a class parsing job" << eom;
+      results.pop_back();
+      break;
+    }
+
+    children.push_back(childpid);
+  }
+
+  std::vector<bool> succeeded(children.size(), false);
+
+  for(std::size_t i=0; i<children.size(); i++)
+  {
+    int status;
+
+    while(waitpid(children[i], &status, 0)==-1)
+    {
+      if(errno!=EINTR)
+      {
+        error() << "waiting for class parsing job failed" << eom;
+        throw 0;
+      }
+    }
+
+    succeeded[i]=WIFEXITED(status) && WEXITSTATUS(status)==0;
+  }
+
+  for(std::size_t i=0; i<children.size(); i++)
+  {
+    if(!succeeded[i])
+    {
+      warning() << "class parsing job failed" << eom;
+      continue;
+    }
+
+    std::ifstream in(results[i](), std::ios::binary);
+    irep_serializationt::ireps_containert ic;
+    irep_serializationt irepconverter(ic);
+
+    for(std::size_t n=irepconverter.read_gb_word(in); n>0 && in; n--)
+    {
+      const irep_idt class_name=irepconverter.read_string_ref(in);
+      java_bytecode_parse_treet parse_tree;
+
+      if(parse_tree.read(in, irepconverter))
+      {
+        warning() << "failed to read the result of a class parsing job"
+                  << eom;
+        break;
+      }
+
+      parsed_classes[class_name].swap(parse_tree);
+    }
+  }
+  #endif
+}
+
+/// Parses every `step`-th class of `class_names`, beginning with the one
+/// at `first`, and writes the parse trees to `file_name`. Runs in a
+/// process of its own.
+/// \return true on error, false otherwise
+bool java_class_loadert::parse_jar_share(
+  jar_filet &jar_file,
+  const jar_map_entryt::entriest &entries,
+  const std::vector<irep_idt> &class_names,
+  std::size_t first,
+  std::size_t step,
+  const std::string &file_name)
+{
+  std::ofstream out(file_name, std::ios::binary);
+
+  if(!out)
+    return true;
+
+  irep_serializationt::ireps_containert ic;
+  irep_serializationt irepconverter(ic);
+
+  write_gb_word(out, (class_names.size()-first+step-1)/step);
+
+  for(std::size_t i=first; i<class_names.size(); i+=step)
+  {
+    // the parse trees are kept until the end, as the serialization
+    // identifies ireps by their address
+    java_bytecode_parse_treet &parse_tree=class_map[class_names[i]];
+
+    debug() << "Reading class " << class_names[i] << eom;
+
+    parse_jar_entry(
+      jar_file,
+      entries.at(class_names[i]).class_file_name,
+      parse_tree);
+
+    irepconverter.write_string_ref(out, class_names[i]);
+    parse_tree.write(out, irepconverter);
+  }
+
+  return !out;
 }
 
 void java_class_loadert::read_jar_file(
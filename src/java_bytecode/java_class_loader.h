@@ -13,6 +13,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <map>
 #include <regex>
 #include <set>
+#include <vector>
 
 #include <util/message.h>
 
@@ -23,6 +24,10 @@ Author: Daniel Kroening, kroening@kroening.com
 class java_class_loadert:public messaget
 {
 public:
+  java_class_loadert():jobs(1)
+  {
+  }
+
   java_bytecode_parse_treet &operator()(const irep_idt &);
 
   void set_java_cp_include_files(std::string &);
@@ -41,6 +46,9 @@ public:
 
   void load_entire_jar(java_class_loader_limitt &, const std::string &f);
 
+  // the number of processes used for parsing the classes of a JAR file
+  unsigned jobs;
+
   jar_poolt jar_pool;
 
   class jar_map_entryt
@@ -66,8 +74,37 @@ public:
   java_bytecode_parse_treet &get_parse_tree(
     java_class_loader_limitt &, const irep_idt &);
 
+  java_bytecode_parse_treet &load_class(
+    java_class_loader_limitt &, const irep_idt &);
+
+  void parse_jar_entry(
+    jar_filet &,
+    const std::string &class_file_name,
+    java_bytecode_parse_treet &);
+
+  void parse_jar_parallel(java_class_loader_limitt &, const std::string &f);
+
+  bool parse_jar_share(
+    jar_filet &,
+    const jar_map_entryt::entriest &,
+    const std::vector<irep_idt> &class_names,
+    std::size_t first,
+    std::size_t step,
+    const std::string &file_name);
+
+  // classes of a JAR file parsed by parse_jar_parallel, which
+  // get_parse_tree takes instead of parsing them again
+  class_mapt parsed_classes;
+
+  // reused when inflating classes from JAR files
+  std::string jar_entry_buffer;
+
   std::list<std::string> jar_files;
   std::string java_cp_include_files;
+
+  // class files outside of JAR files that were read, or looked for
+  // and not found
+  std::set<std::string> class_files_read, class_files_missing;
 };
 
 #endif // CPROVER_JAVA_BYTECODE_JAVA_CLASS_LOADER_H
@@ -78,7 +78,8 @@ void java_static_lifetime_init(
   symbol_tablet &symbol_table,
   const source_locationt &source_location,
   bool assume_init_pointers_not_null,
-  unsigned max_nondet_array_length)
+  unsigned max_nondet_array_length,
+  size_t max_nondet_tree_depth)
 {
   symbolt &initialize_symbol=symbol_table.lookup(INITIALIZE);
   code_blockt &code_block=to_code_block(to_code(initialize_symbol.value));
@@ -118,6 +119,7 @@ void java_static_lifetime_init(
           allow_null,
           symbol_table,
           max_nondet_array_length,
+          max_nondet_tree_depth,
           source_location);
         code_assignt assignment(sym.symbol_expr(), newsym);
         code_block.add(assignment);
@@ -156,7 +158,8 @@ exprt::operandst java_build_arguments(
   code_blockt &init_code,
   symbol_tablet &symbol_table,
   bool assume_init_pointers_not_null,
-  unsigned max_nondet_array_length)
+  unsigned max_nondet_array_length,
+  size_t max_nondet_tree_depth)
 {
   const code_typet::parameterst &parameters=
     to_code_type(function.type).parameters();
@@ -199,6 +202,7 @@ exprt::operandst java_build_arguments(
         allow_null,
         symbol_table,
         max_nondet_array_length,
+        max_nondet_tree_depth,
         function.location);
 
     // record as an input
@@ -472,13 +476,16 @@ main_function_resultt get_main_symbol(
 /// \param assume_init_pointers_not_null: allow pointers in initialization code
 ///   to be null
 /// max_nondet_array_length
+/// \param max_nondet_tree_depth: if not zero, create input objects using
+///   a function per class, with trees of objects at most this deep
 /// \return true if error occurred on entry point search
 bool java_entry_point(
   symbol_tablet &symbol_table,
   const irep_idt &main_class,
   message_handlert &message_handler,
   bool assume_init_pointers_not_null,
-  size_t max_nondet_array_length)
+  size_t max_nondet_array_length,
+  size_t max_nondet_tree_depth)
 {
   // check if the entry point is already there
   if(symbol_table.symbols.find(goto_functionst::entry_point())!=
@@ -501,7 +508,8 @@ bool java_entry_point(
     symbol_table,
     symbol.location,
     assume_init_pointers_not_null,
-    max_nondet_array_length);
+    max_nondet_array_length,
+    max_nondet_tree_depth);
 
   code_blockt init_code;
 
@@ -565,7 +573,8 @@ bool java_entry_point(
       init_code,
       symbol_table,
       assume_init_pointers_not_null,
-      max_nondet_array_length);
+      max_nondet_array_length,
+      max_nondet_tree_depth);
   call_main.arguments()=main_arguments;
 
   init_code.move_to_operands(call_main);
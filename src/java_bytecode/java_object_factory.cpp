@@ -58,6 +58,11 @@ class java_object_factoryt
   std::unordered_set<irep_idt, irep_id_hash> recursion_set;
   bool assume_non_null;
   size_t max_nondet_array_length;
+  // If not zero, the objects of a class are created by a function for
+  // that class, and the object trees are at most this deep.
+  size_t max_nondet_tree_depth;
+  // the depth of the objects created by the function
+  exprt depth;
   symbol_tablet &symbol_table;
   namespacet ns;
 
@@ -77,17 +82,27 @@ class java_object_factoryt
     const exprt &max_length_expr,
     const typet &element_type);
 
+  irep_idt get_nondet_init_function(const symbol_typet &class_type);
+
+  void gen_nondet_init_call(
+    code_blockt &assignments,
+    const exprt &expr,
+    const symbol_typet &class_type);
+
 public:
   java_object_factoryt(
     std::vector<const symbolt *> &_symbols_created,
     const source_locationt &loc,
     bool _assume_non_null,
     size_t _max_nondet_array_length,
+    size_t _max_nondet_tree_depth,
     symbol_tablet &_symbol_table):
       symbols_created(_symbols_created),
       loc(loc),
       assume_non_null(_assume_non_null),
       max_nondet_array_length(_max_nondet_array_length),
+      max_nondet_tree_depth(_max_nondet_tree_depth),
+      depth(from_integer(0, java_int_type())),
       symbol_table(_symbol_table),
       ns(_symbol_table)
   {}
@@ -285,12 +300,23 @@ void java_object_factoryt::gen_nondet_pointer_init(
 {
   const typet &subtype=ns.follow(pointer_type.subtype());
 
+  // objects of classes are created by a function for the class,
+  // which bounds the depth of the tree instead of the recursion set
+  bool use_init_function=false;
+
   if(subtype.id()==ID_struct)
   {
     const struct_typet &struct_type=to_struct_type(subtype);
     const irep_idt struct_tag=struct_type.get_tag();
+
+    use_init_function=
+      max_nondet_tree_depth!=0 &&
+      pointer_type.subtype().id()==ID_symbol &&
+      !has_prefix(id2string(struct_tag), "java::array[");
+
     // set to null if found in recursion set and not a sub-type
-    if(recursion_set.find(struct_tag)!=recursion_set.end() &&
+    if(!use_init_function &&
+       recursion_set.find(struct_tag)!=recursion_set.end() &&
        struct_tag==class_identifier)
     {
       assignments.copy_to_operands(
@@ -300,11 +326,21 @@ void java_object_factoryt::gen_nondet_pointer_init(
   }
 
   code_blockt non_null_inst;
-  gen_pointer_target_init(
-    non_null_inst,
-    expr,
-    subtype,
-    create_dynamic_objects);
+  if(use_init_function)
+  {
+    gen_nondet_init_call(
+      non_null_inst,
+      expr,
+      to_symbol_type(pointer_type.subtype()));
+  }
+  else
+  {
+    gen_pointer_target_init(
+      non_null_inst,
+      expr,
+      subtype,
+      create_dynamic_objects);
+  }
 
   if(assume_non_null)
   {
@@ -334,6 +370,138 @@ void java_object_factoryt::gen_nondet_pointer_init(
   }
 }
 
+/// Returns the function that creates a nondet object of the given class,
+/// generating it when it is first needed. The function takes the depth of
+/// the object in the tree, allocates the object and initialises its
+/// members, calling the functions of the classes of its fields, and
+/// returns null once the depth exceeds `max_nondet_tree_depth`.
+/// \param class_type: symbol type of the class
+/// \return the identifier of the function
+irep_idt java_object_factoryt::get_nondet_init_function(
+  const symbol_typet &class_type)
+{
+  const irep_idt function=
+    id2string(class_type.get_identifier())+
+    (assume_non_null?".<nondet_init_non_null>":".<nondet_init>");
+
+  if(symbol_table.has_symbol(function))
+    return function;
+
+  parameter_symbolt depth_symbol;
+  depth_symbol.base_name="depth";
+  depth_symbol.mode=ID_java;
+  depth_symbol.name=id2string(function)+"::depth";
+  depth_symbol.type=java_int_type();
+  symbol_table.add(depth_symbol);
+
+  code_typet code_type;
+  code_type.return_type()=java_reference_type(class_type);
+  code_typet::parametert parameter(depth_symbol.type);
+  parameter.set_identifier(depth_symbol.name);
+  parameter.set_base_name(depth_symbol.base_name);
+  code_type.parameters().push_back(parameter);
+
+  // added before the body is generated, as the class may be recursive
+  symbolt function_symbol;
+  function_symbol.name=function;
+  function_symbol.base_name=id2string(class_type.get_identifier())+
+    ".<nondet_init>";
+  function_symbol.pretty_name=function_symbol.base_name;
+  function_symbol.mode=ID_java;
+  function_symbol.type=code_type;
+  function_symbol.location=loc;
+  symbol_table.add(function_symbol);
+
+  std::vector<const symbolt *> body_symbols_created;
+
+  java_object_factoryt body_factory(
+    body_symbols_created,
+    loc,
+    assume_non_null,
+    max_nondet_array_length,
+    max_nondet_tree_depth,
+    symbol_table);
+  body_factory.depth=depth_symbol.symbol_expr();
+
+  symbolt &object=new_tmp_symbol(
+    symbol_table,
+    loc,
+    code_type.return_type(),
+    "nondet_init_object");
+  body_symbols_created.push_back(&object);
+  const exprt object_expr=object.symbol_expr();
+
+  code_blockt allocation;
+  body_factory.gen_pointer_target_init(
+    allocation,
+    object_expr,
+    ns.follow(class_type),
+    true);
+
+  code_ifthenelset depth_check;
+  depth_check.cond()=
+    binary_relation_exprt(
+      depth_symbol.symbol_expr(),
+      ID_le,
+      from_integer(max_nondet_tree_depth, java_int_type()));
+  depth_check.then_case()=allocation;
+  depth_check.else_case()=
+    get_null_assignment(object_expr, to_pointer_type(object_expr.type()));
+
+  code_blockt body;
+  for(const symbolt * const symbol_ptr : body_symbols_created)
+  {
+    code_declt decl(symbol_ptr->symbol_expr());
+    decl.add_source_location()=loc;
+    body.add(decl);
+  }
+
+  body.move_to_operands(depth_check);
+
+  code_returnt code_return(object_expr);
+  code_return.add_source_location()=loc;
+  body.move_to_operands(code_return);
+
+  symbol_table.lookup(function).value=body;
+
+  return function;
+}
+
+/// Assigns to `expr` an object created by the function for its class.
+/// \param assignments: The code block to append the new instructions to
+/// \param expr: pointer-typed lvalue expression to initialise
+/// \param class_type: symbol type of the class of the object
+void java_object_factoryt::gen_nondet_init_call(
+  code_blockt &assignments,
+  const exprt &expr,
+  const symbol_typet &class_type)
+{
+  const symbolt &function_symbol=
+    ns.lookup(get_nondet_init_function(class_type));
+
+  symbolt &result=new_tmp_symbol(
+    symbol_table,
+    loc,
+    to_code_type(function_symbol.type).return_type(),
+    "nondet_init_result");
+  symbols_created.push_back(&result);
+
+  code_function_callt call;
+  call.lhs()=result.symbol_expr();
+  call.function()=function_symbol.symbol_expr();
+  call.arguments().push_back(
+    plus_exprt(depth, from_integer(1, depth.type())));
+  call.add_source_location()=loc;
+  assignments.move_to_operands(call);
+
+  exprt rhs=result.symbol_expr();
+  if(rhs.type()!=expr.type())
+    rhs=typecast_exprt(rhs, expr.type());
+  code_assignt code(expr, rhs);
+  code.add_source_location()=loc;
+  assignments.move_to_operands(code);
+}
+
 /// Initialises an object tree rooted at `expr`, allocating child objects as
 /// necessary and nondet-initialising their members.
 /// \param assignments: The code block to append the new
@@ -614,6 +782,7 @@ exprt object_factory(
   bool allow_null,
   symbol_tablet &symbol_table,
   size_t max_nondet_array_length,
+  size_t max_nondet_tree_depth,
   const source_locationt &loc)
 {
   irep_idt identifier=id2string(goto_functionst::entry_point())+
@@ -641,6 +810,7 @@ exprt object_factory(
     loc,
     !allow_null,
     max_nondet_array_length,
+    max_nondet_tree_depth,
     symbol_table);
   code_blockt assignments;
   state.gen_nondet_init(
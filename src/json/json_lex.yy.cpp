@@ -0,0 +1,180 @@
+/* generated by miniflex */
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#define yylex yyjsonlex
+#define yytext yyjsontext
+#define yyleng yyjsonleng
+#define yyin yyjsonin
+#define yyout yyjsonout
+#define yywrap yyjsonwrap
+#define yyrestart yyjsonrestart
+#define yylineno yyjsonlineno
+#define YY_NULL 0
+int yylex();
+extern char *yytext;
+extern int yyleng;
+extern FILE *yyin, *yyout;
+static void yy_flush_buffer_impl();
+#define YY_FLUSH_BUFFER yy_flush_buffer_impl()
+#define BEGIN yy_start_state=
+#define YY_START yy_start_state
+#define yyterminate() return YY_NULL
+static int yy_start_state=0;
+// Strictly follows http://www.json.org/
+#ifdef _WIN32
+#define YY_NO_UNISTD_H
+static int isatty(int) { return 0; }
+#endif
+
+#define PARSER json_parser
+
+#include "json_parser.h"
+#include "json_y.tab.h"
+
+#include <util/pragma_wsign_compare.def>
+#include <util/pragma_wnull_conversion.def>
+#include <util/pragma_wdeprecated_register.def>
+
+
+#ifndef YY_INPUT
+#define YY_INPUT(buf, result, max_size) (result=(int)fread((buf), 1, (max_size), yyin?yyin:stdin))
+#endif
+#ifndef YY_USER_ACTION
+#define YY_USER_ACTION
+#endif
+#ifndef ECHO
+#define ECHO fwrite(yytext, yyleng, 1, yyout?yyout:stdout)
+#endif
+#ifndef YY_BREAK
+#define YY_BREAK break;
+#endif
+#define INITIAL 0
+char *yytext=nullptr;
+int yyleng=0;
+FILE *yyin=nullptr, *yyout=nullptr;
+static std::vector<char> yy_buf;
+static std::size_t yy_pos=0, yy_len=0, yy_hold_pos=0;
+static bool yy_buf_valid=false, yy_hold_active=false;
+static char yy_hold=0;
+static std::vector<int> yy_state_stack;
+static void yy_flush_buffer_impl()
+{ yy_buf_valid=false; yy_hold_active=false; }
+static void yy_push_state(int s)
+{ yy_state_stack.push_back(yy_start_state); yy_start_state=s; }
+static void yy_pop_state()
+{ yy_start_state=yy_state_stack.back(); yy_state_stack.pop_back(); }
+static int yy_top_state() { return yy_state_stack.back(); }
+static bool yy_eof=false;
+static bool yy_more_input()
+{
+  if(yy_eof) return false;
+  yy_buf.erase(yy_buf.begin(), yy_buf.begin()+yy_pos);
+  yy_len-=yy_pos; yy_pos=0;
+  yy_buf.resize(yy_len);
+  char chunk[8192];
+  int result=0;
+  YY_INPUT(chunk, result, sizeof(chunk));
+  if(result<=0) yy_eof=true;
+  else yy_buf.insert(yy_buf.end(), chunk, chunk+result);
+  yy_len=yy_buf.size();
+  yy_buf.push_back(0);
+  return result>0;
+}
+static void yy_fill()
+{
+  yy_buf.clear(); yy_buf.push_back(0);
+  yy_pos=0; yy_len=0; yy_eof=false;
+  yy_buf_valid=true;
+  yy_more_input();
+}
+#define yyless(n) do { yy_buf[yy_hold_pos]=yy_hold; yy_pos=(yytext-yy_buf.data())+(n); yy_hold_pos=yy_pos; yy_hold=yy_buf[yy_pos]; yy_buf[yy_pos]=0; yyleng=(n); } while(0)
+static void yyunput_impl(int c)
+{
+  if(yy_hold_active) { yy_buf[yy_hold_pos]=yy_hold; yy_hold_active=false; }
+  if(yy_pos==0) { yy_buf.insert(yy_buf.begin(), (char)c); yy_len++; }
+  else yy_buf[--yy_pos]=(char)c;
+}
+#define unput(c) yyunput_impl(c)
+#define yymore() static_assert(false, "yymore unsupported")
+static const unsigned char yy_ec[256]={19,19,19,19,19,19,19,19,19,1,2,19,19,1,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,1,19,0,19,19,19,19,19,19,19,19,3,19,4,5,19,7,6,6,6,6,6,6,6,6,6,19,19,19,19,19,19,19,19,19,19,19,8,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,9,19,19,19,19,10,19,19,19,11,12,19,19,19,19,19,13,19,14,19,19,19,15,16,17,18,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19};
+static const short yy_nxt[]={1,8,9,10,2,10,3,4,10,10,10,10,6,10,7,10,10,5,10,10,46,47,47,47,47,47,47,47,47,48,47,47,47,47,47,47,47,47,47,47,-1,-1,-1,-1,-1,-1,42,43,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,21,40,40,23,-1,-1,22,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,21,-1,-1,23,-1,-1,22,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,18,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,14,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,11,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,12,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,13,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,15,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,16,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,19,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,20,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,30,30,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,28,29,-1,26,26,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,24,25,-1,26,26,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,26,26,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,26,26,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,27,27,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,27,27,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,26,26,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,26,26,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,31,31,33,-1,-1,32,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,31,31,33,-1,-1,32,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,38,39,-1,34,34,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,35,36,-1,34,34,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,37,37,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,34,34,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,34,34,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,37,37,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,34,34,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,34,34,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,21,41,41,23,-1,-1,22,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,21,41,41,23,-1,-1,22,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,21,44,44,23,-1,-1,22,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,21,-1,-1,23,-1,-1,22,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,21,45,45,23,-1,-1,22,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,21,45,45,23,-1,-1,22,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,53,50,50,50,50,50,50,50,50,51,50,50,50,50,50,50,50,50,50,50,49,50,50,50,50,50,50,50,50,51,50,50,50,50,50,50,50,50,50,50,53,50,50,50,50,50,50,50,50,51,50,50,50,50,50,50,50,50,50,50,53,50,50,50,50,50,50,50,50,51,50,50,50,50,50,50,50,50,50,50,52,50,50,50,50,50,50,50,50,51,50,50,50,50,50,50,50,50,50,50,53,50,50,50,50,50,50,50,50,51,50,50,50,50,50,50,50,50,50,50,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1};
+static const unsigned char yy_jam[]={0,0,0,0,0,0,0,0,1,1,1,0,0,1,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1};
+static const short yy_accept[]={-1,5,6,1,1,6,6,6,5,5,6,-1,-1,4,-1,-1,-1,3,-1,-1,2,-1,-1,-1,-1,-1,1,1,-1,-1,1,1,-1,-1,1,-1,-1,1,-1,-1,1,1,1,1,1,1,0,-1,-1,0,-1,-1,0,0};
+static const int yy_start_dfa[]={0};
+int yylex()
+{
+  for(;;)
+  {
+    if(yy_hold_active) { yy_buf[yy_hold_pos]=yy_hold; yy_hold_active=false; }
+    if(!yy_buf_valid) yy_fill();
+    if(yy_pos>=yy_len && yy_more_input()) continue;
+    if(yy_pos>=yy_len)
+    {
+      yy_buf_valid=false;
+      yytext=yy_buf.data()+yy_len; yyleng=0;
+      switch(yy_start_state)
+      {
+      default: break;
+      }
+      return YY_NULL;
+    }
+    int yy_state=yy_start_dfa[yy_start_state];
+    std::size_t yy_p=yy_pos, yy_end=0;
+    int yy_rule=-1;
+    for(;;)
+    {
+      while(yy_p<yy_len)
+      {
+        yy_state=yy_nxt[yy_state*20+yy_ec[(unsigned char)yy_buf[yy_p]]];
+        if(yy_state<0) break;
+        yy_p++;
+        if(yy_accept[yy_state]>=0) { yy_rule=yy_accept[yy_state]; yy_end=yy_p; }
+        if(yy_jam[yy_state]) break;
+      }
+      if(yy_p<yy_len || yy_state<0 || yy_jam[yy_state]) break;
+      std::size_t yy_off=yy_pos;
+      if(!yy_more_input()) break;
+      yy_p-=yy_off; if(yy_end!=0) yy_end-=yy_off;
+    }
+    if(yy_rule<0) { yy_rule=7; yy_end=yy_pos+1; }
+    yytext=yy_buf.data()+yy_pos;
+    yyleng=(int)(yy_end-yy_pos);
+    yy_hold_pos=yy_end; yy_hold=yy_buf[yy_end]; yy_buf[yy_end]=0;
+    yy_hold_active=true;
+    yy_pos=yy_end;
+    YY_USER_ACTION
+    switch(yy_rule)
+    {
+    case 0:
+{ return TOK_STRING; }
+    break;
+    case 1:
+{ return TOK_NUMBER; }
+    break;
+    case 2:
+{ return TOK_TRUE; }
+    break;
+    case 3:
+{ return TOK_FALSE; }
+    break;
+    case 4:
+{ return TOK_NULL; }
+    break;
+    case 5:
+{ /* eat */ }
+    break;
+    case 6:
+{ return yytext[0]; }
+    break;
+    default:
+      ECHO;
+      break;
+    }
+  }
+}
+// suppress unused warnings
+static void yy_unused_helpers()
+{ (void)&yy_push_state; (void)&yy_pop_state; (void)&yy_top_state;
+  (void)&yyunput_impl; (void)&yy_unused_helpers; }
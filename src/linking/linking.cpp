@@ -1287,7 +1287,11 @@ void linkingt::copy_symbols()
       duplicate_non_type_symbol(old_symbol, new_symbol);
   }
 
-  // Apply type updates to initializers
+  // Apply type updates to initializers; this is a scan of the entire
+  // main symbol table, which we avoid when linking many files
+  if(object_type_updates.empty())
+    return;
+
   Forall_symbols(s_it, main_symbol_table.symbols)
   {
     if(!s_it->second.is_type &&
@@ -1307,13 +1311,21 @@ void linkingt::typecheck()
 
   id_sett needs_to_be_renamed;
 
-  forall_symbols(s_it, src_symbol_table.symbols)
+  Forall_symbols(s_it, src_symbol_table.symbols)
   {
     symbol_tablet::symbolst::const_iterator
       m_it=main_symbol_table.symbols.find(s_it->first);
 
-    if(m_it!=main_symbol_table.symbols.end() && // duplicate
-       needs_renaming(m_it->second, s_it->second))
+    if(m_it==main_symbol_table.symbols.end())
+      continue;
+
+    // Share identical types with the main symbol table, which makes
+    // any further comparison of them constant time. Types that are
+    // declared in a header are typically identical in all files.
+    if(s_it->second.type.full_eq(m_it->second.type))
+      s_it->second.type=m_it->second.type;
+
+    if(needs_renaming(m_it->second, s_it->second)) // duplicate
     {
       needs_to_be_renamed.insert(s_it->first);
       #ifdef DEBUG
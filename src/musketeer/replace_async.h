@@ -62,7 +62,8 @@ void replace_async(
 
             /* __CPROVER_ASYNC labels only evaluated at C parsing time; we
                reproduce here the effects of the evaluation of this label */
-            i_it->labels.push_front("__CPROVER_ASYNC_0");
+            i_it->labels.insert(
+              i_it->labels.begin(), "__CPROVER_ASYNC_0");
             i_it->clear(START_THREAD);
             /* CP_AC_0: f(); -> CP_AC_0: start_th; goto 2;
                1: f(); end_th; 2: ... */
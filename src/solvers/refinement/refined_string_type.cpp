@@ -33,6 +33,8 @@ refined_string_typet::refined_string_typet(
 /// \return Boolean telling whether the type is that of C strings
 bool refined_string_typet::is_c_string_type(const typet &type)
 {
+  if(type.id()==ID_symbol)
+    return to_symbol_type(type).get_identifier()=="tag-" CPROVER_PREFIX"string";
   return
     type.id()==ID_struct &&
     to_struct_type(type).get_tag()==CPROVER_PREFIX"string";
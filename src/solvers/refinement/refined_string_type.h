@@ -39,8 +39,7 @@ public:
 
   const typet &get_char_type() const
   {
-    assert(components().size()==2);
-    return components()[0].type();
+    return get_content_type().subtype();
   }
 
   const typet &get_index_type() const
@@ -81,7 +80,7 @@ public:
   }
 };
 
-const refined_string_typet &to_refined_string_type(const typet &type)
+inline const refined_string_typet &to_refined_string_type(const typet &type)
 {
   assert(type.id()==ID_struct);
   return static_cast<const refined_string_typet &>(type);
@@ -20,6 +20,8 @@ Author: Romain Brenguier, romain.brenguier@diffblue.com
 #ifndef CPROVER_SOLVERS_REFINEMENT_STRING_CONSTRAINT_GENERATOR_H
 #define CPROVER_SOLVERS_REFINEMENT_STRING_CONSTRAINT_GENERATOR_H
 
+#include <limits>
+
 #include <util/string_expr.h>
 #include <solvers/refinement/refined_string_type.h>
 #include <solvers/refinement/string_constraint.h>
@@ -32,9 +34,19 @@ public:
   // to the axiom list.
 
   string_constraint_generatort():
+    max_string_length(std::numeric_limits<std::size_t>::max()),
     mode(ID_unknown)
   { }
 
+  // Strings are assumed to be no longer than this, which allows the
+  // universally quantified axioms to be unrolled
+  std::size_t max_string_length;
+
+  bool is_length_bounded() const
+  {
+    return max_string_length!=std::numeric_limits<std::size_t>::max();
+  }
+
   void set_mode(irep_idt _mode)
   {
     // only C and java modes supported
@@ -72,6 +84,7 @@ public:
   symbol_exprt fresh_univ_index(const irep_idt &prefix, const typet &type);
   symbol_exprt fresh_boolean(const irep_idt &prefix);
   string_exprt fresh_string(const refined_string_typet &type);
+  static refined_string_typet get_refined_string_type(const typet &type);
 
   // We maintain a map from symbols to strings.
   std::map<irep_idt, string_exprt> symbol_to_string;
@@ -71,7 +71,7 @@ string_exprt string_constraint_generatort::add_axioms_for_concat(
 string_exprt string_constraint_generatort::add_axioms_for_concat_int(
   const function_application_exprt &f)
 {
-  const refined_string_typet &ref_type=to_refined_string_type(f.type());
+  refined_string_typet ref_type=get_refined_string_type(f.type());
   string_exprt s1=add_axioms_for_string_expr(args(f, 2)[0]);
   string_exprt s2=add_axioms_from_int(
     args(f, 2)[1], MAX_INTEGER_LENGTH, ref_type);
@@ -85,7 +85,7 @@ string_exprt string_constraint_generatort::add_axioms_for_concat_int(
 string_exprt string_constraint_generatort::add_axioms_for_concat_long(
   const function_application_exprt &f)
 {
-  const refined_string_typet &ref_type=to_refined_string_type(f.type());
+  refined_string_typet ref_type=get_refined_string_type(f.type());
   string_exprt s1=add_axioms_for_string_expr(args(f, 2)[0]);
   string_exprt s2=add_axioms_from_int(args(f, 2)[1], MAX_LONG_LENGTH, ref_type);
   return add_axioms_for_concat(s1, s2);
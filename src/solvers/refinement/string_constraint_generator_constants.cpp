@@ -70,7 +70,7 @@ string_exprt string_constraint_generatort::add_axioms_for_empty_string(
   const function_application_exprt &f)
 {
   assert(f.arguments().empty());
-  const refined_string_typet &ref_type=to_refined_string_type(f.type());
+  refined_string_typet ref_type=get_refined_string_type(f.type());
   string_exprt res=fresh_string(ref_type);
   axioms.push_back(res.axiom_for_has_length(0));
   return res;
@@ -109,6 +109,6 @@ string_exprt string_constraint_generatort::add_axioms_from_literal(
     sval=extract_java_string(to_symbol_expr(s));
   }
 
-  const refined_string_typet &ref_type=to_refined_string_type(f.type());
+  refined_string_typet ref_type=get_refined_string_type(f.type());
   return add_axioms_for_constant(sval, ref_type);
 }
@@ -46,7 +46,7 @@ string_exprt string_constraint_generatort::add_axioms_for_insert(
 string_exprt string_constraint_generatort::add_axioms_for_insert_int(
   const function_application_exprt &f)
 {
-  const refined_string_typet &ref_type=to_refined_string_type(f.type());
+  refined_string_typet ref_type=get_refined_string_type(f.type());
   string_exprt s1=add_axioms_for_string_expr(args(f, 3)[0]);
   string_exprt s2=add_axioms_from_int(
     args(f, 3)[2], MAX_INTEGER_LENGTH, ref_type);
@@ -61,7 +61,7 @@ string_exprt string_constraint_generatort::add_axioms_for_insert_int(
 string_exprt string_constraint_generatort::add_axioms_for_insert_long(
   const function_application_exprt &f)
 {
-  const refined_string_typet &ref_type=to_refined_string_type(f.type());
+  refined_string_typet ref_type=get_refined_string_type(f.type());
   string_exprt s1=add_axioms_for_string_expr(args(f, 3)[0]);
   string_exprt s2=add_axioms_from_int(args(f, 3)[2], MAX_LONG_LENGTH, ref_type);
   return add_axioms_for_insert(s1, s2, args(f, 3)[1]);
@@ -75,7 +75,7 @@ string_exprt string_constraint_generatort::add_axioms_for_insert_long(
 string_exprt string_constraint_generatort::add_axioms_for_insert_bool(
   const function_application_exprt &f)
 {
-  const refined_string_typet &ref_type=to_refined_string_type(f.type());
+  refined_string_typet ref_type=get_refined_string_type(f.type());
   string_exprt s1=add_axioms_for_string_expr(args(f, 3)[0]);
   string_exprt s2=add_axioms_from_bool(args(f, 3)[2], ref_type);
   return add_axioms_for_insert(s1, s2, args(f, 3)[1]);
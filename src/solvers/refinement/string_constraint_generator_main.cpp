@@ -22,7 +22,10 @@ Author: Romain Brenguier, romain.brenguier@diffblue.com
 #include <ansi-c/string_constant.h>
 #include <java_bytecode/java_types.h>
 #include <util/arith_tools.h>
+#include <util/c_types.h>
+#include <util/cprover_prefix.h>
 #include <util/pointer_predicates.h>
+#include <util/prefix.h>
 #include <util/ssa_expr.h>
 
 unsigned string_constraint_generatort::next_symbol_id=1;
@@ -92,9 +95,27 @@ string_exprt string_constraint_generatort::fresh_string(
   symbol_exprt length=
     fresh_symbol("string_length", type.get_index_type());
   symbol_exprt content=fresh_symbol("string_content", type.get_content_type());
+
+  if(is_length_bounded())
+    axioms.push_back(
+      binary_relation_exprt(
+        length, ID_le, from_integer(max_string_length, length.type())));
+
   return string_exprt(length, content, type);
 }
 
+/// C programs use the type `__CPROVER_string` of cprover-string-hack.h, whose
+/// characters are `__CPROVER_char`, i.e., unsigned char
+/// \par parameters: a string type, which may be refined already
+/// \return the corresponding refined string type
+refined_string_typet string_constraint_generatort::get_refined_string_type(
+  const typet &type)
+{
+  if(refined_string_typet::is_c_string_type(type))
+    return refined_string_typet(signed_int_type(), unsigned_char_type());
+  return to_refined_string_type(type);
+}
+
 /// obtain a refined string expression corresponding to string variable of
 /// string function call
 /// \par parameters: an expression of type string
@@ -183,7 +204,7 @@ string_exprt string_constraint_generatort::find_or_add_string_of_symbol(
   const symbol_exprt &sym)
 {
   irep_idt id=sym.get_identifier();
-  const refined_string_typet &ref_type=to_refined_string_type(sym.type());
+  refined_string_typet ref_type=get_refined_string_type(sym.type());
   string_exprt str=fresh_string(ref_type);
   auto entry=symbol_to_string.insert(std::make_pair(id, str));
   return entry.first->second;
@@ -200,9 +221,15 @@ exprt string_constraint_generatort::add_axioms_for_function_application(
   const exprt &name=expr.function();
   assert(name.id()==ID_symbol);
 
-  const irep_idt &id=is_ssa_expr(name)?to_ssa_expr(name).get_object_name():
+  irep_idt id=is_ssa_expr(name)?to_ssa_expr(name).get_object_name():
     to_symbol_expr(name).get_identifier();
 
+  // C programs call the functions declared in cprover-string-hack.h, e.g.,
+  // __CPROVER_uninterpreted_string_length_func for cprover_string_length_func
+  const std::string c_prefix=CPROVER_PREFIX "uninterpreted_";
+  if(has_prefix(id2string(id), c_prefix))
+    id="cprover_"+id2string(id).substr(c_prefix.size());
+
   // TODO: improve efficiency of this test by either ordering test by frequency
   // or using a map
 
@@ -21,7 +21,7 @@ Author: Romain Brenguier, romain.brenguier@diffblue.com
 string_exprt string_constraint_generatort::add_axioms_from_int(
   const function_application_exprt &expr)
 {
-  const refined_string_typet &ref_type=to_refined_string_type(expr.type());
+  refined_string_typet ref_type=get_refined_string_type(expr.type());
   return add_axioms_from_int(args(expr, 1)[0], MAX_INTEGER_LENGTH, ref_type);
 }
 
@@ -31,7 +31,7 @@ string_exprt string_constraint_generatort::add_axioms_from_int(
 string_exprt string_constraint_generatort::add_axioms_from_long(
   const function_application_exprt &expr)
 {
-  const refined_string_typet &ref_type=to_refined_string_type(expr.type());
+  refined_string_typet ref_type=get_refined_string_type(expr.type());
   return add_axioms_from_int(args(expr, 1)[0], MAX_LONG_LENGTH, ref_type);
 }
 
@@ -62,7 +62,7 @@ string_exprt string_constraint_generatort::add_axioms_from_double(
 string_exprt string_constraint_generatort::add_axioms_from_float(
   const exprt &f, bool double_precision)
 {
-  const refined_string_typet &ref_type=to_refined_string_type(f.type());
+  refined_string_typet ref_type=get_refined_string_type(f.type());
   const typet &index_type=ref_type.get_index_type();
   const typet &char_type=ref_type.get_char_type();
   string_exprt res=fresh_string(ref_type);
@@ -157,7 +157,7 @@ string_exprt string_constraint_generatort::add_axioms_from_float(
 string_exprt string_constraint_generatort::add_axioms_from_bool(
   const function_application_exprt &f)
 {
-  const refined_string_typet &ref_type=to_refined_string_type(f.type());
+  refined_string_typet ref_type=get_refined_string_type(f.type());
   return add_axioms_from_bool(args(f, 1)[0], ref_type);
 }
 
@@ -403,7 +403,7 @@ string_exprt string_constraint_generatort::add_axioms_from_int_hex(
 string_exprt string_constraint_generatort::add_axioms_from_int_hex(
   const function_application_exprt &f)
 {
-  const refined_string_typet &ref_type=to_refined_string_type(f.type());
+  refined_string_typet ref_type=get_refined_string_type(f.type());
   return add_axioms_from_int_hex(args(f, 1)[0], ref_type);
 }
 
@@ -413,7 +413,7 @@ string_exprt string_constraint_generatort::add_axioms_from_int_hex(
 string_exprt string_constraint_generatort::add_axioms_from_char(
   const function_application_exprt &f)
 {
-  const refined_string_typet &ref_type=to_refined_string_type(f.type());
+  refined_string_typet ref_type=get_refined_string_type(f.type());
   return add_axioms_from_char(args(f, 1)[0], ref_type);
 }
 
@@ -440,7 +440,7 @@ string_exprt string_constraint_generatort::add_axioms_for_value_of(
   const function_application_exprt::argumentst &args=f.arguments();
   if(args.size()==3)
   {
-    const refined_string_typet &ref_type=to_refined_string_type(f.type());
+    refined_string_typet ref_type=get_refined_string_type(f.type());
     string_exprt res=fresh_string(ref_type);
     exprt char_array=args[0];
     exprt offset=args[1];
@@ -23,6 +23,7 @@ Author: Alberto Griggio, alberto.griggio@gmail.com
 #include <ansi-c/string_constant.h>
 #include <util/cprover_prefix.h>
 #include <util/replace_expr.h>
+#include <util/time_stopping.h>
 #include <solvers/sat/satcheck.h>
 #include <langapi/language_util.h>
 
@@ -58,7 +59,9 @@ void string_refinementt::display_index_set()
 }
 
 /// compute the index set for all formulas, instantiate the formulas with the
-/// found indexes, and add them as lemmas.
+/// found indexes, and add them as lemmas. Only the indices that are new,
+/// i.e., those in the current index set, are used, as the others have been
+/// used by earlier calls already.
 void string_refinementt::add_instantiations()
 {
   debug() << "string_constraint_generatort::add_instantiations: "
@@ -72,13 +75,16 @@ void string_refinementt::add_instantiations()
       debug() << from_expr(j) << "; ";
     debug() << "}"  << eom;
 
+    const axiom_indicest &axioms=get_axioms_of_array(s);
+
     for(const auto &j : i.second)
     {
       const exprt &val=j;
 
-      for(const auto &ua : universal_axioms)
+      for(const auto &axiom : axioms)
       {
-        exprt lemma=instantiate(ua, s, val);
+        exprt lemma=instantiate(
+          universal_axioms[axiom.first], axiom.second, val);
         add_lemma(lemma);
       }
     }
@@ -208,6 +214,9 @@ decision_proceduret::resultt string_refinementt::dec_solve()
     {
       string_constraintt c=to_string_constraint(axiom);
       universal_axioms.push_back(c);
+
+      if(generator.is_length_bounded())
+        unroll(c);
     }
     else if(axiom.id()==ID_string_not_contains_constraint)
     {
@@ -219,6 +228,8 @@ decision_proceduret::resultt string_refinementt::dec_solve()
       generator.witness[nc_axiom]=
         generator.fresh_symbol("not_contains_witness", witness_type);
       not_contains_axioms.push_back(nc_axiom);
+      not_contains_instantiated.push_back(
+        std::pair<expr_sett, expr_sett>());
     }
     else
     {
@@ -230,13 +241,23 @@ decision_proceduret::resultt string_refinementt::dec_solve()
   cur.clear();
   add_instantiations();
 
+  unsigned iteration=0;
+
   while((initial_loop_bound--)>0)
   {
+    iteration++;
+    absolute_timet solver_start=current_time();
+
     decision_proceduret::resultt res=supert::dec_solve();
 
+    absolute_timet solver_stop=current_time();
+    statistics() << "string refinement iteration " << iteration
+                 << ": solver time " << (solver_stop-solver_start) << "s, "
+                 << seen_instances.size() << " lemmas" << eom;
+
     switch(res)
     {
-    case D_SATISFIABLE:
+    case resultt::D_SATISFIABLE:
       if(!check_axioms())
       {
         debug() << "check_SAT: got SAT but the model is not correct" << eom;
@@ -244,7 +265,7 @@ decision_proceduret::resultt string_refinementt::dec_solve()
       else
       {
         debug() << "check_SAT: the model is correct" << eom;
-        return D_SATISFIABLE;
+        return resultt::D_SATISFIABLE;
       }
 
       debug() <<  "refining..." << eom;
@@ -252,15 +273,31 @@ decision_proceduret::resultt string_refinementt::dec_solve()
       // the property we are checking by adding more indices to the index set,
       // and instantiating universal formulas with this indices.
       // We will then relaunch the solver with these added lemmas.
-      current_index_set.clear();
-      update_index_set(cur);
-      cur.clear();
-      add_instantiations();
+      {
+        absolute_timet refine_start=current_time();
+        std::size_t lemmas_before=seen_instances.size();
+
+        current_index_set.clear();
+        update_index_set(cur);
+        cur.clear();
+        add_instantiations();
+
+        std::size_t new_indices=0;
+        for(const auto &i : current_index_set)
+          new_indices+=i.second.size();
+
+        absolute_timet refine_stop=current_time();
+        statistics() << "string refinement iteration " << iteration
+                     << ": " << new_indices << " new indices, "
+                     << seen_instances.size()-lemmas_before
+                     << " new instances in "
+                     << (refine_stop-refine_start) << "s" << eom;
+      }
 
       if(current_index_set.empty())
       {
         debug() << "current index set is empty" << eom;
-        return D_SATISFIABLE;
+        return resultt::D_SATISFIABLE;
       }
 
       display_index_set();
@@ -269,7 +306,8 @@ decision_proceduret::resultt string_refinementt::dec_solve()
       {
         debug()<< "constraint " << i << eom;
         std::list<exprt> lemmas;
-        instantiate_not_contains(not_contains_axioms[i], lemmas);
+        instantiate_not_contains(
+          not_contains_axioms[i], not_contains_instantiated[i], lemmas);
         for(const exprt &lemma : lemmas)
           add_lemma(lemma);
       }
@@ -280,7 +318,31 @@ decision_proceduret::resultt string_refinementt::dec_solve()
   }
   debug() << "string_refinementt::dec_solve reached the maximum number"
            << "of steps allowed" << eom;
-  return D_ERROR;
+  return resultt::D_ERROR;
+}
+
+/// adds the instances of a universal axiom for all values of the quantified
+/// variable below the maximal string length. The axiom is kept for
+/// check_axioms, which finds the rare violations by values of the
+/// quantified variable beyond the bound, so that in most cases the
+/// refinement loop ends after the first call to the solver.
+/// \par parameters: a universal axiom
+void string_refinementt::unroll(const string_constraintt &axiom)
+{
+  const typet &index_type=axiom.univ_var().type();
+
+  for(std::size_t k=0; k<generator.max_string_length; k++)
+  {
+    const exprt val=from_integer(k, index_type);
+
+    exprt instance=implies_exprt(
+      and_exprt(axiom.univ_within_bounds(), axiom.premise()),
+      axiom.body());
+    replace_expr(axiom.univ_var(), val, instance);
+
+    // the constant indices are instantiated already
+    add_lemma(instance, false);
+  }
 }
 
 /// fills as many 0 as necessary in the bit vectors to have the right width
@@ -457,13 +519,13 @@ bool string_refinementt::check_axioms()
 
     switch(solver())
     {
-    case decision_proceduret::D_SATISFIABLE:
+    case decision_proceduret::resultt::D_SATISFIABLE:
       {
         exprt val=solver.get(axiom.univ_var());
         violated[i]=val;
       }
       break;
-    case decision_proceduret::D_UNSATISFIABLE:
+    case decision_proceduret::resultt::D_UNSATISFIABLE:
       break;
     default:
       throw "failure in checking axiom";
@@ -830,22 +892,39 @@ exprt find_index(const exprt &expr, const exprt &str)
 }
 
 
-/// \par parameters: an universaly quantified formula `axiom`, an array of char
-/// variable `str`, and an index expression `val`.
+/// \par parameters: a char array `str`
+/// \return the universal axioms in which `str` is accessed at an index that
+///   depends on the quantified variable, with that index
+const string_refinementt::axiom_indicest &
+string_refinementt::get_axioms_of_array(const exprt &str)
+{
+  auto entry=axioms_of_array.insert(std::make_pair(str, axiom_indicest()));
+
+  if(entry.second)
+  {
+    for(std::size_t i=0; i<universal_axioms.size(); i++)
+    {
+      const string_constraintt &axiom=universal_axioms[i];
+      exprt idx=find_index(axiom.body(), str);
+      if(idx.is_not_nil() && find_qvar(idx, axiom.univ_var()))
+        entry.first->second.push_back(std::make_pair(i, idx));
+    }
+  }
+
+  return entry.first->second;
+}
+
+/// \par parameters: an universaly quantified formula `axiom`, the index `idx`
+/// at which it accesses some array of char `str`, and an index expression
+/// `val`.
 /// \return substitute `qvar` the universaly quantified variable of `axiom`, by
 ///   an index `val`, in `axiom`, so that the index used for `str` equals `val`.
 ///   For instance, if `axiom` corresponds to $\forall q. s[q+x]='a' &&
-///   t[q]='b'$, `instantiate(axom,s,v)` would return an expression for
+///   t[q]='b'$, `instantiate(axom,q+x,v)` would return an expression for
 ///   $s[v]='a' && t[v-x]='b'$.
 exprt string_refinementt::instantiate(
-  const string_constraintt &axiom, const exprt &str, const exprt &val)
+  const string_constraintt &axiom, const exprt &idx, const exprt &val)
 {
-  exprt idx=find_index(axiom.body(), str);
-  if(idx.is_nil())
-    return true_exprt();
-  if(!find_qvar(idx, axiom.univ_var()))
-    return true_exprt();
-
   exprt r=compute_inverse_function(axiom.univ_var(), val, idx);
   implies_exprt instance(axiom.premise(), axiom.body());
   replace_expr(axiom.univ_var(), r, instance);
@@ -860,52 +939,73 @@ exprt string_refinementt::instantiate(
 
 
 void string_refinementt::instantiate_not_contains(
-  const string_not_contains_constraintt &axiom, std::list<exprt> &new_lemmas)
+  const string_not_contains_constraintt &axiom,
+  std::pair<expr_sett, expr_sett> &instantiated,
+  std::list<exprt> &new_lemmas)
 {
   exprt s0=axiom.s0();
   exprt s1=axiom.s1();
 
   debug() << "instantiate not contains " << from_expr(s0) << " : "
           << from_expr(s1) << eom;
-  expr_sett index_set0=index_set[to_string_expr(s0).content()];
-  expr_sett index_set1=index_set[to_string_expr(s1).content()];
+  const expr_sett &index_set0=index_set[to_string_expr(s0).content()];
+  const expr_sett &index_set1=index_set[to_string_expr(s1).content()];
 
-  for(auto it0 : index_set0)
-    for(auto it1 : index_set1)
-    {
-      debug() << from_expr(it0) << " : " << from_expr(it1) << eom;
-      exprt val=minus_exprt(it0, it1);
-      exprt witness=generator.get_witness_of(axiom, val);
-      and_exprt prem_and_is_witness(
-        axiom.premise(),
-        equal_exprt(witness, it1));
-
-      not_exprt differ(
-        equal_exprt(
-          to_string_expr(s0)[it0],
-          to_string_expr(s1)[it1]));
-      exprt lemma=implies_exprt(prem_and_is_witness, differ);
-
-      new_lemmas.push_back(lemma);
-      // we put bounds on the witnesses:
-      // 0 <= v <= |s0| - |s1| ==> 0 <= v+w[v] < |s0| && 0 <= w[v] < |s1|
-      exprt zero=from_integer(0, val.type());
-      binary_relation_exprt c1(zero, ID_le, plus_exprt(val, witness));
-      binary_relation_exprt c2
-        (to_string_expr(s0).length(), ID_gt, plus_exprt(val, witness));
-      binary_relation_exprt c3(to_string_expr(s1).length(), ID_gt, witness);
-      binary_relation_exprt c4(zero, ID_le, witness);
-
-      minus_exprt diff(
-        to_string_expr(s0).length(),
-        to_string_expr(s1).length());
-
-      and_exprt premise(
-        binary_relation_exprt(zero, ID_le, val),
-        binary_relation_exprt(diff, ID_ge, val));
-      exprt witness_bounds=implies_exprt(
-        premise,
-        and_exprt(and_exprt(c1, c2), and_exprt(c3, c4)));
-      new_lemmas.push_back(witness_bounds);
-    }
+  // The pairs of indices that have been used already are those in
+  // done0 x done1. We add the new indices of s0 to done0 first, which
+  // leaves the pairs with a new index of s1 to the second step.
+  expr_sett &done0=instantiated.first;
+  expr_sett &done1=instantiated.second;
+
+  std::vector<std::pair<exprt, exprt> > pairs;
+
+  for(const auto &it0 : index_set0)
+    if(done0.insert(it0).second)
+      for(const auto &it1 : done1)
+        pairs.push_back(std::make_pair(it0, it1));
+
+  for(const auto &it1 : index_set1)
+    if(done1.insert(it1).second)
+      for(const auto &it0 : done0)
+        pairs.push_back(std::make_pair(it0, it1));
+
+  for(const auto &p : pairs)
+  {
+    const exprt &it0=p.first;
+    const exprt &it1=p.second;
+    debug() << from_expr(it0) << " : " << from_expr(it1) << eom;
+    exprt val=minus_exprt(it0, it1);
+    exprt witness=generator.get_witness_of(axiom, val);
+    and_exprt prem_and_is_witness(
+      axiom.premise(),
+      equal_exprt(witness, it1));
+
+    not_exprt differ(
+      equal_exprt(
+        to_string_expr(s0)[it0],
+        to_string_expr(s1)[it1]));
+    exprt lemma=implies_exprt(prem_and_is_witness, differ);
+
+    new_lemmas.push_back(lemma);
+    // we put bounds on the witnesses:
+    // 0 <= v <= |s0| - |s1| ==> 0 <= v+w[v] < |s0| && 0 <= w[v] < |s1|
+    exprt zero=from_integer(0, val.type());
+    binary_relation_exprt c1(zero, ID_le, plus_exprt(val, witness));
+    binary_relation_exprt c2
+      (to_string_expr(s0).length(), ID_gt, plus_exprt(val, witness));
+    binary_relation_exprt c3(to_string_expr(s1).length(), ID_gt, witness);
+    binary_relation_exprt c4(zero, ID_le, witness);
+
+    minus_exprt diff(
+      to_string_expr(s0).length(),
+      to_string_expr(s1).length());
+
+    and_exprt premise(
+      binary_relation_exprt(zero, ID_le, val),
+      binary_relation_exprt(diff, ID_ge, val));
+    exprt witness_bounds=implies_exprt(
+      premise,
+      and_exprt(and_exprt(c1, c2), and_exprt(c3, c4)));
+    new_lemmas.push_back(witness_bounds);
+  }
 }
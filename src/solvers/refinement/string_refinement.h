@@ -20,6 +20,9 @@ Author: Alberto Griggio, alberto.griggio@gmail.com
 #ifndef CPROVER_SOLVERS_REFINEMENT_STRING_REFINEMENT_H
 #define CPROVER_SOLVERS_REFINEMENT_STRING_REFINEMENT_H
 
+#include <unordered_map>
+#include <unordered_set>
+
 #include <util/string_expr.h>
 #include <solvers/refinement/string_constraint.h>
 #include <solvers/refinement/string_constraint_generator.h>
@@ -40,6 +43,12 @@ public:
 
   void set_mode();
 
+  // Strings are assumed to be at most this long
+  void set_max_string_length(std::size_t n)
+  {
+    generator.max_string_length=n;
+  }
+
   // Should we use counter examples at each iteration?
   bool use_counter_example;
 
@@ -51,7 +60,7 @@ public:
   static exprt is_positive(const exprt &x);
 
 protected:
-  typedef std::set<exprt> expr_sett;
+  typedef std::unordered_set<exprt, irep_hash> expr_sett;
 
   virtual bvt convert_symbol(const exprt &expr);
   virtual bvt convert_function_application(
@@ -76,13 +85,25 @@ private:
 
   std::vector<string_not_contains_constraintt> not_contains_axioms;
 
+  // the indices of the two strings of each not_contains axiom that
+  // it has been instantiated with
+  std::vector<std::pair<expr_sett, expr_sett> > not_contains_instantiated;
+
   // Unquantified lemmas that have newly been added
   std::vector<exprt> cur;
 
   // See the definition in the PASS article
   // Warning: this is indexed by array_expressions and not string expressions
-  std::map<exprt, expr_sett> current_index_set;
-  std::map<exprt, expr_sett> index_set;
+  typedef std::unordered_map<exprt, expr_sett, irep_hash> index_set_mapt;
+  index_set_mapt current_index_set;
+  index_set_mapt index_set;
+
+  // For each array, the universal axioms that access it with an index
+  // that depends on the quantified variable, and that index. This
+  // does not change, and is computed when the array is first seen.
+  typedef std::vector<std::pair<std::size_t, exprt> > axiom_indicest;
+  std::unordered_map<exprt, axiom_indicest, irep_hash> axioms_of_array;
+  const axiom_indicest &get_axioms_of_array(const exprt &str);
 
   void display_index_set();
 
@@ -101,11 +122,14 @@ private:
   void initial_index_set(const string_constraintt &axiom);
   void initial_index_set(const std::vector<string_constraintt> &string_axioms);
 
+  void unroll(const string_constraintt &axiom);
+
   exprt instantiate(
-    const string_constraintt &axiom, const exprt &str, const exprt &val);
+    const string_constraintt &axiom, const exprt &idx, const exprt &val);
 
   void instantiate_not_contains(
     const string_not_contains_constraintt &axiom,
+    std::pair<expr_sett, expr_sett> &instantiated,
     std::list<exprt> &new_lemmas);
 
   exprt compute_inverse_function(
@@ -16,11 +16,13 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/arith_tools.h>
 #include <util/base_type.h>
 #include <util/c_types.h>
+#include <util/cprover_prefix.h>
 #include <util/expr_util.h>
 #include <util/fixedbv.h>
 #include <util/ieee_float.h>
 #include <util/invariant.h>
 #include <util/pointer_offset_size.h>
+#include <util/prefix.h>
 #include <util/std_types.h>
 #include <util/std_expr.h>
 #include <util/string2int.h>
@@ -429,7 +431,11 @@ exprt smt2_convt::parse_rec(const irept &src, const typet &_type)
 {
   const typet &type=ns.follow(_type);
 
-  if(type.id()==ID_signedbv ||
+  if(is_string_type(type))
+  {
+    return constant_exprt(src.id(), _type);
+  }
+  else if(type.id()==ID_signedbv ||
      type.id()==ID_unsignedbv ||
      type.id()==ID_bv ||
      type.id()==ID_fixedbv ||
@@ -1782,6 +1788,10 @@ void smt2_convt::convert_expr(const exprt &expr)
     convert_expr(let_expr.where());
     out << ')'; // let
   }
+  else if(expr.id()==ID_function_application && use_string_theory)
+  {
+    convert_string_function(to_function_application_expr(expr));
+  }
   else if(expr.id()==ID_constraint_select_one)
   {
     UNEXPECTEDCASE(
@@ -2685,6 +2695,10 @@ void smt2_convt::convert_constant(const constant_exprt &expr)
   {
     out << expr.get_value();
   }
+  else if(expr_type.id()==ID_string && use_string_theory)
+  {
+    convert_string_literal(id2string(expr.get_value()));
+  }
   else
     UNEXPECTEDCASE("unknown constant: "+expr_type.id_string());
 }
@@ -3741,6 +3755,227 @@ void smt2_convt::convert_member(const member_exprt &expr)
       "convert_member on an unexpected type "+struct_op_type.id_string());
 }
 
+/// Characters outside of printable ASCII are written as escape sequences,
+/// which are understood by both Z3 and CVC4.
+void smt2_convt::convert_string_literal(const std::string &s)
+{
+  out << '"';
+
+  for(const auto ch : s)
+  {
+    const unsigned char c=static_cast<unsigned char>(ch);
+
+    if(c=='"')
+      out << "\"\"";
+    else if(c=='\\' || c<' ' || c>'~')
+    {
+      const char *hex="0123456789abcdef";
+      out << "\\x" << hex[c>>4] << hex[c&15];
+    }
+    else
+      out << c;
+  }
+
+  out << '"';
+}
+
+/// \return true if values of the given type are passed to the solver
+///   using the String sort, which is the case for the string type and for
+///   the struct type that stands for strings in C programs
+bool smt2_convt::is_string_type(const typet &type) const
+{
+  if(!use_string_theory)
+    return false;
+
+  const typet &followed=ns.follow(type);
+
+  return
+    followed.id()==ID_string ||
+    (followed.id()==ID_struct &&
+     to_struct_type(followed).get_tag()==CPROVER_PREFIX "string");
+}
+
+/// \return the string constant that a `char *` argument points to
+static const exprt &string_literal_argument(const exprt &arg)
+{
+  if(arg.id()==ID_typecast ||
+     arg.id()==ID_address_of ||
+     (arg.id()==ID_index && arg.operands().size()==2))
+    return string_literal_argument(arg.op0());
+
+  return arg;
+}
+
+/// The string primitives of the string solver, applied to operands of
+/// string type, are mapped to the operators of the theory of strings.
+/// The C front-end declares them as uninterpreted functions, e.g.,
+/// `__CPROVER_uninterpreted_string_length_func`, which are treated like the
+/// primitives of the same name. Lengths and indices are bit-vectors, and
+/// are converted from and to the Int sort used by the theory, and the
+/// results of predicates are converted to bit-vectors where required.
+void smt2_convt::convert_string_function(
+  const function_application_exprt &expr)
+{
+  const exprt &function=expr.function();
+  const function_application_exprt::argumentst &args=expr.arguments();
+
+  if(function.id()!=ID_symbol)
+    UNEXPECTEDCASE("function application of `"+function.id_string()+"'");
+
+  irep_idt id=to_symbol_expr(function).get_identifier();
+
+  const std::string uninterpreted_prefix=CPROVER_PREFIX "uninterpreted_";
+
+  if(has_prefix(id2string(id), uninterpreted_prefix))
+    id="cprover_"+id2string(id).substr(uninterpreted_prefix.size());
+
+  const auto to_int=[this](const exprt &op)
+  {
+    if(op.type().id()==ID_signedbv || op.type().id()==ID_unsignedbv)
+    {
+      out << "(bv2nat ";
+      convert_expr(op);
+      out << ')';
+    }
+    else
+      convert_expr(op);
+  };
+
+  const bool int_result=
+    id==ID_cprover_string_length_func ||
+    id==ID_cprover_string_index_of_func;
+
+  const bool bool_result=
+    id==ID_cprover_string_equal_func ||
+    id==ID_cprover_string_is_empty_func ||
+    id==ID_cprover_string_contains_func ||
+    id==ID_cprover_string_is_prefix_func ||
+    id==ID_cprover_string_startswith_func ||
+    id==ID_cprover_string_is_suffix_func ||
+    id==ID_cprover_string_endswith_func;
+
+  // Int results are converted to the bit-vector type of the expression,
+  // and so are Bool results unless the expression has type bool
+  const std::size_t width=
+    (int_result || (bool_result && expr.type().id()!=ID_bool))?
+    boolbv_width(expr.type()):0;
+
+  if(int_result)
+    out << "((_ int2bv " << width << ") ";
+  else if(width!=0)
+    out << "(ite ";
+
+  if(id==ID_cprover_string_length_func && args.size()==1)
+  {
+    out << "(str.len ";
+    convert_expr(args[0]);
+    out << ')';
+  }
+  else if(id==ID_cprover_string_equal_func && args.size()==2)
+  {
+    out << "(= ";
+    convert_expr(args[0]);
+    out << ' ';
+    convert_expr(args[1]);
+    out << ')';
+  }
+  else if(id==ID_cprover_string_is_empty_func && args.size()==1)
+  {
+    out << "(= (str.len ";
+    convert_expr(args[0]);
+    out << ") 0)";
+  }
+  else if(id==ID_cprover_string_literal_func && args.size()==1 &&
+          string_literal_argument(args[0]).id()==ID_string_constant)
+  {
+    convert_string_literal(
+      id2string(to_string_constant(string_literal_argument(args[0])).
+        get_value()));
+  }
+  else if(id==ID_cprover_string_concat_func && args.size()==2)
+  {
+    out << "(str.++ ";
+    convert_expr(args[0]);
+    out << ' ';
+    convert_expr(args[1]);
+    out << ')';
+  }
+  else if(id==ID_cprover_string_contains_func && args.size()==2)
+  {
+    out << "(str.contains ";
+    convert_expr(args[0]);
+    out << ' ';
+    convert_expr(args[1]);
+    out << ')';
+  }
+  else if((id==ID_cprover_string_is_prefix_func ||
+           id==ID_cprover_string_startswith_func) && args.size()==2)
+  {
+    // is_prefix takes the prefix first, startswith the string
+    const bool swap=id==ID_cprover_string_startswith_func;
+    out << "(str.prefixof ";
+    convert_expr(args[swap?1:0]);
+    out << ' ';
+    convert_expr(args[swap?0:1]);
+    out << ')';
+  }
+  else if((id==ID_cprover_string_is_suffix_func ||
+           id==ID_cprover_string_endswith_func) && args.size()==2)
+  {
+    const bool swap=id==ID_cprover_string_endswith_func;
+    out << "(str.suffixof ";
+    convert_expr(args[swap?1:0]);
+    out << ' ';
+    convert_expr(args[swap?0:1]);
+    out << ')';
+  }
+  else if(id==ID_cprover_string_index_of_func &&
+          (args.size()==2 || args.size()==3) &&
+          is_string_type(args[1].type()))
+  {
+    out << "(str.indexof ";
+    convert_expr(args[0]);
+    out << ' ';
+    convert_expr(args[1]);
+    out << ' ';
+    if(args.size()==3)
+      to_int(args[2]);
+    else
+      out << '0';
+    out << ')';
+  }
+  else if(id==ID_cprover_string_substring_func &&
+          (args.size()==2 || args.size()==3))
+  {
+    // substring takes the start and end index, str.substr the length
+    out << "(str.substr ";
+    convert_expr(args[0]);
+    out << ' ';
+    to_int(args[1]);
+    out << " (- ";
+    if(args.size()==3)
+      to_int(args[2]);
+    else
+    {
+      out << "(str.len ";
+      convert_expr(args[0]);
+      out << ')';
+    }
+    out << ' ';
+    to_int(args[1]);
+    out << "))";
+  }
+  else
+    UNEXPECTEDCASE(
+      "string function `"+id2string(id)+"' is not supported by the "
+      "theory of strings");
+
+  if(int_result)
+    out << ')';
+  else if(width!=0)
+    out << " (_ bv1 " << width << ") (_ bv0 " << width << "))";
+}
+
 void smt2_convt::flatten2bv(const exprt &expr)
 {
   const typet &type=ns.follow(expr.type());
@@ -4262,7 +4497,9 @@ bool smt2_convt::use_array_theory(const exprt &expr)
 
 void smt2_convt::convert_type(const typet &type)
 {
-  if(type.id()==ID_array)
+  if(is_string_type(type))
+    out << "String";
+  else if(type.id()==ID_array)
   {
     const array_typet &array_type=to_array_type(type);
 
@@ -51,6 +51,7 @@ public:
     use_FPA_theory(false),
     use_datatypes(false),
     use_array_of_bool(false),
+    use_string_theory(false),
     emit_set_logic(true),
     out(_out),
     benchmark(_benchmark),
@@ -104,6 +105,9 @@ public:
   bool use_FPA_theory;
   bool use_datatypes;
   bool use_array_of_bool;
+  // strings and the string primitives are passed to the solver
+  // using the SMT-LIB theory of strings
+  bool use_string_theory;
   bool emit_set_logic;
 
   // overloading interfaces
@@ -159,6 +163,9 @@ protected:
   void convert_mod(const mod_exprt &expr);
   void convert_index(const index_exprt &expr);
   void convert_member(const member_exprt &expr);
+  bool is_string_type(const typet &) const;
+  void convert_string_literal(const std::string &);
+  void convert_string_function(const function_application_exprt &expr);
   void convert_overflow(const exprt &expr);
   void convert_with(const with_exprt &expr);
   void convert_update(const exprt &expr);
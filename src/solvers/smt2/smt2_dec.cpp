@@ -100,6 +100,7 @@ decision_proceduret::resultt smt2_dect::dec_solve()
     // The flags --bitblast=eager --bv-div-zero-const help but only
     // work for pure bit-vector formulas.
     command = "cvc4 -L smt2 "
+            + std::string(use_string_theory?"--strings-exp ":"")
             + smt2_temp_file.temp_out_filename
             + " > "
             + smt2_temp_file.temp_result_filename;
@@ -984,6 +984,15 @@ bool configt::set(const cmdlinet &cmdline)
   if(cmdline.isset("no-library"))
     ansi_c.lib=configt::ansi_ct::libt::LIB_NONE;
 
+  if(cmdline.isset("cprover-library-cache"))
+    ansi_c.library_cache=cmdline.get_value("cprover-library-cache");
+
+  if(cmdline.isset("header-cache"))
+    ansi_c.header_cache=cmdline.get_value("header-cache");
+
+  if(cmdline.isset("builtin-preprocessor"))
+    ansi_c.preprocessor=ansi_ct::preprocessort::BUILTIN;
+
   if(cmdline.isset("little-endian"))
     ansi_c.endianness=configt::ansi_ct::endiannesst::IS_LITTLE_ENDIAN;
 
@@ -105,7 +105,7 @@ public:
     flavourt mode; // the syntax of source files
 
     enum class preprocessort { NONE, GCC, CLANG, VISUAL_STUDIO,
-                               CODEWARRIOR, ARM };
+                               CODEWARRIOR, ARM, BUILTIN };
     preprocessort preprocessor; // the preprocessor to use
 
     std::list<std::string> defines;
@@ -117,6 +117,12 @@ public:
     enum class libt { LIB_NONE, LIB_FULL };
     libt lib;
 
+    // directory with the precompiled library, if not empty
+    std::string library_cache;
+
+    // directory with the parsed headers, if not empty
+    std::string header_cache;
+
     bool string_abstraction;
   } ansi_c;
 
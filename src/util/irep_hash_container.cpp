@@ -18,20 +18,78 @@ size_t irep_hash_container_baset::number(const irept &irep)
 {
   // the ptr-hash provides a speedup of up to 3x
 
-  ptr_hasht::const_iterator it=ptr_hash.find(&irep.read());
+  const size_t *n=ptr_hash.find(&irep.read());
 
-  if(it!=ptr_hash.end())
-    return it->second;
+  if(n!=nullptr)
+    return *n;
 
   packedt packed;
   pack(irep, packed);
-  size_t id=numbering.number(packed);
+  size_t id=numbering.insert(
+    std::make_pair(std::move(packed), numbering.size())).first->second;
 
-  ptr_hash[&irep.read()]=id;
+  ptr_hash.insert(&irep.read(), id);
 
   return id;
 }
 
+size_t irep_hash_container_baset::ptr_hasht::bucket(const void *p) const
+{
+  // the low bits of addresses of heap objects are mostly zero
+  size_t h=reinterpret_cast<size_t>(p)>>4;
+  h^=h>>16;
+  h*=0x45d9f3b;
+  h^=h>>16;
+
+  return h&(table.size()-1);
+}
+
+const size_t *irep_hash_container_baset::ptr_hasht::find(
+  const void *p) const
+{
+  if(table.empty())
+    return nullptr;
+
+  // linear probing
+  for(size_t i=bucket(p); table[i].first!=nullptr; i=(i+1)&(table.size()-1))
+    if(table[i].first==p)
+      return &table[i].second;
+
+  return nullptr;
+}
+
+void irep_hash_container_baset::ptr_hasht::insert(
+  const void *p,
+  size_t number)
+{
+  // keep the table at most half full
+  if(2*(used+1)>table.size())
+  {
+    std::vector<entryt> old_table;
+    old_table.swap(table);
+    table.resize(
+      old_table.empty()?1024:2*old_table.size(), entryt(nullptr, 0));
+
+    for(const auto &entry : old_table)
+      if(entry.first!=nullptr)
+      {
+        size_t i=bucket(entry.first);
+        while(table[i].first!=nullptr)
+          i=(i+1)&(table.size()-1);
+        table[i]=entry;
+      }
+  }
+
+  size_t i=bucket(p);
+  while(table[i].first!=nullptr && table[i].first!=p)
+    i=(i+1)&(table.size()-1);
+
+  if(table[i].first==nullptr)
+    used++;
+
+  table[i]=entryt(p, number);
+}
+
 size_t irep_hash_container_baset::vector_hasht::operator()(
   const packedt &p) const
 {
@@ -13,10 +13,10 @@ Author: Daniel Kroening, kroening@kroening.com
 #define CPROVER_UTIL_IREP_HASH_CONTAINER_H
 
 #include <cstdlib>  // for size_t
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
-#include "numbering.h"
-
 class irept;
 
 class irep_hash_container_baset
@@ -30,6 +30,7 @@ public:
 
   void clear()
   {
+    ptr_hash.clear();
     numbering.clear();
   }
 
@@ -39,16 +40,34 @@ protected:
 
   // this is the first level: address of the content
 
-  struct pointer_hasht
+  // The tables grow to millions of entries when writing goto binaries,
+  // and a table with open addressing needs fewer memory accesses than
+  // std::unordered_map.
+  class ptr_hasht
   {
-    size_t operator()(const void *p) const
+  public:
+    ptr_hasht():used(0)
     {
-      return (size_t)p;
     }
+
+    // returns nullptr if the address is not in the table
+    const size_t *find(const void *p) const;
+    void insert(const void *p, size_t number);
+
+    void clear()
+    {
+      table.clear();
+      used=0;
+    }
+
+  protected:
+    typedef std::pair<const void *, size_t> entryt;
+    std::vector<entryt> table;
+    size_t used;
+
+    size_t bucket(const void *p) const;
   };
 
-  typedef std::unordered_map<const void *, size_t, pointer_hasht>
-    ptr_hasht;
   ptr_hasht ptr_hash;
 
   // this is the second level: content
@@ -60,7 +79,9 @@ protected:
     size_t operator()(const packedt &p) const;
   };
 
-  typedef hash_numbering<packedt, vector_hasht> numberingt;
+  // only the numbers are needed, thus hash_numbering, which also keeps a
+  // copy of each key in a vector, is not used
+  typedef std::unordered_map<packedt, size_t, vector_hasht> numberingt;
   numberingt numbering;
 
   void pack(const irept &irep, packedt &);
@@ -18,6 +18,8 @@ Date: May 2007
 
 #include "string_hash.h"
 
+const std::size_t irep_serializationt::ireps_containert::not_written;
+
 void irep_serializationt::write_irep(
   std::ostream &out,
   const irept &irep)
@@ -69,31 +71,35 @@ void irep_serializationt::read_irep(
   std::istream &in,
   irept &irep)
 {
+  // the stream buffer is used directly, as ireps have only a few
+  // bytes each, and each istream::get constructs a sentry
+  std::streambuf &buf=*in.rdbuf();
+
   irep.clear();
   irep.id(read_string_ref(in));
 
-  while(in.peek()=='S')
+  while(buf.sgetc()=='S')
   {
-    in.get();
+    buf.sbumpc();
     irep.get_sub().push_back(irept());
     reference_convert(in, irep.get_sub().back());
   }
 
-  while(in.peek()=='N')
+  while(buf.sgetc()=='N')
   {
-    in.get();
+    buf.sbumpc();
     irept &r=irep.add(read_string_ref(in));
     reference_convert(in, r);
   }
 
-  while(in.peek()=='C')
+  while(buf.sgetc()=='C')
   {
-    in.get();
+    buf.sbumpc();
     irept &r=irep.add(read_string_ref(in));
     reference_convert(in, r);
   }
 
-  if(in.get()!=0)
+  if(buf.sbumpc()!=0)
   {
     std::cerr << "irep not terminated\n";
     throw 0;
@@ -106,35 +112,36 @@ void irep_serializationt::reference_convert(
 {
   std::size_t h=ireps_container.irep_full_hash_container.number(irep);
 
-  // should be merged with insert
-  ireps_containert::ireps_on_writet::const_iterator fi=
-    ireps_container.ireps_on_write.find(h);
+  const ireps_containert::ireps_on_writet &on_write=
+    ireps_container.ireps_on_write;
 
-  if(fi==ireps_container.ireps_on_write.end())
+  if(h<on_write.size() && on_write[h]!=ireps_containert::not_written)
   {
-    size_t id=insert_on_write(h);
-    write_gb_word(out, id);
-    write_irep(out, irep);
+    write_gb_word(out, on_write[h]);
   }
   else
   {
-    write_gb_word(out, fi->second);
+    size_t id=insert_on_write(h);
+    write_gb_word(out, id);
+    write_irep(out, irep);
   }
 }
 
-/// inserts an irep into the hashtable
-/// \par parameters: a size_t and an irep
-/// \return true on success, false otherwise
+/// inserts an irep into the table of ireps written
+/// \par parameters: the number given to the irep by the hash container
+/// \return the number of the irep in the output
 std::size_t irep_serializationt::insert_on_write(std::size_t h)
 {
-  std::pair<ireps_containert::ireps_on_writet::const_iterator, bool> res=
-    ireps_container.ireps_on_write.insert(
-      std::make_pair(h, ireps_container.ireps_on_write.size()));
+  ireps_containert::ireps_on_writet &on_write=
+    ireps_container.ireps_on_write;
 
-  if(!res.second)
-    return ireps_container.ireps_on_write.size();
-  else
-    return res.first->second;
+  if(h>=on_write.size())
+    on_write.resize(h+1, ireps_containert::not_written);
+
+  if(on_write[h]==ireps_containert::not_written)
+    on_write[h]=ireps_container.ireps_written++;
+
+  return on_write[h];
 }
 
 /// inserts an irep into the hashtable, but only the id-hashtable (only to be
@@ -167,6 +174,8 @@ void write_gb_word(std::ostream &out, std::size_t u)
 {
   // we write 7 bits each time, until we have zero
 
+  std::streambuf &buf=*out.rdbuf();
+
   while(true)
   {
     unsigned char value=u&0x7f;
@@ -174,11 +183,13 @@ void write_gb_word(std::ostream &out, std::size_t u)
 
     if(u==0)
     {
-      out.put(value);
+      if(buf.sputc(value)==std::streambuf::traits_type::eof())
+        out.setstate(std::ios::badbit);
       break;
     }
 
-    out.put(value | 0x80);
+    if(buf.sputc(value | 0x80)==std::streambuf::traits_type::eof())
+      out.setstate(std::ios::badbit);
   }
 }
 
@@ -187,13 +198,22 @@ void write_gb_word(std::ostream &out, std::size_t u)
 /// \return a long
 std::size_t irep_serializationt::read_gb_word(std::istream &in)
 {
+  std::streambuf &buf=*in.rdbuf();
   std::size_t res=0;
 
   unsigned shift_distance=0;
 
   while(in.good())
   {
-    unsigned char ch=static_cast<unsigned char>(in.get());
+    std::streambuf::int_type c=buf.sbumpc();
+
+    if(c==std::streambuf::traits_type::eof())
+    {
+      in.setstate(std::ios::eofbit | std::ios::failbit);
+      break;
+    }
+
+    unsigned char ch=static_cast<unsigned char>(c);
     res|=(size_t(ch&0x7f))<<shift_distance;
     shift_distance+=7;
     if((ch&0x80)==0)
@@ -225,16 +245,17 @@ void write_gb_string(std::ostream &out, const std::string &s)
 /// \return a string
 irep_idt irep_serializationt::read_gb_string(std::istream &in)
 {
+  std::streambuf &buf=*in.rdbuf();
   char c;
   size_t length=0;
 
-  while((c=static_cast<char>(in.get()))!=0)
+  while((c=static_cast<char>(buf.sbumpc()))!=0)
   {
     if(length>=read_buffer.size())
       read_buffer.resize(read_buffer.size()*2, 0);
 
     if(c=='\\') // escaped chars
-      read_buffer[length]=static_cast<char>(in.get());
+      read_buffer[length]=static_cast<char>(buf.sbumpc());
     else
       read_buffer[length]=c;
 
@@ -35,8 +35,12 @@ public:
     ireps_on_readt ireps_on_read;
 
     irep_full_hash_containert irep_full_hash_container;
-    typedef std::map<unsigned, size_t> ireps_on_writet;
+    // the number of an irep in the output, indexed by the number
+    // irep_full_hash_container gives to it, or not_written
+    typedef std::vector<std::size_t> ireps_on_writet;
     ireps_on_writet ireps_on_write;
+    std::size_t ireps_written;
+    static const std::size_t not_written=~std::size_t(0);
 
     typedef std::vector<bool> string_mapt;
     string_mapt string_map;
@@ -48,6 +52,7 @@ public:
     {
       irep_full_hash_container.clear();
       ireps_on_write.clear();
+      ireps_written=0;
       ireps_on_read.clear();
       string_map.clear();
       string_rev_map.clear();
@@ -9,6 +9,8 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "parser.h"
 
+#include <istream>
+
 #ifdef _WIN32
 int isatty(int f)
 {
@@ -27,6 +29,42 @@ exprt &_newstack(parsert &parser, unsigned &x)
   return parser.stack.back();
 }
 
+/// Copies the next line of the input, including the newline but without
+/// carriage returns, to dest. This is the input routine of the scanners;
+/// it takes the characters straight from the stream buffer, which avoids
+/// the overhead of a formatted read per character.
+/// \return the number of characters copied, which is 0 at the end of the
+///   input
+std::size_t parsert::read_line(char *dest, std::size_t max_size)
+{
+  std::streambuf *buf=in->rdbuf();
+  std::size_t result=0;
+
+  while(result<max_size)
+  {
+    const int ch=buf->sbumpc();
+
+    if(ch==std::char_traits<char>::eof())
+    {
+      in->setstate(std::ios::eofbit);
+      break;
+    }
+
+    if(ch=='\r')
+      continue;
+
+    dest[result++]=static_cast<char>(ch);
+
+    if(ch=='\n')
+    {
+      inc_line_no();
+      break;
+    }
+  }
+
+  return result;
+}
+
 void parsert::parse_error(
   const std::string &message,
   const std::string &before)
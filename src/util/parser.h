@@ -25,8 +25,6 @@ class parsert:public messaget
 public:
   std::istream *in;
 
-  std::string this_line, last_line;
-
   std::vector<exprt> stack;
 
   virtual void clear()
@@ -36,7 +34,6 @@ public:
     column=1;
     stack.clear();
     source_location.clear();
-    last_line.clear();
   }
 
   parsert():in(nullptr) { clear(); }
@@ -46,20 +43,11 @@ public:
 
   bool read(char &ch)
   {
-    if(!in->read(&ch, 1))
-      return false;
-
-    if(ch=='\n')
-    {
-      last_line.swap(this_line);
-      this_line.clear();
-    }
-    else
-      this_line+=ch;
-
-    return true;
+    return !!in->get(ch);
   }
 
+  std::size_t read_line(char *dest, std::size_t max_size);
+
   virtual bool parse()=0;
 
   bool eof()
@@ -148,26 +136,7 @@ exprt &_newstack(parsert &parser, unsigned &x);
 
 #define YY_INPUT(buf, result, max_size) \
     do { \
-        for(result=0; result<max_size;) \
-        { \
-          char ch; \
-          if(!PARSER.read(ch)) /* NOLINT(readability/braces) */ \
-          { \
-            if(result==0) \
-              result=YY_NULL; \
-            break; \
-          } \
-          \
-          if(ch!='\r') /* NOLINT(readability/braces) */ \
-          { \
-            buf[result++]=ch; \
-            if(ch=='\n') /* NOLINT(readability/braces) */ \
-            { \
-              PARSER.inc_line_no(); \
-              break; \
-            } \
-          } \
-        } \
+      result=PARSER.read_line((buf), (max_size)); \
     } while(0)
 
 // The following tracks the column of the token, and is nicely explained here:
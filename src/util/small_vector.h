@@ -0,0 +1,287 @@
+/*******************************************************************\
+
+Module: Vector with Inline Storage
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Vector with Inline Storage
+
+#ifndef CPROVER_UTIL_SMALL_VECTOR_H
+#define CPROVER_UTIL_SMALL_VECTOR_H
+
+#include <cassert>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/// A vector that keeps up to N elements within the object itself, and
+/// only allocates on the heap when it grows beyond that. This suits the
+/// many small containers in a goto program, e.g., the targets of an
+/// instruction, which are usually empty or have a single element.
+/// Iterators are plain pointers, and are invalidated by any operation
+/// that adds or removes elements.
+template <typename T, std::size_t N=1>
+class small_vectort
+{
+public:
+  // NOLINTNEXTLINE(readability/identifiers)
+  typedef T value_type;
+  // NOLINTNEXTLINE(readability/identifiers)
+  typedef std::size_t size_type;
+  // NOLINTNEXTLINE(readability/identifiers)
+  typedef T &reference;
+  // NOLINTNEXTLINE(readability/identifiers)
+  typedef const T &const_reference;
+  // NOLINTNEXTLINE(readability/identifiers)
+  typedef T *iterator;
+  // NOLINTNEXTLINE(readability/identifiers)
+  typedef const T *const_iterator;
+
+  small_vectort():_size(0), _capacity(N)
+  {
+  }
+
+  small_vectort(const small_vectort &other):_size(0), _capacity(N)
+  {
+    reserve(other._size);
+    for(const auto &e : other)
+      new(data()+_size++) T(e);
+  }
+
+  small_vectort(small_vectort &&other):_size(0), _capacity(N)
+  {
+    take(other);
+  }
+
+  template <typename iteratort>
+  small_vectort(iteratort first, iteratort last):_size(0), _capacity(N)
+  {
+    for(; first!=last; ++first)
+      push_back(*first);
+  }
+
+  ~small_vectort()
+  {
+    clear();
+    if(on_heap())
+      ::operator delete(storage.heap);
+  }
+
+  small_vectort &operator=(const small_vectort &other)
+  {
+    if(this!=&other)
+    {
+      clear();
+      reserve(other._size);
+      for(const auto &e : other)
+        new(data()+_size++) T(e);
+    }
+    return *this;
+  }
+
+  small_vectort &operator=(small_vectort &&other)
+  {
+    if(this!=&other)
+    {
+      clear();
+      if(on_heap())
+        ::operator delete(storage.heap);
+      _capacity=N;
+      take(other);
+    }
+    return *this;
+  }
+
+  T *data()
+  {
+    return on_heap()?storage.heap:reinterpret_cast<T *>(&storage.local);
+  }
+
+  const T *data() const
+  {
+    return
+      on_heap()?storage.heap:reinterpret_cast<const T *>(&storage.local);
+  }
+
+  iterator begin() { return data(); }
+  iterator end() { return data()+_size; }
+  const_iterator begin() const { return data(); }
+  const_iterator end() const { return data()+_size; }
+  const_iterator cbegin() const { return data(); }
+  const_iterator cend() const { return data()+_size; }
+
+  std::size_t size() const { return _size; }
+  std::size_t capacity() const { return _capacity; }
+  bool empty() const { return _size==0; }
+
+  T &operator[](std::size_t i) { return data()[i]; }
+  const T &operator[](std::size_t i) const { return data()[i]; }
+
+  T &front() { assert(_size!=0); return data()[0]; }
+  const T &front() const { assert(_size!=0); return data()[0]; }
+  T &back() { assert(_size!=0); return data()[_size-1]; }
+  const T &back() const { assert(_size!=0); return data()[_size-1]; }
+
+  void push_back(const T &value)
+  {
+    if(_size==_capacity)
+    {
+      // the value may live in this vector
+      T tmp(value);
+      grow(_size+1);
+      new(data()+_size) T(std::move(tmp));
+    }
+    else
+      new(data()+_size) T(value);
+    ++_size;
+  }
+
+  void push_back(T &&value)
+  {
+    if(_size==_capacity)
+    {
+      T tmp(std::move(value));
+      grow(_size+1);
+      new(data()+_size) T(std::move(tmp));
+    }
+    else
+      new(data()+_size) T(std::move(value));
+    ++_size;
+  }
+
+  void pop_back()
+  {
+    assert(_size!=0);
+    data()[--_size].~T();
+  }
+
+  /// inserts before the given position, and moves the elements after it
+  iterator insert(const_iterator pos, const T &value)
+  {
+    std::size_t index=pos-begin();
+    assert(index<=_size);
+    push_back(value);
+    T *d=data();
+    for(std::size_t i=_size-1; i>index; i--)
+      std::swap(d[i], d[i-1]);
+    return d+index;
+  }
+
+  iterator erase(const_iterator pos)
+  {
+    std::size_t index=pos-begin();
+    assert(index<_size);
+    T *d=data();
+    for(std::size_t i=index; i+1<_size; i++)
+      d[i]=std::move(d[i+1]);
+    pop_back();
+    return data()+index;
+  }
+
+  void clear()
+  {
+    T *d=data();
+    for(std::size_t i=0; i<_size; i++)
+      d[i].~T();
+    _size=0;
+  }
+
+  void reserve(std::size_t n)
+  {
+    if(n>_capacity)
+      grow(n);
+  }
+
+  void swap(small_vectort &other)
+  {
+    small_vectort tmp(std::move(other));
+    other=std::move(*this);
+    *this=std::move(tmp);
+  }
+
+  bool operator==(const small_vectort &other) const
+  {
+    if(_size!=other._size)
+      return false;
+    for(std::size_t i=0; i<_size; i++)
+      if(!(data()[i]==other.data()[i]))
+        return false;
+    return true;
+  }
+
+  bool operator!=(const small_vectort &other) const
+  {
+    return !(*this==other);
+  }
+
+protected:
+  union storaget
+  {
+    T *heap;
+    typename std::aligned_storage<sizeof(T)*N, alignof(T)>::type local;
+  } storage;
+
+  unsigned _size, _capacity;
+
+  bool on_heap() const
+  {
+    return _capacity>N;
+  }
+
+  void grow(std::size_t n)
+  {
+    std::size_t new_capacity=_capacity*2;
+    if(new_capacity<n)
+      new_capacity=n;
+
+    T *new_data=static_cast<T *>(::operator new(sizeof(T)*new_capacity));
+    T *d=data();
+    for(std::size_t i=0; i<_size; i++)
+    {
+      new(new_data+i) T(std::move(d[i]));
+      d[i].~T();
+    }
+
+    if(on_heap())
+      ::operator delete(storage.heap);
+
+    storage.heap=new_data;
+    _capacity=static_cast<unsigned>(new_capacity);
+  }
+
+  /// moves the elements of 'other', which is left empty; this vector
+  /// must be empty and use its inline storage
+  void take(small_vectort &other)
+  {
+    if(other.on_heap())
+    {
+      storage.heap=other.storage.heap;
+      _size=other._size;
+      _capacity=other._capacity;
+      other._size=0;
+      other._capacity=N;
+    }
+    else
+    {
+      T *d=other.data();
+      for(std::size_t i=0; i<other._size; i++)
+      {
+        new(data()+_size++) T(std::move(d[i]));
+        d[i].~T();
+      }
+      other._size=0;
+    }
+  }
+};
+
+template <typename T, std::size_t N>
+void swap(small_vectort<T, N> &a, small_vectort<T, N> &b)
+{
+  a.swap(b);
+}
+
+#endif // CPROVER_UTIL_SMALL_VECTOR_H
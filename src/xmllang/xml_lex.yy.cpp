@@ -0,0 +1,237 @@
+/* generated by miniflex */
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#define yylex yyxmllex
+#define yytext yyxmltext
+#define yyleng yyxmlleng
+#define yyin yyxmlin
+#define yyout yyxmlout
+#define yywrap yyxmlwrap
+#define yyrestart yyxmlrestart
+#define yylineno yyxmllineno
+#define YY_NULL 0
+int yylex();
+int yywrap();
+extern char *yytext;
+extern int yyleng;
+extern FILE *yyin, *yyout;
+static void yy_flush_buffer_impl();
+#define YY_FLUSH_BUFFER yy_flush_buffer_impl()
+#define BEGIN yy_start_state=
+#define YY_START yy_start_state
+#define yyterminate() return YY_NULL
+static int yy_start_state=0;
+#ifdef _WIN32
+#define YY_NO_UNISTD_H
+static int isatty(int) { return 0; }
+#endif
+
+#include <cctype>
+#include <cstring>
+#include <cstdlib>
+
+#include "xml_parser.h"
+#include "xml_y.tab.h"
+
+#define PARSER xml_parser
+
+//static int keep;  /* To store start condition */
+
+static char *word(char *s)
+{
+  char *buf;
+  int i, k;
+  for (k = 0; isspace(s[k]) || s[k] == '<'; k++) ;
+  for (i = k; s[i] && ! isspace(s[i]); i++) ;
+  buf = (char *)malloc((i - k + 1) * sizeof(char));
+  strncpy(buf, &s[k], i - k);
+  buf[i - k] = '\0';
+  return buf;
+}
+
+#include <util/pragma_wsign_compare.def>
+#include <util/pragma_wnull_conversion.def>
+#include <util/pragma_wdeprecated_register.def>
+
+
+#ifndef YY_INPUT
+#define YY_INPUT(buf, result, max_size) (result=(int)fread((buf), 1, (max_size), yyin?yyin:stdin))
+#endif
+#ifndef YY_USER_ACTION
+#define YY_USER_ACTION
+#endif
+#ifndef ECHO
+#define ECHO fwrite(yytext, yyleng, 1, yyout?yyout:stdout)
+#endif
+#ifndef YY_BREAK
+#define YY_BREAK break;
+#endif
+#define INITIAL 0
+#define CONTENT 1
+#define PI 2
+#define DTD 3
+char *yytext=nullptr;
+int yyleng=0;
+FILE *yyin=nullptr, *yyout=nullptr;
+static std::vector<char> yy_buf;
+static std::size_t yy_pos=0, yy_len=0, yy_hold_pos=0;
+static bool yy_buf_valid=false, yy_hold_active=false;
+static char yy_hold=0;
+static std::vector<int> yy_state_stack;
+static void yy_flush_buffer_impl()
+{ yy_buf_valid=false; yy_hold_active=false; }
+static void yy_push_state(int s)
+{ yy_state_stack.push_back(yy_start_state); yy_start_state=s; }
+static void yy_pop_state()
+{ yy_start_state=yy_state_stack.back(); yy_state_stack.pop_back(); }
+static int yy_top_state() { return yy_state_stack.back(); }
+static bool yy_eof=false;
+static bool yy_more_input()
+{
+  if(yy_eof) return false;
+  yy_buf.erase(yy_buf.begin(), yy_buf.begin()+yy_pos);
+  yy_len-=yy_pos; yy_pos=0;
+  yy_buf.resize(yy_len);
+  char chunk[8192];
+  int result=0;
+  YY_INPUT(chunk, result, sizeof(chunk));
+  if(result<=0) yy_eof=true;
+  else yy_buf.insert(yy_buf.end(), chunk, chunk+result);
+  yy_len=yy_buf.size();
+  yy_buf.push_back(0);
+  return result>0;
+}
+static void yy_fill()
+{
+  yy_buf.clear(); yy_buf.push_back(0);
+  yy_pos=0; yy_len=0; yy_eof=false;
+  yy_buf_valid=true;
+  yy_more_input();
+}
+#define yyless(n) do { yy_buf[yy_hold_pos]=yy_hold; yy_pos=(yytext-yy_buf.data())+(n); yy_hold_pos=yy_pos; yy_hold=yy_buf[yy_pos]; yy_buf[yy_pos]=0; yyleng=(n); } while(0)
+static void yyunput_impl(int c)
+{
+  if(yy_hold_active) { yy_buf[yy_hold_pos]=yy_hold; yy_hold_active=false; }
+  if(yy_pos==0) { yy_buf.insert(yy_buf.begin(), (char)c); yy_len++; }
+  else yy_buf[--yy_pos]=(char)c;
+}
+#define unput(c) yyunput_impl(c)
+#define yymore() static_assert(false, "yymore unsupported")
+static const unsigned char yy_ec[256]={31,31,31,31,31,31,31,31,31,2,0,31,31,1,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,2,3,4,5,31,31,6,7,31,31,31,31,31,8,30,9,10,10,10,10,10,10,10,10,10,10,30,11,12,13,14,15,31,24,24,16,17,18,24,28,28,28,28,28,28,28,28,19,20,28,28,28,21,28,28,28,28,22,28,31,31,23,31,29,31,24,24,24,24,24,24,28,28,28,28,28,25,26,28,28,28,28,28,28,28,28,28,28,27,28,28,31,31,31,31,31,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29};
+static const short yy_nxt[]={136,137,37,44,41,44,44,42,44,138,44,44,140,39,139,43,40,40,40,40,40,40,40,44,40,40,40,40,40,40,44,44,81,80,82,82,82,82,83,82,82,82,82,82,38,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,35,36,37,44,41,44,44,42,44,44,44,44,38,39,44,43,40,40,40,40,40,40,40,44,40,40,40,40,40,40,44,44,6,5,7,7,7,7,7,7,7,7,7,7,4,7,7,7,7,7,7,7,7,7,7,8,7,7,7,7,7,7,7,7,14,14,14,18,-1,-1,-1,-1,-1,16,-1,-1,-1,-1,-1,15,17,17,17,17,17,17,17,-1,17,17,17,17,17,17,-1,-1,34,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,13,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,13,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,9,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,11,10,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,12,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,14,14,14,18,-1,-1,-1,-1,-1,16,-1,-1,-1,-1,-1,15,17,17,17,17,17,17,17,-1,17,17,17,17,17,17,-1,-1,33,33,33,-1,-1,-1,-1,-1,-1,16,-1,-1,-1,-1,-1,-1,17,17,17,17,17,17,17,-1,17,17,17,17,17,17,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,30,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,29,-1,29,-1,-1,-1,-1,-1,29,29,29,29,29,29,29,-1,29,29,29,29,29,29,29,-1,-1,-1,-1,-1,-1,-1,-1,-1,19,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,20,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,21,21,21,21,21,21,21,21,22,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,22,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,24,24,24,24,24,24,24,24,23,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,25,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,21,21,21,21,21,21,21,21,22,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,27,26,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,28,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,29,-1,29,-1,-1,-1,-1,-1,29,29,29,29,29,29,29,-1,29,29,29,29,29,29,29,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,31,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,32,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,33,33,33,-1,-1,-1,-1,-1,-1,16,-1,-1,-1,-1,-1,-1,17,17,17,17,17,17,17,-1,17,17,17,17,17,17,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,13,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,78,78,78,-1,-1,-1,-1,-1,-1,-1,-1,-1,13,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,79,78,78,-1,-1,-1,-1,-1,-1,-1,-1,-1,13,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,78,78,78,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,14,14,14,18,-1,-1,-1,-1,-1,16,-1,-1,-1,-1,-1,15,17,17,17,17,17,17,17,-1,17,17,17,17,17,17,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,77,-1,77,-1,-1,-1,-1,-1,77,77,77,77,77,77,77,-1,77,77,77,77,77,77,77,-1,65,65,65,65,64,65,63,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,51,51,51,51,51,51,49,50,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,45,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,47,46,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,48,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,53,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,52,52,52,52,52,52,52,-1,52,52,52,52,52,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,51,51,51,51,51,51,49,50,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,62,-1,-1,-1,-1,61,61,61,61,61,61,61,-1,61,61,61,61,61,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,54,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,55,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,59,60,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,56,-1,-1,-1,-1,-1,56,56,56,-1,-1,-1,-1,-1,56,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,57,58,-1,-1,-1,-1,57,57,57,-1,-1,-1,-1,-1,57,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,57,58,-1,-1,-1,-1,57,57,57,-1,-1,-1,-1,-1,57,-1,-1,-1,-1,-1,-1,-1,51,51,51,51,51,51,49,50,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,59,60,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,51,51,51,51,51,51,49,50,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,62,-1,-1,-1,-1,61,61,61,61,61,61,61,-1,61,61,61,61,61,-1,-1,-1,51,51,51,51,51,51,49,50,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,-1,-1,-1,-1,-1,67,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,66,66,66,66,66,66,66,-1,66,66,66,66,66,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,65,65,65,65,64,65,63,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,76,-1,-1,-1,-1,75,75,75,75,75,75,75,-1,75,75,75,75,75,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,69,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,68,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,72,-1,-1,-1,-1,-1,72,72,72,-1,-1,-1,-1,-1,72,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,70,71,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,70,71,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,65,65,65,65,64,65,63,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,73,74,-1,-1,-1,-1,73,73,73,-1,-1,-1,-1,-1,73,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,73,74,-1,-1,-1,-1,73,73,73,-1,-1,-1,-1,-1,73,-1,-1,-1,-1,-1,-1,-1,65,65,65,65,64,65,63,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,76,-1,-1,-1,-1,75,75,75,75,75,75,75,-1,75,75,75,75,75,-1,-1,-1,65,65,65,65,64,65,63,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,-1,-1,-1,-1,-1,-1,-1,-1,77,-1,77,-1,-1,-1,-1,-1,77,77,77,77,77,77,77,-1,77,77,77,77,77,77,77,-1,78,78,78,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,78,78,78,-1,-1,-1,-1,-1,-1,-1,-1,-1,13,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,135,90,90,90,90,90,92,90,90,90,90,90,13,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,122,122,122,122,122,122,123,122,122,122,122,122,13,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,91,90,90,90,90,90,92,90,90,90,90,90,-1,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,-1,-1,-1,-1,-1,85,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,84,84,84,84,84,84,84,-1,84,84,84,84,84,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,120,-1,-1,-1,-1,121,121,121,121,121,121,121,-1,121,121,121,121,121,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,87,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,86,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,117,-1,-1,-1,-1,-1,117,117,117,-1,-1,-1,-1,-1,117,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,88,89,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,88,89,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,91,90,90,90,90,90,92,90,90,90,90,90,-1,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,91,90,90,90,90,90,92,90,90,90,90,90,-1,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,105,105,105,105,105,105,104,105,105,105,105,105,-1,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,-1,-1,-1,-1,-1,93,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,94,94,94,94,94,94,94,-1,94,94,94,94,94,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,98,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,97,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,95,-1,-1,-1,-1,96,96,96,96,96,96,96,-1,96,96,96,96,96,-1,-1,-1,91,90,90,90,90,90,92,90,90,90,90,90,-1,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,95,-1,-1,-1,-1,96,96,96,96,96,96,96,-1,96,96,96,96,96,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,101,-1,-1,-1,-1,-1,101,101,101,-1,-1,-1,-1,-1,101,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,99,100,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,99,100,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,91,90,90,90,90,90,92,90,90,90,90,90,-1,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,102,103,-1,-1,-1,-1,102,102,102,-1,-1,-1,-1,-1,102,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,102,103,-1,-1,-1,-1,102,102,102,-1,-1,-1,-1,-1,102,-1,-1,-1,-1,-1,-1,-1,91,90,90,90,90,90,92,90,90,90,90,90,-1,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,-1,-1,-1,-1,-1,107,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,106,106,106,106,106,106,106,-1,106,106,106,106,106,-1,-1,-1,91,90,90,90,90,90,92,90,90,90,90,90,-1,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,115,-1,-1,-1,-1,116,116,116,116,116,116,116,-1,116,116,116,116,116,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,109,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,108,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,112,-1,-1,-1,-1,-1,112,112,112,-1,-1,-1,-1,-1,112,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,110,111,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,110,111,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,91,90,90,90,90,90,92,90,90,90,90,90,-1,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,113,114,-1,-1,-1,-1,113,113,113,-1,-1,-1,-1,-1,113,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,113,114,-1,-1,-1,-1,113,113,113,-1,-1,-1,-1,-1,113,-1,-1,-1,-1,-1,-1,-1,91,90,90,90,90,90,92,90,90,90,90,90,-1,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,91,90,90,90,90,90,92,90,90,90,90,90,-1,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,115,-1,-1,-1,-1,116,116,116,116,116,116,116,-1,116,116,116,116,116,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,118,119,-1,-1,-1,-1,118,118,118,-1,-1,-1,-1,-1,118,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,118,119,-1,-1,-1,-1,118,118,118,-1,-1,-1,-1,-1,118,-1,-1,-1,-1,-1,-1,-1,91,90,90,90,90,90,92,90,90,90,90,90,-1,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,91,90,90,90,90,90,92,90,90,90,90,90,-1,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,120,-1,-1,-1,-1,121,121,121,121,121,121,121,-1,121,121,121,121,121,-1,-1,-1,91,90,90,90,90,90,92,90,90,90,90,90,-1,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,-1,-1,-1,-1,-1,124,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,125,125,125,125,125,125,125,-1,125,125,125,125,125,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,128,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,129,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,126,-1,-1,-1,-1,127,127,127,127,127,127,127,-1,127,127,127,127,127,-1,-1,-1,91,90,90,90,90,90,92,90,90,90,90,90,-1,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,126,-1,-1,-1,-1,127,127,127,127,127,127,127,-1,127,127,127,127,127,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,133,134,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,130,-1,-1,-1,-1,-1,130,130,130,-1,-1,-1,-1,-1,130,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,131,132,-1,-1,-1,-1,131,131,131,-1,-1,-1,-1,-1,131,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,131,132,-1,-1,-1,-1,131,131,131,-1,-1,-1,-1,-1,131,-1,-1,-1,-1,-1,-1,-1,91,90,90,90,90,90,92,90,90,90,90,90,-1,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,133,134,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,91,90,90,90,90,90,92,90,90,90,90,90,-1,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,105,105,105,105,105,105,104,105,105,105,105,105,13,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,78,78,78,-1,-1,-1,-1,-1,-1,-1,-1,-1,154,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,155,78,78,-1,-1,-1,-1,-1,-1,-1,-1,-1,154,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,152,151,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,14,14,14,141,-1,-1,-1,-1,-1,16,-1,-1,-1,-1,-1,15,17,17,17,17,17,17,17,-1,17,17,17,17,17,17,-1,-1,142,142,142,-1,-1,-1,-1,-1,19,-1,-1,-1,-1,-1,-1,-1,-1,143,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,150,150,150,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,143,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,144,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,145,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,146,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,147,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,148,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,149,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,150,150,150,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,143,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,153,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,14,14,14,141,-1,-1,-1,-1,-1,16,-1,-1,-1,-1,-1,15,17,17,17,17,17,17,17,-1,17,17,17,17,17,17,-1,-1,78,78,78,-1,-1,-1,-1,-1,-1,-1,-1,-1,154,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1};
+static const unsigned char yy_jam[]={0,0,0,0,0,0,0,1,0,0,0,1,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,1,0,0,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,1,0,0,1,1,0,0};
+static const short yy_accept[]={-1,-1,-1,-1,14,14,17,14,14,15,15,15,15,-1,-1,10,8,7,-1,-1,-1,-1,-1,-1,-1,11,11,11,11,7,-1,-1,9,-1,17,0,0,0,16,2,4,16,16,16,16,6,6,6,6,-1,5,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,5,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,4,0,0,12,17,12,16,-1,-1,-1,-1,-1,12,12,-1,-1,-1,-1,12,-1,-1,-1,-1,12,-1,-1,12,-1,12,-1,-1,-1,-1,-1,12,-1,-1,12,12,-1,-1,-1,12,12,-1,12,-1,-1,-1,12,-1,-1,-1,-1,-1,12,-1,12,17,0,0,1,3,16,-1,-1,-1,-1,-1,-1,-1,-1,13,-1,3,3,3,-1,0};
+static const int yy_start_dfa[]={0,1,2,3};
+int yylex()
+{
+  for(;;)
+  {
+    if(yy_hold_active) { yy_buf[yy_hold_pos]=yy_hold; yy_hold_active=false; }
+    if(!yy_buf_valid) yy_fill();
+    if(yy_pos>=yy_len && yy_more_input()) continue;
+    if(yy_pos>=yy_len)
+    {
+      yy_buf_valid=false;
+      yytext=yy_buf.data()+yy_len; yyleng=0;
+      switch(yy_start_state)
+      {
+      default: break;
+      }
+      if(yywrap()) return YY_NULL;
+      continue;
+    }
+    int yy_state=yy_start_dfa[yy_start_state];
+    std::size_t yy_p=yy_pos, yy_end=0;
+    int yy_rule=-1;
+    for(;;)
+    {
+      while(yy_p<yy_len)
+      {
+        yy_state=yy_nxt[yy_state*32+yy_ec[(unsigned char)yy_buf[yy_p]]];
+        if(yy_state<0) break;
+        yy_p++;
+        if(yy_accept[yy_state]>=0) { yy_rule=yy_accept[yy_state]; yy_end=yy_p; }
+        if(yy_jam[yy_state]) break;
+      }
+      if(yy_p<yy_len || yy_state<0 || yy_jam[yy_state]) break;
+      std::size_t yy_off=yy_pos;
+      if(!yy_more_input()) break;
+      yy_p-=yy_off; if(yy_end!=0) yy_end-=yy_off;
+    }
+    if(yy_rule<0) { yy_rule=18; yy_end=yy_pos+1; }
+    yytext=yy_buf.data()+yy_pos;
+    yyleng=(int)(yy_end-yy_pos);
+    yy_hold_pos=yy_end; yy_hold=yy_buf[yy_end]; yy_buf[yy_end]=0;
+    yy_hold_active=true;
+    yy_pos=yy_end;
+    YY_USER_ACTION
+    switch(yy_rule)
+    {
+    case 0:
+{/* skip */}
+    break;
+    case 1:
+{return SLASH;}
+    break;
+    case 2:
+{return EQ;}
+    break;
+    case 3:
+{BEGIN(CONTENT); return CLOSE;}
+    break;
+    case 4:
+{yyxmllval.s=strdup(yytext); return NAME;}
+    break;
+    case 5:
+{yyxmllval.s=strdup(yytext); return VALUE;}
+    break;
+    case 6:
+{BEGIN(INITIAL); return ENDPI;}
+    break;
+    case 7:
+{BEGIN(INITIAL); yyxmllval.s=word(yytext); return START;}
+    break;
+    case 8:
+{BEGIN(INITIAL); return END;}
+    break;
+    case 9:
+{BEGIN(INITIAL); return STARTXMLDECL;}
+    break;
+    case 10:
+{BEGIN(PI); yyxmllval.s=word(yytext); return STARTPI;}
+    break;
+    case 11:
+{yyxmllval.s=strdup(yytext); return COMMENT;}
+    break;
+    case 12:
+{yyxmllval.s=strdup(yytext); return DATA;}
+    break;
+    case 13:
+{BEGIN(DTD); /* skip */}
+    break;
+    case 14:
+{/* skip */}
+    break;
+    case 15:
+{BEGIN(INITIAL); /* skip */}
+    break;
+    case 16:
+{ yyxmlerror("unexpected character"); }
+    break;
+    case 17:
+{/* skip, must be an extra one at EOF */;}
+    break;
+    default:
+      ECHO;
+      break;
+    }
+  }
+}
+// suppress unused warnings
+static void yy_unused_helpers()
+{ (void)&yy_push_state; (void)&yy_pop_state; (void)&yy_top_state;
+  (void)&yyunput_impl; (void)&yy_unused_helpers; }
+
+int yywrap() { return 1; }
@@ -0,0 +1,116 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YYXML_XML_Y_TAB_HPP_INCLUDED
+# define YY_YYXML_XML_Y_TAB_HPP_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yyxmldebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    STARTXMLDECL = 258,            /* STARTXMLDECL  */
+    VERSION = 259,                 /* VERSION  */
+    STARTPI = 260,                 /* STARTPI  */
+    ENDPI = 261,                   /* ENDPI  */
+    EQ = 262,                      /* EQ  */
+    SLASH = 263,                   /* SLASH  */
+    CLOSE = 264,                   /* CLOSE  */
+    END = 265,                     /* END  */
+    ENCODING = 266,                /* ENCODING  */
+    NAME = 267,                    /* NAME  */
+    VALUE = 268,                   /* VALUE  */
+    DATA = 269,                    /* DATA  */
+    COMMENT = 270,                 /* COMMENT  */
+    START = 271                    /* START  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
+#define STARTXMLDECL 258
+#define VERSION 259
+#define STARTPI 260
+#define ENDPI 261
+#define EQ 262
+#define SLASH 263
+#define CLOSE 264
+#define END 265
+#define ENCODING 266
+#define NAME 267
+#define VALUE 268
+#define DATA 269
+#define COMMENT 270
+#define START 271
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 19 "parser.y"
+char *s;
+
+#line 102 "xml_y.tab.hpp"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+extern YYSTYPE yyxmllval;
+
+
+int yyxmlparse (void);
+
+
+#endif /* !YY_YYXML_XML_Y_TAB_HPP_INCLUDED  */
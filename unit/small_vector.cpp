@@ -0,0 +1,113 @@
+/*******************************************************************\
+
+ Module: Unit tests for small_vectort
+
+ Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Unit tests for small_vectort
+
+#include <catch.hpp>
+
+#include <string>
+#include <utility>
+
+#include <util/small_vector.h>
+
+#include <goto-programs/goto_program.h>
+
+SCENARIO("small_vectort", "[core][util][small_vector]")
+{
+  GIVEN("A vector with one inline element")
+  {
+    small_vectort<std::string> v;
+
+    REQUIRE(v.empty());
+    REQUIRE(v.capacity()==1);
+
+    WHEN("one element is added")
+    {
+      v.push_back("a");
+
+      THEN("it stays inline")
+      {
+        REQUIRE(v.size()==1);
+        REQUIRE(v.capacity()==1);
+        REQUIRE(v.front()=="a");
+      }
+    }
+
+    WHEN("it grows beyond its inline storage")
+    {
+      v.push_back("a");
+      v.push_back("b");
+      v.push_back(v.front());
+      v.insert(v.begin(), "c");
+
+      THEN("the elements are kept in order")
+      {
+        REQUIRE(v.size()==4);
+        REQUIRE(v[0]=="c");
+        REQUIRE(v[1]=="a");
+        REQUIRE(v[2]=="b");
+        REQUIRE(v[3]=="a");
+      }
+
+      THEN("copies and moves preserve the elements")
+      {
+        small_vectort<std::string> copy(v);
+        REQUIRE(copy==v);
+
+        small_vectort<std::string> moved(std::move(copy));
+        REQUIRE(moved==v);
+        REQUIRE(copy.empty());
+
+        moved.erase(moved.begin()+1);
+        REQUIRE(moved.size()==3);
+        REQUIRE(moved.back()=="a");
+        REQUIRE(moved!=v);
+
+        moved.swap(v);
+        REQUIRE(moved.size()==4);
+        REQUIRE(v.size()==3);
+      }
+    }
+  }
+}
+
+SCENARIO("goto program instruction targets", "[core][goto-programs]")
+{
+  GIVEN("A goto program with a branch to the next instruction")
+  {
+    goto_programt program;
+    goto_programt::targett branch=program.add_instruction(GOTO);
+    goto_programt::targett skip=program.add_instruction(SKIP);
+    skip->labels.push_back("l1");
+    skip->labels.insert(skip->labels.begin(), "l0");
+    branch->targets.push_back(skip);
+    branch->guard=false_exprt();
+    program.add_instruction(END_FUNCTION);
+
+    program.update();
+
+    THEN("the incoming edge is recorded once")
+    {
+      REQUIRE(skip->incoming_edges.size()==1);
+      REQUIRE(skip->incoming_edges.front()==branch);
+      REQUIRE(branch->get_target()==skip);
+    }
+
+    THEN("copies refer to their own instructions")
+    {
+      goto_programt copy;
+      copy.copy_from(program);
+      goto_programt::targett copied_branch=copy.instructions.begin();
+
+      REQUIRE(copied_branch->get_target()==std::next(copied_branch));
+      REQUIRE(copied_branch->get_target()->labels.size()==2);
+      REQUIRE(copied_branch->get_target()->labels.front()=="l0");
+    }
+  }
+}